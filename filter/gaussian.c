@@ -150,6 +150,66 @@ gsl_filter_gaussian(const gsl_filter_end_t endtype, const double alpha, const si
     }
 }
 
+/*
+gsl_filter_gaussian_stream()
+  Apply a Gaussian filter to the next chunk of a data stream; see
+gsl_movstat_stream_accum(). The same alpha and order must be used for
+all calls belonging to one stream.
+
+Inputs: endtype - end point handling
+        alpha   - number of standard deviations to include in Gaussian kernel
+        order   - derivative order of Gaussian
+        x       - next chunk of input stream
+        y       - (output) next filtered values in y(0:ny-1), size at least x->size
+        ny      - (output) number of filtered values stored in y
+        w       - workspace
+*/
+
+int
+gsl_filter_gaussian_stream(const gsl_filter_end_t endtype, const double alpha, const size_t order,
+                           const gsl_vector * x, gsl_vector * y, size_t * ny,
+                           gsl_filter_gaussian_workspace * w)
+{
+  if (alpha <= 0.0)
+    {
+      GSL_ERROR("alpha must be positive", GSL_EDOM);
+    }
+  else
+    {
+      int status;
+      gsl_vector_view kernel = gsl_vector_view_array(w->kernel, w->K);
+
+      gsl_filter_gaussian_kernel(alpha, order, 1, &kernel.vector);
+
+      status = gsl_movstat_stream_accum((gsl_movstat_end_t) endtype, x, &gaussian_accum_type,
+                                        (void *) w->kernel, y, NULL, ny, w->movstat_workspace_p);
+
+      return status;
+    }
+}
+
+int
+gsl_filter_gaussian_stream_finish(const gsl_filter_end_t endtype, const double alpha, const size_t order,
+                                  gsl_vector * y, size_t * ny, gsl_filter_gaussian_workspace * w)
+{
+  if (alpha <= 0.0)
+    {
+      GSL_ERROR("alpha must be positive", GSL_EDOM);
+    }
+  else
+    {
+      int status;
+      gsl_vector_view kernel = gsl_vector_view_array(w->kernel, w->K);
+
+      gsl_filter_gaussian_kernel(alpha, order, 1, &kernel.vector);
+
+      status = gsl_movstat_stream_finish((gsl_movstat_end_t) endtype, &gaussian_accum_type,
+                                         (void *) w->kernel, y, NULL, ny, w->movstat_workspace_p);
+
+      return status;
+    }
+}
+
 /*
 gsl_filter_gaussian_kernel()
   Construct Gaussian kernel with given sigma and order
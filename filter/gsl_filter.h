@@ -66,6 +66,11 @@ void gsl_filter_gaussian_free(gsl_filter_gaussian_workspace * w);
 int gsl_filter_gaussian(const gsl_filter_end_t endtype, const double alpha, const size_t order, const gsl_vector * x,
                         gsl_vector * y, gsl_filter_gaussian_workspace * w);
 int gsl_filter_gaussian_kernel(const double alpha, const size_t order, const int normalize, gsl_vector * kernel);
+int gsl_filter_gaussian_stream(const gsl_filter_end_t endtype, const double alpha, const size_t order,
+                               const gsl_vector * x, gsl_vector * y, size_t * ny,
+                               gsl_filter_gaussian_workspace * w);
+int gsl_filter_gaussian_stream_finish(const gsl_filter_end_t endtype, const double alpha, const size_t order,
+                                      gsl_vector * y, size_t * ny, gsl_filter_gaussian_workspace * w);
 
 /* workspace for standard median filter */
 typedef struct
@@ -76,6 +81,10 @@ typedef struct
 gsl_filter_median_workspace *gsl_filter_median_alloc(const size_t K);
 void gsl_filter_median_free(gsl_filter_median_workspace * w);
 int gsl_filter_median(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y, gsl_filter_median_workspace * w);
+int gsl_filter_median_stream(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y,
+                             size_t * ny, gsl_filter_median_workspace * w);
+int gsl_filter_median_stream_finish(const gsl_filter_end_t endtype, gsl_vector * y, size_t * ny,
+                                    gsl_filter_median_workspace * w);
 
 /* workspace for recursive median filter */
 typedef struct
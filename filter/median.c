@@ -75,3 +75,33 @@ gsl_filter_median(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vect
   int status = gsl_movstat_median(endtype, x, y, w->movstat_workspace_p);
   return status;
 }
+
+/*
+gsl_filter_median_stream()
+  Standard median filter applied to the next chunk of a data stream;
+see gsl_movstat_stream_accum()
+
+Inputs: endtype - end point handling
+        x       - next chunk of input stream
+        y       - (output) next filtered values in y(0:ny-1), size at least x->size
+        ny      - (output) number of filtered values stored in y
+        w       - workspace
+*/
+
+int
+gsl_filter_median_stream(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y,
+                         size_t * ny, gsl_filter_median_workspace * w)
+{
+  int status = gsl_movstat_stream_accum((gsl_movstat_end_t) endtype, x, gsl_movstat_accum_median,
+                                        NULL, y, NULL, ny, w->movstat_workspace_p);
+  return status;
+}
+
+int
+gsl_filter_median_stream_finish(const gsl_filter_end_t endtype, gsl_vector * y, size_t * ny,
+                                gsl_filter_median_workspace * w)
+{
+  int status = gsl_movstat_stream_finish((gsl_movstat_end_t) endtype, gsl_movstat_accum_median,
+                                         NULL, y, NULL, ny, w->movstat_workspace_p);
+  return status;
+}
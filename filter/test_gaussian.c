@@ -131,6 +131,36 @@ test_gaussian_proc(const double tol, const double alpha, const size_t order, con
   sprintf(buf, "n=%zu K=%zu endtype=%u alpha=%g order=%zu gaussian random in-place", n, K, etype, alpha, order);
   compare_vectors(tol, z, y, buf);
 
+  /* z = filter(x) streamed in place in chunks of 13 samples */
+  {
+    const size_t chunk = 13;
+    size_t start, nout = 0, ny;
+
+    gsl_vector_memcpy(z, x);
+
+    for (start = 0; start < n; start += chunk)
+      {
+        const size_t m = GSL_MIN(chunk, n - start);
+        gsl_vector_view xc = gsl_vector_subvector(z, start, m);
+        gsl_vector_view yc = gsl_vector_subvector(z, nout, m);
+
+        gsl_filter_gaussian_stream(etype, alpha, order, &xc.vector, &yc.vector, &ny, w);
+        nout += ny;
+      }
+
+    /* remaining J outputs; the view is empty when J = 0 */
+    {
+      gsl_vector_view yc = gsl_vector_subvector(z, GSL_MIN(nout, n - 1), n - nout);
+      gsl_filter_gaussian_stream_finish(etype, alpha, order, &yc.vector, &ny, w);
+      nout += ny;
+    }
+
+    gsl_test_int(nout, n, "n=%zu K=%zu endtype=%u gaussian stream nout", n, K, etype);
+
+    sprintf(buf, "n=%zu K=%zu endtype=%u alpha=%g order=%zu gaussian random stream", n, K, etype, alpha, order);
+    compare_vectors(tol, z, y, buf);
+  }
+
   gsl_filter_gaussian_free(w);
   gsl_vector_free(x);
   gsl_vector_free(y);
@@ -77,6 +77,36 @@ test_median_proc(const double tol, const size_t n, const size_t K,
   sprintf(buf, "n=%zu K=%zu endtype=%u median random in-place", n, K, etype);
   compare_vectors(tol, z, y, buf);
 
+  /* z = median(x) streamed in place in chunks of 13 samples */
+  {
+    const size_t chunk = 13;
+    size_t start, nout = 0, ny;
+
+    gsl_vector_memcpy(z, x);
+
+    for (start = 0; start < n; start += chunk)
+      {
+        const size_t m = GSL_MIN(chunk, n - start);
+        gsl_vector_view xc = gsl_vector_subvector(z, start, m);
+        gsl_vector_view yc = gsl_vector_subvector(z, nout, m);
+
+        gsl_filter_median_stream(etype, &xc.vector, &yc.vector, &ny, w);
+        nout += ny;
+      }
+
+    /* remaining J outputs; the view is empty when J = 0 */
+    {
+      gsl_vector_view yc = gsl_vector_subvector(z, GSL_MIN(nout, n - 1), n - nout);
+      gsl_filter_median_stream_finish(etype, &yc.vector, &ny, w);
+      nout += ny;
+    }
+
+    gsl_test_int(nout, n, "n=%zu K=%zu endtype=%u median stream nout", n, K, etype);
+
+    sprintf(buf, "n=%zu K=%zu endtype=%u median random stream", n, K, etype);
+    compare_vectors(tol, z, y, buf);
+  }
+
   gsl_vector_free(x);
   gsl_vector_free(y);
   gsl_vector_free(z);
@@ -53,3 +53,42 @@ gsl_histogram_accumulate (gsl_histogram * h, double x, double weight)
 
   return GSL_SUCCESS;
 }
+
+/* Add each of the n values x[i*stride] to the histogram. Values outside
+   the range of the histogram are ignored, and GSL_EDOM is returned if
+   there were any (without calling the error handler), as for
+   gsl_histogram_increment */
+
+int
+gsl_histogram_increment_array (gsl_histogram * h, const double x[],
+                               const size_t stride, const size_t n)
+{
+  const double one = 1.0;
+  int status = gsl_histogram_accumulate_array (h, x, stride, &one, 0, n);
+  return status;
+}
+
+int
+gsl_histogram_accumulate_array (gsl_histogram * h, const double x[],
+                                const size_t xstride, const double weight[],
+                                const size_t wstride, const size_t n)
+{
+  const size_t nbins = h->n;
+  const double *range = h->range;
+  const double scale = nbins / (range[nbins] - range[0]);
+  double *bin = h->bin;
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      size_t index;
+
+      if (find_fast (nbins, range, scale, x[i * xstride], &index))
+        status = GSL_EDOM;
+      else
+        bin[index] += weight[i * wstride];
+    }
+
+  return status;
+}
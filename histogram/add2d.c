@@ -64,3 +64,48 @@ gsl_histogram2d_accumulate (gsl_histogram2d * h,
 
   return GSL_SUCCESS;
 }
+
+/* Add each of the n points (x[i*xstride], y[i*ystride]) to the
+   histogram. Points outside the range of the histogram are ignored,
+   and GSL_EDOM is returned if there were any (without calling the error
+   handler), as for gsl_histogram2d_increment */
+
+int
+gsl_histogram2d_increment_array (gsl_histogram2d * h,
+                                 const double x[], const size_t xstride,
+                                 const double y[], const size_t ystride,
+                                 const size_t n)
+{
+  const double one = 1.0;
+  int status = gsl_histogram2d_accumulate_array (h, x, xstride, y, ystride,
+                                                 &one, 0, n);
+  return status;
+}
+
+int
+gsl_histogram2d_accumulate_array (gsl_histogram2d * h,
+                                  const double x[], const size_t xstride,
+                                  const double y[], const size_t ystride,
+                                  const double weight[], const size_t wstride,
+                                  const size_t n)
+{
+  const size_t nx = h->nx;
+  const size_t ny = h->ny;
+  const double xscale = nx / (h->xrange[nx] - h->xrange[0]);
+  const double yscale = ny / (h->yrange[ny] - h->yrange[0]);
+  int status = GSL_SUCCESS;
+  size_t k;
+
+  for (k = 0; k < n; ++k)
+    {
+      size_t i, j;
+
+      if (find_fast (nx, h->xrange, xscale, x[k * xstride], &i) ||
+          find_fast (ny, h->yrange, yscale, y[k * ystride], &j))
+        status = GSL_EDOM;
+      else
+        h->bin[i * ny + j] += weight[k * wstride];
+    }
+
+  return status;
+}
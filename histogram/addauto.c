@@ -0,0 +1,214 @@
+/* histogram/addauto.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram_auto.h>
+
+/* grid indices beyond this are not represented exactly */
+#define HISTAUTO_GRID_MAX 4503599627370496.0 /* 2^52 */
+
+/*
+histauto_rebin()
+  Double the bin width, merging pairs of adjacent grid cells. The new
+range contains the old one and extends it by about n old bins to the
+left (left = 1) or right (left = 0). Bins are accumulated in the
+workspace, which is then swapped with the bin array, so the memory used
+by the histogram never changes.
+*/
+
+static void
+histauto_rebin (gsl_histogram_auto * h, const int left)
+{
+  const size_t n = h->n;
+  const double offset = h->offset;
+  const double new_offset = left ? ceil ((offset - (double) n) / 2.0)
+                                 : floor (offset / 2.0);
+  double *tmp;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    h->work[i] = 0.0;
+
+  for (i = 0; i < n; i++)
+    {
+      size_t j = (size_t) (floor ((offset + (double) i) / 2.0) - new_offset);
+      h->work[j] += h->bin[i];
+    }
+
+  tmp = h->bin;
+  h->bin = h->work;
+  h->work = tmp;
+
+  h->offset = new_offset;
+  h->width *= 2.0;
+}
+
+/* find bin of x, extending the range of h until it contains x */
+static size_t
+histauto_bin (gsl_histogram_auto * h, const double x)
+{
+  double k;
+
+  if (h->nsamples == 0)
+    {
+      /* center the range on the first sample */
+      while (fabs (x) >= HISTAUTO_GRID_MAX * h->width)
+        h->width *= 2.0;
+
+      h->offset = floor (x / h->width) - (double) (h->n / 2);
+    }
+
+  k = floor (x / h->width) - h->offset;
+
+  while (k < 0.0 || k >= (double) h->n)
+    {
+      histauto_rebin (h, k < 0.0);
+      k = floor (x / h->width) - h->offset;
+    }
+
+  return (size_t) k;
+}
+
+int
+gsl_histogram_auto_increment (gsl_histogram_auto * h, const double x)
+{
+  return gsl_histogram_auto_accumulate (h, x, 1.0);
+}
+
+/* Add weight to the bin containing x. Non-finite values cannot be
+   binned, and GSL_EDOM is returned without calling the error handler
+   (as for out of range values in gsl_histogram_accumulate) */
+int
+gsl_histogram_auto_accumulate (gsl_histogram_auto * h, const double x,
+                               const double weight)
+{
+  size_t i;
+
+  if (!gsl_finite (x))
+    {
+      return GSL_EDOM;
+    }
+
+  i = histauto_bin (h, x);
+  h->bin[i] += weight;
+  h->nsamples++;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram_auto_increment_array (gsl_histogram_auto * h, const double x[],
+                                    const size_t stride, const size_t n)
+{
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (gsl_histogram_auto_accumulate (h, x[i * stride], 1.0))
+        status = GSL_EDOM;
+    }
+
+  return status;
+}
+
+int
+gsl_histogram_auto_accumulate_array (gsl_histogram_auto * h, const double x[],
+                                     const size_t xstride, const double weight[],
+                                     const size_t wstride, const size_t n)
+{
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (gsl_histogram_auto_accumulate (h, x[i * xstride], weight[i * wstride]))
+        status = GSL_EDOM;
+    }
+
+  return status;
+}
+
+/*
+gsl_histogram_auto_add()
+  h1 += h2. The histograms must have the same number of bins and initial
+bin width, so that their bin edges lie on a common grid. h1 is rebinned
+as needed until its bins are at least as wide as those of h2 and its
+range contains the range of h2.
+*/
+
+int
+gsl_histogram_auto_add (gsl_histogram_auto * h1, const gsl_histogram_auto * h2)
+{
+  const size_t n = h1->n;
+  double r, lo, hi;
+  size_t i;
+
+  if (h2->n != n)
+    {
+      GSL_ERROR ("histograms have different sizes", GSL_EINVAL);
+    }
+
+  if (h1->width0 != h2->width0)
+    {
+      GSL_ERROR ("histograms have different initial bin widths", GSL_EINVAL);
+    }
+
+  if (h2->nsamples == 0)
+    {
+      return GSL_SUCCESS;
+    }
+
+  if (h1->nsamples == 0)
+    {
+      h1->width = h2->width;
+      h1->offset = h2->offset;
+    }
+
+  while (h1->width < h2->width)
+    histauto_rebin (h1, h2->offset * h2->width < h1->offset * h1->width);
+
+  /* range of h2 in grid cells of h1; r is a power of 2 */
+  while (1)
+    {
+      r = h1->width / h2->width;
+      lo = floor (h2->offset / r);
+      hi = floor ((h2->offset + (double) (n - 1)) / r);
+
+      if (lo < h1->offset)
+        histauto_rebin (h1, 1);
+      else if (hi >= h1->offset + (double) n)
+        histauto_rebin (h1, 0);
+      else
+        break;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      size_t j = (size_t) (floor ((h2->offset + (double) i) / r) - h1->offset);
+      h1->bin[j] += h2->bin[i];
+    }
+
+  h1->nsamples += h2->nsamples;
+
+  return GSL_SUCCESS;
+}
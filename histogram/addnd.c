@@ -0,0 +1,217 @@
+/* histogram/addnd.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "find.c"
+#include "hashnd.h"
+
+/* compute linear bin index of point x; returns nonzero if x is outside
+   the range of the histogram */
+static int
+histnd_find_key (const gsl_histogramnd * h, const double x[], size_t * key)
+{
+  size_t k = 0;
+  size_t d;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      size_t i;
+
+      if (find_fast (h->n[d], h->range[d], h->scale[d], x[d], &i))
+        return GSL_EDOM;
+
+      k = k * h->n[d] + i;
+    }
+
+  *key = k;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_increment (gsl_histogramnd * h, const double x[])
+{
+  int status = gsl_histogramnd_accumulate (h, x, 1.0);
+  return status;
+}
+
+int
+gsl_histogramnd_accumulate (gsl_histogramnd * h, const double x[],
+                            const double weight)
+{
+  size_t key, pos;
+  int status;
+
+  if (histnd_find_key (h, x, &key))
+    {
+      return GSL_EDOM;
+    }
+
+  status = histnd_insert (h, key, &pos);
+  if (status)
+    return status;
+
+  h->bin[pos] += weight;
+
+  return GSL_SUCCESS;
+}
+
+/* Add the npts points x[i*tda + d], d = 0, ..., ndim - 1, to the
+   histogram. Points outside the range of the histogram are ignored,
+   and GSL_EDOM is returned if there were any (without calling the
+   error handler) */
+
+int
+gsl_histogramnd_increment_array (gsl_histogramnd * h, const double x[],
+                                 const size_t tda, const size_t npts)
+{
+  const double one = 1.0;
+  int status = gsl_histogramnd_accumulate_array (h, x, tda, &one, 0, npts);
+  return status;
+}
+
+int
+gsl_histogramnd_accumulate_array (gsl_histogramnd * h, const double x[],
+                                  const size_t tda, const double weight[],
+                                  const size_t wstride, const size_t npts)
+{
+  int status = GSL_SUCCESS;
+  size_t i;
+
+  if (tda < h->ndim)
+    {
+      GSL_ERROR ("tda must be at least the histogram dimension", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < npts; i++)
+    {
+      size_t key, pos;
+
+      if (histnd_find_key (h, x + i * tda, &key))
+        {
+          status = GSL_EDOM;
+        }
+      else
+        {
+          int s = histnd_insert (h, key, &pos);
+          if (s)
+            return s;
+
+          h->bin[pos] += weight[i * wstride];
+        }
+    }
+
+  return status;
+}
+
+int
+gsl_histogramnd_find (const gsl_histogramnd * h, const double x[],
+                      size_t idx[])
+{
+  size_t d;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      int status = find (h->n[d], h->range[d], x[d], &idx[d]);
+
+      if (status)
+        {
+          GSL_ERROR ("x not found in range of h", GSL_EDOM);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_histogramnd_get (const gsl_histogramnd * h, const size_t idx[])
+{
+  size_t d, pos;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      if (idx[d] >= h->n[d])
+        {
+          GSL_ERROR_VAL ("index lies outside valid range", GSL_EDOM, 0);
+        }
+    }
+
+  pos = histnd_lookup (h, histnd_ravel (h, idx));
+
+  return (pos == HISTND_EMPTY) ? 0.0 : h->bin[pos];
+}
+
+int
+gsl_histogramnd_get_range (const gsl_histogramnd * h, const size_t d,
+                           const size_t i, double * lower, double * upper)
+{
+  if (d >= h->ndim)
+    {
+      GSL_ERROR ("dimension exceeds histogram dimension", GSL_EINVAL);
+    }
+
+  if (i >= h->n[d])
+    {
+      GSL_ERROR ("index lies outside valid range of 0 .. n - 1", GSL_EDOM);
+    }
+
+  *lower = h->range[d][i];
+  *upper = h->range[d][i + 1];
+
+  return GSL_SUCCESS;
+}
+
+/* number of stored bins; all other bins are zero */
+size_t
+gsl_histogramnd_nnz (const gsl_histogramnd * h)
+{
+  return h->nnz;
+}
+
+/* get multi-index and value of the k-th stored bin, k = 0, ..., nnz - 1 */
+int
+gsl_histogramnd_get_stored (const gsl_histogramnd * h, const size_t k,
+                            size_t idx[], double * value)
+{
+  if (k >= h->nnz)
+    {
+      GSL_ERROR ("index lies outside valid range of 0 .. nnz - 1", GSL_EDOM);
+    }
+
+  histnd_unravel (h->ndim, h->n, h->key[k], idx);
+  *value = h->bin[k];
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_histogramnd_sum (const gsl_histogramnd * h)
+{
+  double sum = 0.0;
+  size_t k;
+
+  for (k = 0; k < h->nnz; k++)
+    sum += h->bin[k];
+
+  return sum;
+}
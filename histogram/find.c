@@ -22,6 +22,8 @@
 
 static int find (const size_t n, const double range[], 
                  const double x, size_t * i);
+static inline int find_fast (const size_t n, const double range[],
+                             const double scale, const double x, size_t * i);
 
 static int
 find (const size_t n, const double range[], const double x, size_t * i)
@@ -84,3 +86,45 @@ find (const size_t n, const double range[], const double x, size_t * i)
   return 0;
 }
 
+/* Version of find() for use in loops over many values. The caller
+   supplies scale = n / (range[n] - range[0]) so that the linear guess
+   requires no division. If the guess fails (non-uniform ranges), a
+   binary search is performed whose loop body compiles to a conditional
+   move rather than an unpredictable branch. Values outside the range,
+   including NaN, return nonzero without calling the error handler. */
+
+static inline int
+find_fast (const size_t n, const double range[], const double scale,
+           const double x, size_t * i)
+{
+  const double *base = range;
+  size_t k, len = n;
+  double u;
+
+  if (!(x >= range[0] && x < range[n]))
+    {
+      return (x < range[0]) ? -1 : +1;
+    }
+
+  u = (x - range[0]) * scale;
+  k = (u < (double) n) ? (size_t) u : n - 1;
+
+  if (x >= range[k] && x < range[k + 1])
+    {
+      *i = k;
+      return 0;
+    }
+
+  /* find largest k with range[k] <= x, using range[0] <= x < range[n] */
+
+  while (len > 1)
+    {
+      const size_t half = len / 2;
+      base = (base[half] <= x) ? base + half : base;
+      len -= half;
+    }
+
+  *i = base - range;
+
+  return 0;
+}
@@ -54,6 +54,11 @@ gsl_histogram * gsl_histogram_calloc_uniform (const size_t n, const double xmin,
 void gsl_histogram_free (gsl_histogram * h);
 int gsl_histogram_increment (gsl_histogram * h, double x);
 int gsl_histogram_accumulate (gsl_histogram * h, double x, double weight);
+int gsl_histogram_increment_array (gsl_histogram * h, const double x[],
+                                   const size_t stride, const size_t n);
+int gsl_histogram_accumulate_array (gsl_histogram * h, const double x[],
+                                    const size_t xstride, const double weight[],
+                                    const size_t wstride, const size_t n);
 int gsl_histogram_find (const gsl_histogram * h, 
                         const double x, size_t * i);
 
@@ -0,0 +1,82 @@
+/* histogram/gsl_histogram_auto.h
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_HISTOGRAM_AUTO_H__
+#define __GSL_HISTOGRAM_AUTO_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_histogram.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Bin i covers [(offset + i) * width, (offset + i + 1) * width), where
+   width = width0 * 2^k and offset is an integer, so that the bin edges
+   of all histograms with the same width0 lie on a common grid */
+
+typedef struct {
+  size_t n ;        /* number of bins */
+  double width0 ;   /* initial bin width */
+  double width ;    /* current bin width */
+  double offset ;   /* grid index of bin 0 */
+  size_t nsamples ; /* number of samples added */
+  double * bin ;    /* bin values, size n */
+  double * work ;   /* workspace for rebinning, size n */
+} gsl_histogram_auto ;
+
+gsl_histogram_auto * gsl_histogram_auto_alloc (const size_t n, const double width);
+void gsl_histogram_auto_free (gsl_histogram_auto * h);
+void gsl_histogram_auto_reset (gsl_histogram_auto * h);
+
+int gsl_histogram_auto_increment (gsl_histogram_auto * h, const double x);
+int gsl_histogram_auto_accumulate (gsl_histogram_auto * h, const double x,
+                                   const double weight);
+int gsl_histogram_auto_increment_array (gsl_histogram_auto * h, const double x[],
+                                        const size_t stride, const size_t n);
+int gsl_histogram_auto_accumulate_array (gsl_histogram_auto * h, const double x[],
+                                         const size_t xstride, const double weight[],
+                                         const size_t wstride, const size_t n);
+
+double gsl_histogram_auto_get (const gsl_histogram_auto * h, const size_t i);
+int gsl_histogram_auto_get_range (const gsl_histogram_auto * h, const size_t i,
+                                  double * lower, double * upper);
+int gsl_histogram_auto_find (const gsl_histogram_auto * h, const double x,
+                             size_t * i);
+
+double gsl_histogram_auto_max (const gsl_histogram_auto * h);
+double gsl_histogram_auto_min (const gsl_histogram_auto * h);
+size_t gsl_histogram_auto_bins (const gsl_histogram_auto * h);
+double gsl_histogram_auto_width (const gsl_histogram_auto * h);
+double gsl_histogram_auto_sum (const gsl_histogram_auto * h);
+
+int gsl_histogram_auto_add (gsl_histogram_auto * h1, const gsl_histogram_auto * h2);
+int gsl_histogram_auto_copy (gsl_histogram * dest, const gsl_histogram_auto * src);
+
+__END_DECLS
+
+#endif /* __GSL_HISTOGRAM_AUTO_H__ */
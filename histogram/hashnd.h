@@ -0,0 +1,174 @@
+/* histogram/hashnd.h
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Sparse bin storage for N-dimensional histograms. Each stored bin is
+ * identified by its row-major linear index, key = ((i_0 n_1 + i_1) n_2
+ * + i_2) ..., and the keys and values of the stored bins are kept in
+ * the compact arrays h->key and h->bin in order of first use. An open
+ * addressing hash table with linear probing maps keys to positions in
+ * these arrays. The table has twice as many slots as the arrays, so it
+ * is at most half full.
+ */
+
+#define HISTND_EMPTY ((size_t) -1)
+#define HISTND_NALLOC_MIN 16
+
+static inline size_t
+histnd_hash (const size_t key, const size_t tsize)
+{
+  size_t k = key * (size_t) 2654435761UL;
+  k ^= k >> 13;
+  return k & (tsize - 1);
+}
+
+/* return position of key in h->key, or HISTND_EMPTY if not stored */
+static inline size_t
+histnd_lookup (const gsl_histogramnd * h, const size_t key)
+{
+  size_t s = histnd_hash (key, h->tsize);
+
+  while (h->table[s] != HISTND_EMPTY)
+    {
+      if (h->key[h->table[s]] == key)
+        return h->table[s];
+
+      s = (s + 1) & (h->tsize - 1);
+    }
+
+  return HISTND_EMPTY;
+}
+
+/* build hash table of size tsize for the stored bins */
+static inline int
+histnd_rehash (gsl_histogramnd * h, const size_t tsize)
+{
+  size_t *table = malloc (tsize * sizeof (size_t));
+  size_t i;
+
+  if (table == 0)
+    {
+      GSL_ERROR ("failed to allocate space for histogram hash table", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < tsize; i++)
+    table[i] = HISTND_EMPTY;
+
+  for (i = 0; i < h->nnz; i++)
+    {
+      size_t s = histnd_hash (h->key[i], tsize);
+
+      while (table[s] != HISTND_EMPTY)
+        s = (s + 1) & (tsize - 1);
+
+      table[s] = i;
+    }
+
+  free (h->table);
+  h->table = table;
+  h->tsize = tsize;
+
+  return GSL_SUCCESS;
+}
+
+/* return position of key in h->bin, adding a zero bin if not stored */
+static inline int
+histnd_insert (gsl_histogramnd * h, const size_t key, size_t * pos)
+{
+  size_t s = histnd_hash (key, h->tsize);
+
+  while (h->table[s] != HISTND_EMPTY)
+    {
+      if (h->key[h->table[s]] == key)
+        {
+          *pos = h->table[s];
+          return GSL_SUCCESS;
+        }
+
+      s = (s + 1) & (h->tsize - 1);
+    }
+
+  if (h->nnz == h->nalloc)
+    {
+      const size_t nalloc = 2 * h->nalloc;
+      size_t *k = realloc (h->key, nalloc * sizeof (size_t));
+      double *b;
+      int status;
+
+      if (k == 0)
+        {
+          GSL_ERROR ("failed to allocate space for histogram bins", GSL_ENOMEM);
+        }
+
+      h->key = k;
+
+      b = realloc (h->bin, nalloc * sizeof (double));
+
+      if (b == 0)
+        {
+          GSL_ERROR ("failed to allocate space for histogram bins", GSL_ENOMEM);
+        }
+
+      h->bin = b;
+      h->nalloc = nalloc;
+
+      status = histnd_rehash (h, 2 * nalloc);
+      if (status)
+        return status;
+
+      s = histnd_hash (key, h->tsize);
+
+      while (h->table[s] != HISTND_EMPTY)
+        s = (s + 1) & (h->tsize - 1);
+    }
+
+  h->key[h->nnz] = key;
+  h->bin[h->nnz] = 0.0;
+  h->table[s] = h->nnz;
+  *pos = h->nnz;
+  ++(h->nnz);
+
+  return GSL_SUCCESS;
+}
+
+/* convert multi-index to linear index */
+static inline size_t
+histnd_ravel (const gsl_histogramnd * h, const size_t idx[])
+{
+  size_t key = 0;
+  size_t d;
+
+  for (d = 0; d < h->ndim; d++)
+    key = key * h->n[d] + idx[d];
+
+  return key;
+}
+
+/* convert linear index to multi-index */
+static inline void
+histnd_unravel (const size_t ndim, const size_t n[], size_t key, size_t idx[])
+{
+  size_t d;
+
+  for (d = ndim; d-- > 0; )
+    {
+      idx[d] = key % n[d];
+      key /= n[d];
+    }
+}
@@ -0,0 +1,214 @@
+/* histogram/initauto.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram_auto.h>
+
+/*
+gsl_histogram_auto_alloc()
+  Allocate a histogram whose range is determined by the data. The range
+covers n bins of the given initial width, placed around the first
+sample, and is doubled by merging adjacent bins whenever a sample falls
+outside of it.
+
+Inputs: n     - number of bins
+        width - initial (finest) bin width
+
+Return: pointer to histogram
+*/
+
+gsl_histogram_auto *
+gsl_histogram_auto_alloc (const size_t n, const double width)
+{
+  gsl_histogram_auto *h;
+
+  /* with a single bin, doubling the width cannot always extend the
+     range to the left */
+  if (n < 2)
+    {
+      GSL_ERROR_VAL ("histogram length n must be at least 2",
+                     GSL_EDOM, 0);
+    }
+
+  if (!(width > 0.0) || !gsl_finite (width))
+    {
+      GSL_ERROR_VAL ("histogram bin width must be positive", GSL_EDOM, 0);
+    }
+
+  h = malloc (sizeof (gsl_histogram_auto));
+
+  if (h == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->bin = malloc (n * sizeof (double));
+
+  if (h->bin == 0)
+    {
+      free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogram bins",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->work = malloc (n * sizeof (double));
+
+  if (h->work == 0)
+    {
+      free (h->bin);
+      free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogram workspace",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->n = n;
+  h->width0 = width;
+
+  gsl_histogram_auto_reset (h);
+
+  return h;
+}
+
+void
+gsl_histogram_auto_free (gsl_histogram_auto * h)
+{
+  RETURN_IF_NULL (h);
+  free (h->bin);
+  free (h->work);
+  free (h);
+}
+
+/* remove all samples and restore the initial bin width */
+void
+gsl_histogram_auto_reset (gsl_histogram_auto * h)
+{
+  size_t i;
+
+  for (i = 0; i < h->n; i++)
+    h->bin[i] = 0.0;
+
+  h->width = h->width0;
+  h->offset = 0.0;
+  h->nsamples = 0;
+}
+
+double
+gsl_histogram_auto_get (const gsl_histogram_auto * h, const size_t i)
+{
+  if (i >= h->n)
+    {
+      GSL_ERROR_VAL ("index lies outside valid range of 0 .. n - 1",
+                     GSL_EDOM, 0);
+    }
+
+  return h->bin[i];
+}
+
+int
+gsl_histogram_auto_get_range (const gsl_histogram_auto * h, const size_t i,
+                              double *lower, double *upper)
+{
+  if (i >= h->n)
+    {
+      GSL_ERROR ("index lies outside valid range of 0 .. n - 1", GSL_EDOM);
+    }
+
+  *lower = (h->offset + (double) i) * h->width;
+  *upper = (h->offset + (double) i + 1.0) * h->width;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogram_auto_find (const gsl_histogram_auto * h, const double x,
+                         size_t * i)
+{
+  const double k = floor (x / h->width) - h->offset;
+
+  if (!(k >= 0.0 && k < (double) h->n))
+    {
+      GSL_ERROR ("x not found in range of h", GSL_EDOM);
+    }
+
+  *i = (size_t) k;
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_histogram_auto_max (const gsl_histogram_auto * h)
+{
+  return (h->offset + (double) h->n) * h->width;
+}
+
+double
+gsl_histogram_auto_min (const gsl_histogram_auto * h)
+{
+  return h->offset * h->width;
+}
+
+size_t
+gsl_histogram_auto_bins (const gsl_histogram_auto * h)
+{
+  return h->n;
+}
+
+double
+gsl_histogram_auto_width (const gsl_histogram_auto * h)
+{
+  return h->width;
+}
+
+double
+gsl_histogram_auto_sum (const gsl_histogram_auto * h)
+{
+  double sum = 0.0;
+  size_t i;
+
+  for (i = 0; i < h->n; i++)
+    sum += h->bin[i];
+
+  return sum;
+}
+
+/* copy the current ranges and bins of src into the fixed range histogram dest */
+int
+gsl_histogram_auto_copy (gsl_histogram * dest, const gsl_histogram_auto * src)
+{
+  size_t i;
+
+  if (dest->n != src->n)
+    {
+      GSL_ERROR ("histograms have different sizes, cannot copy",
+                 GSL_EINVAL);
+    }
+
+  for (i = 0; i <= src->n; i++)
+    dest->range[i] = (src->offset + (double) i) * src->width;
+
+  for (i = 0; i < src->n; i++)
+    dest->bin[i] = src->bin[i];
+
+  return GSL_SUCCESS;
+}
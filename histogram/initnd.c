@@ -0,0 +1,233 @@
+/* histogram/initnd.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "hashnd.h"
+
+/*
+gsl_histogramnd_alloc()
+  Allocate an N-dimensional histogram with sparse bin storage. The
+ranges of dimension d are initialized to 0, 1, ..., n[d], and all bins
+are zero.
+
+Inputs: ndim - number of dimensions
+        n    - number of bins in each dimension, length ndim
+
+Return: pointer to histogram
+*/
+
+gsl_histogramnd *
+gsl_histogramnd_alloc (const size_t ndim, const size_t n[])
+{
+  gsl_histogramnd *h;
+  size_t d, total = 1;
+
+  if (ndim == 0)
+    {
+      GSL_ERROR_VAL ("histogram dimension must be positive integer",
+                     GSL_EDOM, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      if (n[d] == 0)
+        {
+          GSL_ERROR_VAL ("histogram lengths must be positive integers",
+                         GSL_EDOM, 0);
+        }
+
+      if (total > ((size_t) -1 - 1) / n[d])
+        {
+          GSL_ERROR_VAL ("total number of histogram bins is too large",
+                         GSL_EINVAL, 0);
+        }
+
+      total *= n[d];
+    }
+
+  h = calloc (1, sizeof (gsl_histogramnd));
+
+  if (h == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  h->ndim = ndim;
+  h->n = malloc (ndim * sizeof (size_t));
+  h->range = calloc (ndim, sizeof (double *));
+  h->scale = malloc (ndim * sizeof (double));
+
+  if (h->n == 0 || h->range == 0 || h->scale == 0)
+    {
+      gsl_histogramnd_free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogram ranges",
+                     GSL_ENOMEM, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      size_t i;
+
+      h->n[d] = n[d];
+      h->range[d] = malloc ((n[d] + 1) * sizeof (double));
+
+      if (h->range[d] == 0)
+        {
+          gsl_histogramnd_free (h);
+          GSL_ERROR_VAL ("failed to allocate space for histogram ranges",
+                         GSL_ENOMEM, 0);
+        }
+
+      for (i = 0; i <= n[d]; i++)
+        h->range[d][i] = (double) i;
+
+      h->scale[d] = 1.0;
+    }
+
+  h->nalloc = HISTND_NALLOC_MIN;
+  h->key = malloc (h->nalloc * sizeof (size_t));
+  h->bin = malloc (h->nalloc * sizeof (double));
+
+  if (h->key == 0 || h->bin == 0 ||
+      histnd_rehash (h, 2 * h->nalloc) != GSL_SUCCESS)
+    {
+      gsl_histogramnd_free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogram bins",
+                     GSL_ENOMEM, 0);
+    }
+
+  return h;
+}
+
+void
+gsl_histogramnd_free (gsl_histogramnd * h)
+{
+  RETURN_IF_NULL (h);
+
+  if (h->range)
+    {
+      size_t d;
+
+      for (d = 0; d < h->ndim; d++)
+        free (h->range[d]);
+
+      free (h->range);
+    }
+
+  free (h->n);
+  free (h->scale);
+  free (h->key);
+  free (h->bin);
+  free (h->table);
+  free (h);
+}
+
+/* remove all stored bins, keeping the allocated storage */
+void
+gsl_histogramnd_reset (gsl_histogramnd * h)
+{
+  size_t i;
+
+  for (i = 0; i < h->tsize; i++)
+    h->table[i] = HISTND_EMPTY;
+
+  h->nnz = 0;
+}
+
+/*
+gsl_histogramnd_set_ranges()
+  Set the bin edges of dimension d and reset the histogram
+
+Inputs: h     - histogram
+        d     - dimension, 0 <= d < ndim
+        range - bin edges, strictly increasing, length size
+        size  - must equal n[d] + 1
+*/
+
+int
+gsl_histogramnd_set_ranges (gsl_histogramnd * h, const size_t d,
+                            const double range[], const size_t size)
+{
+  size_t i;
+
+  if (d >= h->ndim)
+    {
+      GSL_ERROR ("dimension exceeds histogram dimension", GSL_EINVAL);
+    }
+
+  if (size != h->n[d] + 1)
+    {
+      GSL_ERROR ("size of range must match size of histogram", GSL_EINVAL);
+    }
+
+  for (i = 0; i < h->n[d]; i++)
+    {
+      if (!(range[i] < range[i + 1]))
+        {
+          GSL_ERROR ("histogram ranges must be strictly increasing",
+                     GSL_EINVAL);
+        }
+    }
+
+  for (i = 0; i <= h->n[d]; i++)
+    h->range[d][i] = range[i];
+
+  h->scale[d] = h->n[d] / (range[h->n[d]] - range[0]);
+
+  gsl_histogramnd_reset (h);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_set_ranges_uniform (gsl_histogramnd * h, const size_t d,
+                                    const double xmin, const double xmax)
+{
+  size_t i, n;
+
+  if (d >= h->ndim)
+    {
+      GSL_ERROR ("dimension exceeds histogram dimension", GSL_EINVAL);
+    }
+
+  if (xmin >= xmax)
+    {
+      GSL_ERROR ("xmin must be less than xmax", GSL_EINVAL);
+    }
+
+  n = h->n[d];
+
+  for (i = 0; i <= n; i++)
+    {
+      double f1 = ((double) (n - i) / (double) n);
+      double f2 = ((double) i / (double) n);
+      h->range[d][i] = f1 * xmin + f2 * xmax;
+    }
+
+  h->scale[d] = n / (xmax - xmin);
+
+  gsl_histogramnd_reset (h);
+
+  return GSL_SUCCESS;
+}
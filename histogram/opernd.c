@@ -0,0 +1,92 @@
+/* histogram/opernd.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "hashnd.h"
+
+int
+gsl_histogramnd_equal_bins_p (const gsl_histogramnd * h1,
+                              const gsl_histogramnd * h2)
+{
+  size_t d, i;
+
+  if (h1->ndim != h2->ndim)
+    {
+      return 0;
+    }
+
+  for (d = 0; d < h1->ndim; d++)
+    {
+      if (h1->n[d] != h2->n[d])
+        {
+          return 0;
+        }
+
+      for (i = 0; i <= h1->n[d]; i++)
+        {
+          if (h1->range[d][i] != h2->range[d][i])
+            {
+              return 0;
+            }
+        }
+    }
+
+  return 1;
+}
+
+/* h1 += h2; histograms filled separately (for example in different
+   threads) can be combined with this function */
+int
+gsl_histogramnd_add (gsl_histogramnd * h1, const gsl_histogramnd * h2)
+{
+  size_t k;
+
+  if (!gsl_histogramnd_equal_bins_p (h1, h2))
+    {
+      GSL_ERROR ("histograms have different binning", GSL_EINVAL);
+    }
+
+  for (k = 0; k < h2->nnz; k++)
+    {
+      size_t pos;
+      int status = histnd_insert (h1, h2->key[k], &pos);
+
+      if (status)
+        return status;
+
+      h1->bin[pos] += h2->bin[k];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_scale (gsl_histogramnd * h, const double scale)
+{
+  size_t k;
+
+  for (k = 0; k < h->nnz; k++)
+    h->bin[k] *= scale;
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,276 @@
+/* histogram/pdfnd.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "hashnd.h"
+
+static int
+histnd_compare_key (const void * a, const void * b)
+{
+  const size_t ka = *(const size_t *) a;
+  const size_t kb = *(const size_t *) b;
+
+  return (ka > kb) - (ka < kb);
+}
+
+gsl_histogramnd_pdf *
+gsl_histogramnd_pdf_alloc (const size_t ndim, const size_t n[])
+{
+  gsl_histogramnd_pdf *p;
+  size_t d;
+
+  if (ndim == 0)
+    {
+      GSL_ERROR_VAL ("histogram pdf dimension must be positive integer",
+                     GSL_EDOM, 0);
+    }
+
+  p = calloc (1, sizeof (gsl_histogramnd_pdf));
+
+  if (p == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogram pdf struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  p->ndim = ndim;
+  p->n = malloc (ndim * sizeof (size_t));
+  p->range = calloc (ndim, sizeof (double *));
+
+  if (p->n == 0 || p->range == 0)
+    {
+      gsl_histogramnd_pdf_free (p);
+      GSL_ERROR_VAL ("failed to allocate space for histogram pdf ranges",
+                     GSL_ENOMEM, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      if (n[d] == 0)
+        {
+          gsl_histogramnd_pdf_free (p);
+          GSL_ERROR_VAL ("histogram pdf lengths must be positive integers",
+                         GSL_EDOM, 0);
+        }
+
+      p->n[d] = n[d];
+      p->range[d] = malloc ((n[d] + 1) * sizeof (double));
+
+      if (p->range[d] == 0)
+        {
+          gsl_histogramnd_pdf_free (p);
+          GSL_ERROR_VAL ("failed to allocate space for histogram pdf ranges",
+                         GSL_ENOMEM, 0);
+        }
+    }
+
+  return p;
+}
+
+void
+gsl_histogramnd_pdf_free (gsl_histogramnd_pdf * p)
+{
+  RETURN_IF_NULL (p);
+
+  if (p->range)
+    {
+      size_t d;
+
+      for (d = 0; d < p->ndim; d++)
+        free (p->range[d]);
+
+      free (p->range);
+    }
+
+  free (p->n);
+  free (p->key);
+  free (p->sum);
+  free (p);
+}
+
+/*
+gsl_histogramnd_pdf_init()
+  Compute the cumulative distribution of the stored bins of h. Only bins
+with positive values are kept, in order of increasing linear index, so
+the result does not depend on the order in which h was filled.
+*/
+
+int
+gsl_histogramnd_pdf_init (gsl_histogramnd_pdf * p, const gsl_histogramnd * h)
+{
+  size_t d, k, m = 0;
+  double total = 0.0;
+
+  if (p->ndim != h->ndim)
+    {
+      GSL_ERROR ("histogram dimension must match pdf dimension", GSL_EINVAL);
+    }
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      if (p->n[d] != h->n[d])
+        {
+          GSL_ERROR ("histogram size must match pdf size", GSL_EINVAL);
+        }
+    }
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      if (h->bin[k] < 0)
+        {
+          GSL_ERROR ("histogram bins must be non-negative to compute"
+                     "a probability distribution", GSL_EDOM);
+        }
+      else if (h->bin[k] > 0)
+        {
+          ++m;
+        }
+    }
+
+  if (m == 0)
+    {
+      GSL_ERROR ("histogram must have a nonzero bin to compute"
+                 "a probability distribution", GSL_EDOM);
+    }
+
+  if (m > p->nalloc)
+    {
+      size_t *key = realloc (p->key, m * sizeof (size_t));
+      double *sum;
+
+      if (key == 0)
+        {
+          GSL_ERROR ("failed to allocate space for pdf keys", GSL_ENOMEM);
+        }
+
+      p->key = key;
+
+      sum = realloc (p->sum, (m + 1) * sizeof (double));
+
+      if (sum == 0)
+        {
+          GSL_ERROR ("failed to allocate space for pdf sums", GSL_ENOMEM);
+        }
+
+      p->sum = sum;
+      p->nalloc = m;
+    }
+
+  for (d = 0; d < h->ndim; d++)
+    memcpy (p->range[d], h->range[d], (h->n[d] + 1) * sizeof (double));
+
+  m = 0;
+  for (k = 0; k < h->nnz; k++)
+    {
+      if (h->bin[k] > 0)
+        p->key[m++] = h->key[k];
+    }
+
+  qsort (p->key, m, sizeof (size_t), histnd_compare_key);
+
+  p->sum[0] = 0.0;
+
+  for (k = 0; k < m; k++)
+    {
+      total += h->bin[histnd_lookup (h, p->key[k])];
+      p->sum[k + 1] = total;
+    }
+
+  for (k = 1; k < m; k++)
+    p->sum[k] /= total;
+
+  p->sum[m] = 1.0;
+  p->nnz = m;
+
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_histogramnd_pdf_sample()
+  Draw a sample from the histogram distribution
+
+Inputs: p - histogram pdf
+        r - ndim uniform random numbers in [0,1]. r[0] selects the bin
+            and the position within it along dimension 0, and r[d] the
+            position within the bin along dimension d.
+        x - (output) sample, length ndim
+*/
+
+int
+gsl_histogramnd_pdf_sample (const gsl_histogramnd_pdf * p,
+                            const double r[], double x[])
+{
+  size_t lo = 0, hi = p->nnz;
+  size_t key, d;
+  double r0 = r[0];
+
+  /* Wrap the exclusive top of the bin down to the inclusive bottom of
+     the bin. Since this is a single point it should not affect the
+     distribution. */
+
+  if (r0 == 1.0)
+    {
+      r0 = 0.0;
+    }
+
+  if (!(r0 >= 0.0 && r0 < 1.0))
+    {
+      GSL_ERROR ("cannot find r in cumulative pdf", GSL_EDOM);
+    }
+
+  /* find k with sum[k] <= r0 < sum[k+1] */
+  while (hi - lo > 1)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (r0 >= p->sum[mid])
+        lo = mid;
+      else
+        hi = mid;
+    }
+
+  key = p->key[lo];
+
+  for (d = p->ndim; d-- > 0; )
+    {
+      const size_t i = key % p->n[d];
+      const double lower = p->range[d][i];
+      const double upper = p->range[d][i + 1];
+      double f;
+
+      if (d == 0)
+        {
+          f = (r0 - p->sum[lo]) / (p->sum[lo + 1] - p->sum[lo]);
+        }
+      else
+        {
+          f = (r[d] == 1.0) ? 0.0 : r[d];
+        }
+
+      x[d] = lower + f * (upper - lower);
+      key /= p->n[d];
+    }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/* histogram/projnd.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "hashnd.h"
+
+/* stride of dimension d in the linear bin index */
+static size_t
+histnd_stride (const gsl_histogramnd * h, const size_t d)
+{
+  size_t stride = 1;
+  size_t e;
+
+  for (e = d + 1; e < h->ndim; e++)
+    stride *= h->n[e];
+
+  return stride;
+}
+
+/*
+gsl_histogramnd_project()
+  Project (marginalize) an N-dimensional histogram onto a subset of its
+dimensions, by summing over all other dimensions
+
+Inputs: h    - histogram
+        dims - dimensions of h to keep, length hp->ndim, distinct
+        hp   - (output) projected histogram, with hp->n[j] = h->n[dims[j]].
+               The ranges of hp are set to those of h.
+*/
+
+int
+gsl_histogramnd_project (const gsl_histogramnd * h, const size_t dims[],
+                         gsl_histogramnd * hp)
+{
+  const size_t m = hp->ndim;
+  size_t *stride;
+  size_t j, k;
+
+  if (m > h->ndim)
+    {
+      GSL_ERROR ("projected histogram has too many dimensions", GSL_EBADLEN);
+    }
+
+  for (j = 0; j < m; j++)
+    {
+      size_t l;
+
+      if (dims[j] >= h->ndim)
+        {
+          GSL_ERROR ("dimension exceeds histogram dimension", GSL_EINVAL);
+        }
+
+      if (hp->n[j] != h->n[dims[j]])
+        {
+          GSL_ERROR ("projected histogram has wrong number of bins", GSL_EBADLEN);
+        }
+
+      for (l = 0; l < j; l++)
+        {
+          if (dims[l] == dims[j])
+            {
+              GSL_ERROR ("projection dimensions must be distinct", GSL_EINVAL);
+            }
+        }
+    }
+
+  stride = malloc (m * sizeof (size_t));
+  if (stride == 0)
+    {
+      GSL_ERROR ("failed to allocate space for strides", GSL_ENOMEM);
+    }
+
+  for (j = 0; j < m; j++)
+    {
+      memcpy (hp->range[j], h->range[dims[j]], (h->n[dims[j]] + 1) * sizeof (double));
+      hp->scale[j] = h->scale[dims[j]];
+      stride[j] = histnd_stride (h, dims[j]);
+    }
+
+  gsl_histogramnd_reset (hp);
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      size_t key = 0, pos;
+      int status;
+
+      for (j = 0; j < m; j++)
+        key = key * hp->n[j] + (h->key[k] / stride[j]) % hp->n[j];
+
+      status = histnd_insert (hp, key, &pos);
+      if (status)
+        {
+          free (stride);
+          return status;
+        }
+
+      hp->bin[pos] += h->bin[k];
+    }
+
+  free (stride);
+
+  return GSL_SUCCESS;
+}
+
+/* project onto dimension d, storing the result in a 1D histogram */
+int
+gsl_histogramnd_project1d (const gsl_histogramnd * h, const size_t d,
+                           gsl_histogram * hp)
+{
+  size_t stride, k;
+
+  if (d >= h->ndim)
+    {
+      GSL_ERROR ("dimension exceeds histogram dimension", GSL_EINVAL);
+    }
+
+  if (hp->n != h->n[d])
+    {
+      GSL_ERROR ("projected histogram has wrong number of bins", GSL_EBADLEN);
+    }
+
+  stride = histnd_stride (h, d);
+
+  memcpy (hp->range, h->range[d], (h->n[d] + 1) * sizeof (double));
+  gsl_histogram_reset (hp);
+
+  for (k = 0; k < h->nnz; k++)
+    hp->bin[(h->key[k] / stride) % h->n[d]] += h->bin[k];
+
+  return GSL_SUCCESS;
+}
+
+/* project onto dimensions d1 (x) and d2 (y), storing the result in a 2D histogram */
+int
+gsl_histogramnd_project2d (const gsl_histogramnd * h, const size_t d1,
+                           const size_t d2, gsl_histogram2d * hp)
+{
+  size_t stride1, stride2, k;
+
+  if (d1 >= h->ndim || d2 >= h->ndim)
+    {
+      GSL_ERROR ("dimension exceeds histogram dimension", GSL_EINVAL);
+    }
+
+  if (d1 == d2)
+    {
+      GSL_ERROR ("projection dimensions must be distinct", GSL_EINVAL);
+    }
+
+  if (hp->nx != h->n[d1] || hp->ny != h->n[d2])
+    {
+      GSL_ERROR ("projected histogram has wrong number of bins", GSL_EBADLEN);
+    }
+
+  stride1 = histnd_stride (h, d1);
+  stride2 = histnd_stride (h, d2);
+
+  memcpy (hp->xrange, h->range[d1], (h->n[d1] + 1) * sizeof (double));
+  memcpy (hp->yrange, h->range[d2], (h->n[d2] + 1) * sizeof (double));
+  gsl_histogram2d_reset (hp);
+
+  for (k = 0; k < h->nnz; k++)
+    {
+      size_t i = (h->key[k] / stride1) % hp->nx;
+      size_t j = (h->key[k] / stride2) % hp->ny;
+
+      hp->bin[i * hp->ny + j] += h->bin[k];
+    }
+
+  return GSL_SUCCESS;
+}
@@ -30,6 +30,10 @@ void test1d_resample (void);
 void test2d_resample (void);
 void test1d_trap (void);
 void test2d_trap (void);
+void test1d_array (void);
+void test2d_array (void);
+void testnd (void);
+void testauto (void);
 
 int
 main (void)
@@ -40,6 +44,10 @@ main (void)
   test2d_resample();
   test1d_trap();
   test2d_trap();
+  test1d_array();
+  test2d_array();
+  testnd();
+  testauto();
   
   exit (gsl_test_summary ());
 }
@@ -0,0 +1,137 @@
+/* histogram/test1d_array.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define NB 37
+#define M 5000
+
+/* compare gsl_histogram_{increment,accumulate}_array with repeated calls
+   to gsl_histogram_{increment,accumulate} */
+static void
+test1d_array_proc (gsl_histogram * h1, gsl_histogram * h2, const char * desc)
+{
+  double x[2 * M], w[M];
+  int status1 = GSL_SUCCESS, status2;
+  size_t i;
+
+  /* data in strided array, with 10% of points outside the range */
+  for (i = 0; i < M; i++)
+    {
+      const double xmin = h1->range[0];
+      const double xmax = h1->range[h1->n];
+      double u = urand ();
+
+      x[2 * i] = xmin + (1.2 * u - 0.1) * (xmax - xmin);
+      x[2 * i + 1] = GSL_NAN;
+      w[i] = urand () - 0.5;
+    }
+
+  /* put some points exactly on bin edges and on the end points */
+  for (i = 0; i <= h1->n; i++)
+    x[2 * i] = h1->range[i];
+
+  gsl_histogram_reset (h1);
+  gsl_histogram_reset (h2);
+
+  for (i = 0; i < M; i++)
+    {
+      if (gsl_histogram_increment (h1, x[2 * i]))
+        status1 = GSL_EDOM;
+    }
+
+  status2 = gsl_histogram_increment_array (h2, x, 2, M);
+
+  gsl_test_int (status2, status1, "gsl_histogram_increment_array %s status", desc);
+  gsl_test (!gsl_histogram_equal_bins_p (h1, h2), "gsl_histogram_increment_array %s bins", desc);
+
+  for (i = 0; i < h1->n; i++)
+    {
+      gsl_test_abs (h2->bin[i], h1->bin[i], 0.0,
+                    "gsl_histogram_increment_array %s bin %zu", desc, i);
+    }
+
+  gsl_histogram_reset (h1);
+  gsl_histogram_reset (h2);
+
+  for (i = 0; i < M; i++)
+    gsl_histogram_accumulate (h1, x[2 * i], w[i]);
+
+  gsl_histogram_accumulate_array (h2, x, 2, w, 1, M);
+
+  for (i = 0; i < h1->n; i++)
+    {
+      gsl_test_abs (h2->bin[i], h1->bin[i], 0.0,
+                    "gsl_histogram_accumulate_array %s bin %zu", desc, i);
+    }
+
+  /* NaNs are ignored */
+  status2 = gsl_histogram_accumulate_array (h2, x + 1, 2, w, 1, M);
+  gsl_test_int (status2, GSL_EDOM, "gsl_histogram_accumulate_array %s NaN status", desc);
+
+  for (i = 0; i < h1->n; i++)
+    {
+      gsl_test_abs (h2->bin[i], h1->bin[i], 0.0,
+                    "gsl_histogram_accumulate_array %s NaN bin %zu", desc, i);
+    }
+}
+
+void
+test1d_array (void)
+{
+  gsl_histogram *h1, *h2;
+  size_t i;
+
+  gsl_ieee_env_setup ();
+
+  h1 = gsl_histogram_calloc_uniform (NB, -1.3, 2.7);
+  h2 = gsl_histogram_calloc_uniform (NB, -1.3, 2.7);
+  test1d_array_proc (h1, h2, "uniform");
+  gsl_histogram_free (h1);
+  gsl_histogram_free (h2);
+
+  h1 = gsl_histogram_calloc (NB);
+  h2 = gsl_histogram_calloc (NB);
+
+  for (i = 0; i <= NB; i++)
+    {
+      double u = (double) i / NB;
+      h1->range[i] = u * u * u;
+      h2->range[i] = u * u * u;
+    }
+
+  test1d_array_proc (h1, h2, "nonuniform");
+  gsl_histogram_free (h1);
+  gsl_histogram_free (h2);
+
+  h1 = gsl_histogram_calloc (1);
+  h2 = gsl_histogram_calloc (1);
+  test1d_array_proc (h1, h2, "single bin");
+  gsl_histogram_free (h1);
+  gsl_histogram_free (h2);
+}
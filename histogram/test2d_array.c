@@ -0,0 +1,126 @@
+/* histogram/test2d_array.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram2d.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define NX 13
+#define NY 29
+#define M 5000
+
+/* compare gsl_histogram2d_{increment,accumulate}_array with repeated
+   calls to gsl_histogram2d_{increment,accumulate} */
+static void
+test2d_array_proc (gsl_histogram2d * h1, gsl_histogram2d * h2, const char * desc)
+{
+  double x[M], y[3 * M], w[M];
+  int status1 = GSL_SUCCESS, status2;
+  size_t i, j;
+
+  for (i = 0; i < M; i++)
+    {
+      const double xmin = h1->xrange[0], xmax = h1->xrange[h1->nx];
+      const double ymin = h1->yrange[0], ymax = h1->yrange[h1->ny];
+      double u = urand ();
+      double v = urand ();
+
+      x[i] = xmin + (1.2 * u - 0.1) * (xmax - xmin);
+      y[3 * i] = ymin + (1.2 * v - 0.1) * (ymax - ymin);
+      y[3 * i + 1] = 0.0;
+      y[3 * i + 2] = 0.0;
+      w[i] = urand () - 0.5;
+    }
+
+  gsl_histogram2d_reset (h1);
+  gsl_histogram2d_reset (h2);
+
+  for (i = 0; i < M; i++)
+    {
+      if (gsl_histogram2d_increment (h1, x[i], y[3 * i]))
+        status1 = GSL_EDOM;
+    }
+
+  status2 = gsl_histogram2d_increment_array (h2, x, 1, y, 3, M);
+
+  gsl_test_int (status2, status1, "gsl_histogram2d_increment_array %s status", desc);
+
+  for (i = 0; i < h1->nx; i++)
+    for (j = 0; j < h1->ny; j++)
+      {
+        gsl_test_abs (gsl_histogram2d_get (h2, i, j), gsl_histogram2d_get (h1, i, j), 0.0,
+                      "gsl_histogram2d_increment_array %s bin (%zu,%zu)", desc, i, j);
+      }
+
+  gsl_histogram2d_reset (h1);
+  gsl_histogram2d_reset (h2);
+
+  for (i = 0; i < M; i++)
+    gsl_histogram2d_accumulate (h1, x[i], y[3 * i], w[i]);
+
+  gsl_histogram2d_accumulate_array (h2, x, 1, y, 3, w, 1, M);
+
+  for (i = 0; i < h1->nx; i++)
+    for (j = 0; j < h1->ny; j++)
+      {
+        gsl_test_abs (gsl_histogram2d_get (h2, i, j), gsl_histogram2d_get (h1, i, j), 0.0,
+                      "gsl_histogram2d_accumulate_array %s bin (%zu,%zu)", desc, i, j);
+      }
+}
+
+void
+test2d_array (void)
+{
+  gsl_histogram2d *h1, *h2;
+  size_t i;
+
+  gsl_ieee_env_setup ();
+
+  h1 = gsl_histogram2d_calloc_uniform (NX, NY, -1.3, 2.7, 10.0, 20.0);
+  h2 = gsl_histogram2d_calloc_uniform (NX, NY, -1.3, 2.7, 10.0, 20.0);
+  test2d_array_proc (h1, h2, "uniform");
+  gsl_histogram2d_free (h1);
+  gsl_histogram2d_free (h2);
+
+  h1 = gsl_histogram2d_calloc (NX, NY);
+  h2 = gsl_histogram2d_calloc (NX, NY);
+
+  for (i = 0; i <= NX; i++)
+    {
+      double u = (double) i / NX;
+      h1->xrange[i] = h2->xrange[i] = u * u;
+    }
+
+  for (i = 0; i <= NY; i++)
+    {
+      double u = (double) i / NY;
+      h1->yrange[i] = h2->yrange[i] = sqrt (u);
+    }
+
+  test2d_array_proc (h1, h2, "nonuniform");
+  gsl_histogram2d_free (h1);
+  gsl_histogram2d_free (h2);
+}
@@ -0,0 +1,225 @@
+/* histogram/testauto.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogram.h>
+#include <gsl/gsl_histogram_auto.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define N 5000
+#define NBINS 64
+
+/* compare h against a fixed range histogram with the same bins filled
+   directly from the data */
+static void
+testauto_compare (const gsl_histogram_auto * h, const double x[],
+                  const size_t n, const char * desc)
+{
+  gsl_histogram *hh = gsl_histogram_alloc (h->n);
+  gsl_histogram *href = gsl_histogram_alloc (h->n);
+  size_t i;
+  double lo = gsl_histogram_auto_min (h);
+  double hi = gsl_histogram_auto_max (h);
+
+  gsl_histogram_auto_copy (hh, h);
+  gsl_histogram_set_ranges (href, hh->range, hh->n + 1);
+
+  gsl_test_rel (gsl_histogram_min (hh), lo, 1.0e-15, "%s min", desc);
+  gsl_test_rel (gsl_histogram_max (hh), hi, 1.0e-15, "%s max", desc);
+
+  for (i = 0; i < n; i++)
+    {
+      if (gsl_finite (x[i]))
+        {
+          int status = gsl_histogram_increment (href, x[i]);
+          gsl_test (status, "%s x[%zu] = %g outside range [%g,%g)",
+                    desc, i, x[i], lo, hi);
+        }
+    }
+
+  for (i = 0; i < h->n; i++)
+    {
+      gsl_test_abs (gsl_histogram_auto_get (h, i), gsl_histogram_get (href, i),
+                    0.0, "%s bin %zu", desc, i);
+    }
+
+  /* bin edges lie on the grid of the initial width */
+  {
+    double m = lo / h->width;
+    double k = log2 (h->width / h->width0);
+
+    gsl_test (m != floor (m), "%s min on grid", desc);
+    gsl_test (k != floor (k), "%s width power of 2", desc);
+  }
+
+  gsl_histogram_free (hh);
+  gsl_histogram_free (href);
+}
+
+void
+testauto (void)
+{
+  double *x = malloc (N * sizeof (double));
+  gsl_histogram_auto *h = gsl_histogram_auto_alloc (NBINS, 0.125);
+  gsl_histogram_auto *h1 = gsl_histogram_auto_alloc (NBINS, 0.125);
+  gsl_histogram_auto *h2 = gsl_histogram_auto_alloc (NBINS, 0.125);
+  gsl_histogram_auto *h3 = gsl_histogram_auto_alloc (NBINS, 0.125);
+  size_t i;
+  int status;
+
+  gsl_ieee_env_setup ();
+
+  for (i = 0; i < N; i++)
+    {
+      x[i] = 20.0 * (urand () + urand () + urand ()) - 17.0;
+
+      if (i % 1000 == 999)
+        x[i] = -400.0 - 100.0 * (double) (i / 1000) - urand ();
+    }
+
+  x[110] = GSL_NAN;
+  x[120] = GSL_POSINF;
+
+  /* small initial range which must grow */
+  for (i = 0; i < 100; i++)
+    gsl_histogram_auto_increment (h, x[i]);
+
+  testauto_compare (h, x, 100, "gsl_histogram_auto_increment n=100");
+
+  status = gsl_histogram_auto_increment_array (h, x + 100, 1, N - 100);
+  gsl_test_int (status, GSL_EDOM, "gsl_histogram_auto_increment_array status");
+  gsl_test_int (h->nsamples, N - 2, "gsl_histogram_auto nsamples");
+  gsl_test_rel (gsl_histogram_auto_sum (h), N - 2.0, 1.0e-15,
+                "gsl_histogram_auto_sum");
+
+  for (i = 0; i < N; i++)
+    {
+      if (gsl_finite (x[i]))
+        gsl_test (x[i] < gsl_histogram_auto_min (h) || x[i] >= gsl_histogram_auto_max (h),
+                  "gsl_histogram_auto range x[%zu]", i);
+    }
+
+  testauto_compare (h, x, N, "gsl_histogram_auto_increment_array");
+
+  /* merge of separately filled parts; h2 and h3 hold the outliers only */
+  for (i = 0; i < N; i++)
+    {
+      if (i % 1000 == 999)
+        gsl_histogram_auto_increment (h3, x[i]);
+      else if (i < N / 2)
+        gsl_histogram_auto_increment (h1, x[i]);
+      else
+        gsl_histogram_auto_increment (h2, x[i]);
+    }
+
+  gsl_histogram_auto_add (h1, h2);
+  gsl_histogram_auto_reset (h2);
+
+  for (i = 999; i < N; i += 1000)
+    gsl_histogram_auto_increment (h2, x[i]);
+
+  gsl_test (h3->width <= h1->width, "gsl_histogram_auto coarse part");
+
+  /* finer into coarser */
+  gsl_histogram_auto_add (h3, h1);
+  testauto_compare (h3, x, N, "gsl_histogram_auto_add fine");
+  gsl_test_rel (gsl_histogram_auto_sum (h3), N - 2.0, 1.0e-15,
+                "gsl_histogram_auto_add sum");
+
+  /* coarser into finer */
+  gsl_histogram_auto_add (h1, h2);
+  testauto_compare (h1, x, N, "gsl_histogram_auto_add coarse");
+
+  /* add into empty histogram */
+  gsl_histogram_auto_reset (h1);
+  gsl_histogram_auto_add (h1, h3);
+  testauto_compare (h1, x, N, "gsl_histogram_auto_add empty");
+
+  /* weighted fill with a value needing many doublings */
+  {
+    double y[3] = { 1.0, 1.0e15, -3.0e14 };
+    double w[3] = { 0.5, 2.0, 4.0 };
+    size_t k;
+
+    gsl_histogram_auto_reset (h);
+    gsl_histogram_auto_accumulate_array (h, y, 1, w, 1, 3);
+
+    for (k = 0; k < 3; k++)
+      {
+        size_t idx;
+        status = gsl_histogram_auto_find (h, y[k], &idx);
+        gsl_test (status, "gsl_histogram_auto_find y[%zu]", k);
+        gsl_test (gsl_histogram_auto_get (h, idx) < w[k],
+                  "gsl_histogram_auto_accumulate y[%zu]", k);
+      }
+
+    gsl_test_rel (gsl_histogram_auto_sum (h), 6.5, 1.0e-15,
+                  "gsl_histogram_auto_accumulate sum");
+  }
+
+  /* incompatible grids */
+  {
+    gsl_histogram_auto *h4 = gsl_histogram_auto_alloc (NBINS, 0.1);
+    gsl_error_handler_t *old = gsl_set_error_handler_off ();
+
+    gsl_histogram_auto_increment (h4, 1.0);
+    status = gsl_histogram_auto_add (h1, h4);
+    gsl_test_int (status, GSL_EINVAL, "gsl_histogram_auto_add incompatible");
+
+    gsl_set_error_handler (old);
+    gsl_histogram_auto_free (h4);
+  }
+
+  /* a single bin is rejected; two bins extend to negative samples */
+  {
+    gsl_error_handler_t *old = gsl_set_error_handler_off ();
+    gsl_histogram_auto *h5 = gsl_histogram_auto_alloc (1, 1.0);
+
+    gsl_test (h5 != NULL, "gsl_histogram_auto_alloc n=1");
+    gsl_set_error_handler (old);
+
+    h5 = gsl_histogram_auto_alloc (2, 1.0);
+    gsl_histogram_auto_increment (h5, 0.5);
+    status = gsl_histogram_auto_increment (h5, -3.0);
+    status |= gsl_histogram_auto_increment (h5, -100.0);
+
+    gsl_test (status || !(gsl_histogram_auto_min (h5) <= -100.0)
+              || !(gsl_histogram_auto_max (h5) > 0.5)
+              || !gsl_finite (gsl_histogram_auto_width (h5)),
+              "gsl_histogram_auto n=2 negative samples");
+    gsl_test_rel (gsl_histogram_auto_sum (h5), 3.0, 1.0e-15,
+                  "gsl_histogram_auto n=2 sum");
+
+    gsl_histogram_auto_free (h5);
+  }
+
+  gsl_histogram_auto_free (h);
+  gsl_histogram_auto_free (h1);
+  gsl_histogram_auto_free (h2);
+  gsl_histogram_auto_free (h3);
+  free (x);
+}
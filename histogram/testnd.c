@@ -0,0 +1,302 @@
+/* histogram/testnd.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+
+#include "urand.c"
+
+#define NPTS 2000
+#define TDA 4
+
+/* brute force search for bin of x in range[0..n] */
+static int
+testnd_find (const size_t n, const double range[], const double x, size_t * i)
+{
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      if (x >= range[k] && x < range[k + 1])
+        {
+          *i = k;
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+/* 3D histogram compared with a dense reference */
+static void
+testnd_dense (void)
+{
+  const size_t n[3] = { 4, 5, 6 };
+  const size_t N = 4 * 5 * 6;
+  const double r1[6] = { -2.0, -1.0, -0.5, 0.0, 0.25, 3.0 };
+  const size_t dims[2] = { 2, 0 };
+  double *x = malloc (NPTS * TDA * sizeof (double));
+  double *w = malloc (NPTS * sizeof (double));
+  double *ref = calloc (N, sizeof (double));
+  gsl_histogramnd *h1 = gsl_histogramnd_alloc (3, n);
+  gsl_histogramnd *h2 = gsl_histogramnd_alloc (3, n);
+  gsl_histogramnd *h3 = gsl_histogramnd_alloc (3, n);
+  gsl_histogramnd *hp = gsl_histogramnd_alloc (2, (size_t[]) { 6, 4 });
+  gsl_histogram *p1 = gsl_histogram_alloc (5);
+  gsl_histogram2d *p2 = gsl_histogram2d_alloc (4, 6);
+  size_t i, j, k, idx[3];
+  double sum = 0.0;
+  int status;
+
+  gsl_histogramnd_set_ranges_uniform (h1, 0, 0.0, 1.0);
+  gsl_histogramnd_set_ranges (h1, 1, r1, 6);
+  gsl_histogramnd_set_ranges_uniform (h2, 0, 0.0, 1.0);
+  gsl_histogramnd_set_ranges (h2, 1, r1, 6);
+  gsl_histogramnd_set_ranges_uniform (h3, 0, 0.0, 1.0);
+  gsl_histogramnd_set_ranges (h3, 1, r1, 6);
+
+  for (i = 0; i < NPTS; i++)
+    {
+      x[i * TDA] = 1.1 * urand () - 0.05;
+      x[i * TDA + 1] = 5.2 * urand () - 2.1;
+      x[i * TDA + 2] = 6.0 * urand ();
+      x[i * TDA + 3] = GSL_NAN;
+      w[i] = urand ();
+
+      if (testnd_find (4, h1->range[0], x[i * TDA], &idx[0]) == 0 &&
+          testnd_find (5, h1->range[1], x[i * TDA + 1], &idx[1]) == 0 &&
+          testnd_find (6, h1->range[2], x[i * TDA + 2], &idx[2]) == 0)
+        {
+          ref[(idx[0] * 5 + idx[1]) * 6 + idx[2]] += w[i];
+          sum += w[i];
+        }
+    }
+
+  for (i = 0; i < NPTS; i++)
+    gsl_histogramnd_accumulate (h1, x + i * TDA, w[i]);
+
+  status = gsl_histogramnd_accumulate_array (h2, x, TDA, w, 1, NPTS);
+  gsl_test_int (status, GSL_EDOM, "gsl_histogramnd_accumulate_array status");
+
+  /* fill h3 in two halves, starting with the second half in h1 */
+  gsl_histogramnd_accumulate_array (h3, x, TDA, w, 1, NPTS / 2);
+
+  for (i = 0; i < n[0]; i++)
+    for (j = 0; j < n[1]; j++)
+      for (k = 0; k < n[2]; k++)
+        {
+          double r = ref[(i * 5 + j) * 6 + k];
+          idx[0] = i; idx[1] = j; idx[2] = k;
+          gsl_test_rel (gsl_histogramnd_get (h1, idx), r, 1.0e-12,
+                        "gsl_histogramnd_accumulate (%zu,%zu,%zu)", i, j, k);
+          gsl_test_rel (gsl_histogramnd_get (h2, idx), r, 1.0e-12,
+                        "gsl_histogramnd_accumulate_array (%zu,%zu,%zu)", i, j, k);
+        }
+
+  gsl_test_rel (gsl_histogramnd_sum (h2), sum, 1.0e-12, "gsl_histogramnd_sum");
+  gsl_test (gsl_histogramnd_nnz (h2) > N, "gsl_histogramnd_nnz");
+
+  /* stored bins */
+  for (k = 0; k < gsl_histogramnd_nnz (h2); k++)
+    {
+      double val;
+      gsl_histogramnd_get_stored (h2, k, idx, &val);
+      gsl_test_rel (val, ref[(idx[0] * 5 + idx[1]) * 6 + idx[2]], 1.0e-12,
+                    "gsl_histogramnd_get_stored k=%zu", k);
+    }
+
+  /* find */
+  {
+    double y[3] = { 0.3, 0.1, 5.5 };
+    gsl_histogramnd_find (h2, y, idx);
+    gsl_test (idx[0] != 1 || idx[1] != 3 || idx[2] != 5, "gsl_histogramnd_find");
+  }
+
+  /* add */
+  {
+    gsl_histogramnd *h4 = gsl_histogramnd_alloc (3, n);
+
+    gsl_histogramnd_set_ranges_uniform (h4, 0, 0.0, 1.0);
+    gsl_histogramnd_set_ranges (h4, 1, r1, 6);
+    gsl_histogramnd_accumulate_array (h4, x + (NPTS / 2) * TDA, TDA, w + NPTS / 2, 1, NPTS - NPTS / 2);
+    gsl_histogramnd_add (h3, h4);
+
+    for (k = 0; k < h2->nnz; k++)
+      {
+        gsl_histogramnd_get_stored (h2, k, idx, &sum);
+        gsl_test_rel (gsl_histogramnd_get (h3, idx), sum, 1.0e-12,
+                      "gsl_histogramnd_add k=%zu", k);
+      }
+
+    gsl_test_int (gsl_histogramnd_nnz (h3), gsl_histogramnd_nnz (h2),
+                  "gsl_histogramnd_add nnz");
+
+    gsl_histogramnd_free (h4);
+  }
+
+  /* projections */
+  gsl_histogramnd_project1d (h2, 1, p1);
+  for (j = 0; j < n[1]; j++)
+    {
+      double s = 0.0;
+
+      for (i = 0; i < n[0]; i++)
+        for (k = 0; k < n[2]; k++)
+          s += ref[(i * 5 + j) * 6 + k];
+
+      gsl_test_rel (gsl_histogram_get (p1, j), s, 1.0e-12,
+                    "gsl_histogramnd_project1d j=%zu", j);
+      gsl_test (p1->range[j] != r1[j], "gsl_histogramnd_project1d range j=%zu", j);
+    }
+
+  gsl_histogramnd_project2d (h2, 0, 2, p2);
+  gsl_histogramnd_project (h2, dims, hp);
+
+  for (i = 0; i < n[0]; i++)
+    for (k = 0; k < n[2]; k++)
+      {
+        size_t pidx[2];
+        double s = 0.0;
+
+        for (j = 0; j < n[1]; j++)
+          s += ref[(i * 5 + j) * 6 + k];
+
+        gsl_test_rel (gsl_histogram2d_get (p2, i, k), s, 1.0e-12,
+                      "gsl_histogramnd_project2d (%zu,%zu)", i, k);
+
+        pidx[0] = k;
+        pidx[1] = i;
+        gsl_test_rel (gsl_histogramnd_get (hp, pidx), s, 1.0e-12,
+                      "gsl_histogramnd_project (%zu,%zu)", k, i);
+      }
+
+  /* pdf: bins selected by midpoint of cumulative intervals */
+  {
+    gsl_histogramnd_pdf *p = gsl_histogramnd_pdf_alloc (3, n);
+    double total = gsl_histogramnd_sum (h2);
+    double r[3], y[3], last = 0.0;
+
+    gsl_histogramnd_pdf_init (p, h2);
+
+    gsl_test_int (p->nnz, h2->nnz, "gsl_histogramnd_pdf_init nnz");
+
+    for (k = 0; k < p->nnz; k++)
+      {
+        size_t pidx[3];
+
+        gsl_test (p->key[k] < last && k > 0, "gsl_histogramnd_pdf_init sorted k=%zu", k);
+        last = p->key[k];
+
+        r[0] = 0.5 * (p->sum[k] + p->sum[k + 1]);
+        r[1] = 0.25;
+        r[2] = 0.75;
+        gsl_histogramnd_pdf_sample (p, r, y);
+
+        for (j = 0; j < 3; j++)
+          testnd_find (n[j], h2->range[j], y[j], &pidx[j]);
+
+        gsl_test_rel (p->sum[k + 1] - p->sum[k], gsl_histogramnd_get (h2, pidx) / total, 1.0e-10,
+                      "gsl_histogramnd_pdf_sample k=%zu", k);
+
+        gsl_test_rel (y[2], h2->range[2][pidx[2]] + 0.75, 1.0e-12,
+                      "gsl_histogramnd_pdf_sample position k=%zu", k);
+      }
+
+    gsl_histogramnd_pdf_free (p);
+  }
+
+  gsl_histogramnd_free (h1);
+  gsl_histogramnd_free (h2);
+  gsl_histogramnd_free (h3);
+  gsl_histogramnd_free (hp);
+  gsl_histogram_free (p1);
+  gsl_histogram2d_free (p2);
+  free (x);
+  free (w);
+  free (ref);
+}
+
+/* 6D histogram with 64^6 bins, almost all empty */
+static void
+testnd_sparse (void)
+{
+  const size_t n[6] = { 64, 64, 64, 64, 64, 64 };
+  gsl_histogramnd *h = gsl_histogramnd_alloc (6, n);
+  double *x = malloc (NPTS * 6 * sizeof (double));
+  size_t i, d, idx[6];
+
+  for (d = 0; d < 6; d++)
+    gsl_histogramnd_set_ranges_uniform (h, d, -1.0, 1.0);
+
+  for (i = 0; i < NPTS; i++)
+    {
+      /* points are concentrated on a curve */
+      double t = urand ();
+
+      for (d = 0; d < 6; d++)
+        x[i * 6 + d] = sin ((d + 1.0) * t);
+    }
+
+  gsl_histogramnd_increment_array (h, x, 6, NPTS);
+
+  gsl_test (gsl_histogramnd_nnz (h) > NPTS, "gsl_histogramnd sparse nnz");
+  gsl_test_rel (gsl_histogramnd_sum (h), (double) NPTS, 1.0e-12, "gsl_histogramnd sparse sum");
+
+  for (i = 0; i < NPTS; i += 97)
+    {
+      size_t count = 0, l;
+
+      gsl_histogramnd_find (h, x + i * 6, idx);
+
+      for (l = 0; l < NPTS; l++)
+        {
+          size_t jdx[6];
+          gsl_histogramnd_find (h, x + l * 6, jdx);
+          if (memcmp (idx, jdx, sizeof (idx)) == 0)
+            ++count;
+        }
+
+      gsl_test_rel (gsl_histogramnd_get (h, idx), (double) count, 1.0e-12,
+                    "gsl_histogramnd sparse get i=%zu", i);
+    }
+
+  gsl_histogramnd_reset (h);
+  gsl_test_int (gsl_histogramnd_nnz (h), 0, "gsl_histogramnd_reset");
+  gsl_test_rel (gsl_histogramnd_get (h, idx), 0.0, 1.0e-12, "gsl_histogramnd_reset get");
+
+  gsl_histogramnd_free (h);
+  free (x);
+}
+
+void
+testnd (void)
+{
+  gsl_ieee_env_setup ();
+
+  testnd_dense ();
+  testnd_sparse ();
+}
@@ -184,14 +184,53 @@ downdate (double *c, int n, int d, int *nans, int nnans)
 }
 
 
-/* The actual integration routine.
+/* Evaluates fx[i] = f(m + xi[i] * h) for i = start, start + stride,
+    ..., end, either one point at a time with f or all points at once
+    with fa. Returns the number of points.
     */
 
-int
-gsl_integration_cquad (const gsl_function * f, double a, double b,
-		       double epsabs, double epsrel,
-		       gsl_integration_cquad_workspace * ws,
-		       double *result, double *abserr, size_t * nevals)
+static int
+cquad_eval (const gsl_function * f, const gsl_function_array * fa,
+	    const double m, const double h, double *fx,
+	    const int start, const int end, const int stride)
+{
+  int i, k = 0;
+
+  if (fa != NULL)
+    {
+      double x[33], y[33];
+
+      for (i = start; i <= end; i += stride)
+	x[k++] = m + xi[i] * h;
+
+      GSL_FN_ARRAY_EVAL (fa, x, y, (size_t) k);
+
+      k = 0;
+      for (i = start; i <= end; i += stride)
+	fx[i] = y[k++];
+    }
+  else
+    {
+      for (i = start; i <= end; i += stride)
+	{
+	  fx[i] = GSL_FN_EVAL (f, m + xi[i] * h);
+	  k++;
+	}
+    }
+
+  return k;
+}
+
+
+/* The actual integration routine, for an integrand given either as f
+    or as fa.
+    */
+
+static int
+cquad (const gsl_function * f, const gsl_function_array * fa,
+       double a, double b, double epsabs, double epsrel,
+       gsl_integration_cquad_workspace * ws,
+       double *result, double *abserr, size_t * nevals)
 {
 
   /* Some constants that we will need. */
@@ -211,7 +250,7 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
   double nc, ncdiff;
 
   /* Check the input arguments. */
-  if (f == NULL)
+  if (f == NULL && fa == NULL)
     GSL_ERROR ("function pointer shouldn't be NULL", GSL_EINVAL);
   if (result == NULL)
     GSL_ERROR ("result pointer shouldn't be NULL", GSL_EINVAL);
@@ -231,10 +270,9 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
   m = (a + b) / 2;
   h = (b - a) / 2;
   nnans = 0;
+  neval += cquad_eval (f, fa, m, h, iv->fx, 0, n[3], 1);
   for (i = 0; i <= n[3]; i++)
     {
-      iv->fx[i] = GSL_FN_EVAL (f, m + xi[i] * h);
-      neval++;
       if (!gsl_finite (iv->fx[i]))
 	{
 	  nans[nnans++] = i;
@@ -311,11 +349,7 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 	  d = ++iv->depth;
 
 	  /* Get the new (missing) function values */
-	  for (i = skip[d]; i <= 32; i += 2 * skip[d])
-	    {
-	      iv->fx[i] = GSL_FN_EVAL (f, m + xi[i] * h);
-	      neval++;
-	    }
+	  neval += cquad_eval (f, fa, m, h, iv->fx, skip[d], 32, 2 * skip[d]);
 	  nnans = 0;
 	  for (i = 0; i <= 32; i += skip[d])
 	    {
@@ -435,12 +469,8 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 	  ivl->rdepth = iv->rdepth + 1;
 	  ivl->fx[0] = iv->fx[0];
 	  ivl->fx[32] = iv->fx[16];
-	  for (i = skip[0]; i < 32; i += skip[0])
-	    {
-	      ivl->fx[i] =
-		GSL_FN_EVAL (f, (ivl->a + ivl->b) / 2 + xi[i] * h / 2);
-	      neval++;
-	    }
+	  neval += cquad_eval (f, fa, (ivl->a + ivl->b) / 2, h / 2, ivl->fx,
+			       skip[0], 32 - skip[0], skip[0]);
 	  nnans = 0;
 	  for (i = 0; i <= 32; i += skip[0])
 	    {
@@ -501,12 +531,8 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 	  ivr->rdepth = iv->rdepth + 1;
 	  ivr->fx[0] = iv->fx[16];
 	  ivr->fx[32] = iv->fx[32];
-	  for (i = skip[0]; i < 32; i += skip[0])
-	    {
-	      ivr->fx[i] =
-		GSL_FN_EVAL (f, (ivr->a + ivr->b) / 2 + xi[i] * h / 2);
-	      neval++;
-	    }
+	  neval += cquad_eval (f, fa, (ivr->a + ivr->b) / 2, h / 2, ivr->fx,
+			       skip[0], 32 - skip[0], skip[0]);
 	  nnans = 0;
 	  for (i = 0; i <= 32; i += skip[0])
 	    {
@@ -681,3 +707,27 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
   return GSL_SUCCESS;
 
 }
+
+
+int
+gsl_integration_cquad (const gsl_function * f, double a, double b,
+		       double epsabs, double epsrel,
+		       gsl_integration_cquad_workspace * ws,
+		       double *result, double *abserr, size_t * nevals)
+{
+  return cquad (f, NULL, a, b, epsabs, epsrel, ws, result, abserr, nevals);
+}
+
+
+/* Same as gsl_integration_cquad, but all new nodes of an interval are
+    passed to f in one call.
+    */
+
+int
+gsl_integration_cquad_array (const gsl_function_array * f, double a,
+			     double b, double epsabs, double epsrel,
+			     gsl_integration_cquad_workspace * ws,
+			     double *result, double *abserr, size_t * nevals)
+{
+  return cquad (NULL, f, a, b, epsabs, epsrel, ws, result, abserr, nevals);
+}
@@ -148,6 +148,56 @@ void gsl_integration_qk61 (const gsl_function * f, double a, double b,
                            double *result, double *abserr,
                            double *resabs, double *resasc);
 
+/* Definition of an integrand evaluated at all nodes of a rule at
+   once, y[i] = f(x[i]) for i = 0, ..., n-1 */
+
+struct gsl_function_array_struct
+{
+  void (* function) (const double x[], double y[], size_t n, void * params);
+  void * params;
+};
+
+typedef struct gsl_function_array_struct gsl_function_array;
+
+#define GSL_FN_ARRAY_EVAL(F,x,y,n) (*((F)->function))(x,y,n,(F)->params)
+
+/* Integration rules applied to all of their nodes at once */
+
+typedef void gsl_integration_rule_array (const gsl_function_array * f,
+                                         double a, double b,
+                                         double *result, double *abserr,
+                                         double *defabs, double *resabs);
+
+void gsl_integration_qk15_array (const gsl_function_array * f,
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk21_array (const gsl_function_array * f,
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk31_array (const gsl_function_array * f,
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk41_array (const gsl_function_array * f,
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk51_array (const gsl_function_array * f,
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
+void gsl_integration_qk61_array (const gsl_function_array * f,
+                                 double a, double b,
+                                 double *result, double *abserr,
+                                 double *resabs, double *resasc);
+
 void gsl_integration_qcheb (gsl_function * f, double a, double b, 
                             double *cheb12, double *cheb24);
 
@@ -172,6 +222,14 @@ gsl_integration_qk (const int n, const double xgk[],
                     double * result, double * abserr, 
                     double * resabs, double * resasc);
 
+void 
+gsl_integration_qk_array (const int n, const double xgk[], 
+                          const double wg[], const double wgk[],
+                          double x[], double fx[],
+                          const gsl_function_array *f, double a, double b,
+                          double * result, double * abserr, 
+                          double * resabs, double * resasc);
+
 
 int gsl_integration_qng (const gsl_function * f,
                          double a, double b,
@@ -186,6 +244,13 @@ int gsl_integration_qag (const gsl_function * f,
                          gsl_integration_workspace * workspace,
                          double *result, double *abserr);
 
+int gsl_integration_qag_array (const gsl_function_array * f,
+                               double a, double b,
+                               double epsabs, double epsrel, size_t limit,
+                               int key,
+                               gsl_integration_workspace * workspace,
+                               double *result, double *abserr);
+
 int gsl_integration_qagi (gsl_function * f,
                           double epsabs, double epsrel, size_t limit,
                           gsl_integration_workspace * workspace,
@@ -210,12 +275,24 @@ int gsl_integration_qags (const gsl_function * f,
                           gsl_integration_workspace * workspace,
                           double *result, double *abserr);
 
+int gsl_integration_qags_array (const gsl_function_array * f,
+                                double a, double b,
+                                double epsabs, double epsrel, size_t limit,
+                                gsl_integration_workspace * workspace,
+                                double *result, double *abserr);
+
 int gsl_integration_qagp (const gsl_function * f,
                           double *pts, size_t npts,
                           double epsabs, double epsrel, size_t limit,
                           gsl_integration_workspace * workspace,
                           double *result, double *abserr);
 
+int gsl_integration_qagp_array (const gsl_function_array * f,
+                                double *pts, size_t npts,
+                                double epsabs, double epsrel, size_t limit,
+                                gsl_integration_workspace * workspace,
+                                double *result, double *abserr);
+
 int gsl_integration_qawc (gsl_function *f,
                           const double a, const double b, const double c,
                           const double epsabs, const double epsrel, const size_t limit,
@@ -313,6 +390,12 @@ gsl_integration_cquad (const gsl_function * f, double a, double b,
 		                   gsl_integration_cquad_workspace * ws,
 		                   double *result, double *abserr, size_t * nevals);
 
+int
+gsl_integration_cquad_array (const gsl_function_array * f, double a, double b,
+                             double epsabs, double epsrel,
+                             gsl_integration_cquad_workspace * ws,
+                             double *result, double *abserr, size_t * nevals);
+
 /* Romberg integration workspace and routines */
 
 typedef struct
@@ -0,0 +1,75 @@
+/* integration/integrand.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* An integrand together with the Gauss-Kronrod rule applied to it,
+   so that the adaptive routines can be shared between gsl_function,
+   evaluated one point at a time, and gsl_function_array, evaluated
+   at all nodes of the rule at once. Exactly one of f and fa is
+   set. */
+
+typedef struct
+{
+  const gsl_function *f;
+  gsl_integration_rule *q;
+  const gsl_function_array *fa;
+  gsl_integration_rule_array *qa;
+}
+integrand;
+
+static integrand
+integrand_scalar (const gsl_function * f, gsl_integration_rule * q)
+{
+  integrand g;
+
+  g.f = f;
+  g.q = q;
+  g.fa = NULL;
+  g.qa = NULL;
+
+  return g;
+}
+
+static integrand
+integrand_array (const gsl_function_array * fa,
+                 gsl_integration_rule_array * qa)
+{
+  integrand g;
+
+  g.f = NULL;
+  g.q = NULL;
+  g.fa = fa;
+  g.qa = qa;
+
+  return g;
+}
+
+static void
+integrand_rule (const integrand * g, double a, double b,
+                double *result, double *abserr,
+                double *resabs, double *resasc)
+{
+  if (g->fa != NULL)
+    {
+      g->qa (g->fa, a, b, result, abserr, resabs, resasc);
+    }
+  else
+    {
+      g->q (g->f, a, b, result, abserr, resabs, resasc);
+    }
+}
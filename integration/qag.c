@@ -27,15 +27,15 @@
 #include "set_initial.c"
 #include "qpsrt.c"
 #include "util.c"
+#include "integrand.c"
 
 static int
-qag (const gsl_function *f,
+qag (const integrand * g,
      const double a, const double b,
      const double epsabs, const double epsrel,
      const size_t limit,
      gsl_integration_workspace * workspace,
-     double * result, double * abserr,
-     gsl_integration_rule * q) ;
+     double * result, double * abserr) ;
 
 int
 gsl_integration_qag (const gsl_function *f,
@@ -82,22 +82,59 @@ gsl_integration_qag (const gsl_function *f,
                 GSL_EINVAL) ;
     }
 
-  status = qag (f, a, b, epsabs, epsrel, limit,
-                workspace, 
-                result, abserr, 
-                integration_rule) ;
+  {
+    integrand g = integrand_scalar (f, integration_rule);
+
+    status = qag (&g, a, b, epsabs, epsrel, limit,
+                  workspace, 
+                  result, abserr) ;
+  }
   
   return status ;
 }
 
+int
+gsl_integration_qag_array (const gsl_function_array *f,
+                           double a, double b,
+                           double epsabs, double epsrel, size_t limit,
+                           int key,
+                           gsl_integration_workspace * workspace,
+                           double * result, double * abserr)
+{
+  static gsl_integration_rule_array * const rules[] = {
+    gsl_integration_qk15_array, gsl_integration_qk21_array,
+    gsl_integration_qk31_array, gsl_integration_qk41_array,
+    gsl_integration_qk51_array, gsl_integration_qk61_array
+  };
+  int status ;
+
+  if (key < GSL_INTEG_GAUSS15)
+    {
+      key = GSL_INTEG_GAUSS15 ;
+    } 
+  else if (key > GSL_INTEG_GAUSS61) 
+    {
+      key = GSL_INTEG_GAUSS61 ;
+    }
+
+  {
+    integrand g = integrand_array (f, rules[key - GSL_INTEG_GAUSS15]);
+
+    status = qag (&g, a, b, epsabs, epsrel, limit,
+                  workspace, 
+                  result, abserr) ;
+  }
+
+  return status ;
+}
+
 static int
-qag (const gsl_function * f,
+qag (const integrand * g,
      const double a, const double b,
      const double epsabs, const double epsrel,
      const size_t limit,
      gsl_integration_workspace * workspace,
-     double *result, double *abserr,
-     gsl_integration_rule * q)
+     double *result, double *abserr)
 {
   double area, errsum;
   double result0, abserr0, resabs0, resasc0;
@@ -127,7 +164,7 @@ qag (const gsl_function * f,
 
   /* perform the first integration */
 
-  q (f, a, b, &result0, &abserr0, &resabs0, &resasc0);
+  integrand_rule (g, a, b, &result0, &abserr0, &resabs0, &resasc0);
 
   set_initial_result (workspace, result0, abserr0);
 
@@ -185,8 +222,8 @@ qag (const gsl_function * f,
       a2 = b1;
       b2 = b_i;
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
-      q (f, a2, b2, &area2, &error2, &resabs2, &resasc2);
+      integrand_rule (g, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      integrand_rule (g, a2, b2, &area2, &error2, &resabs2, &resasc2);
 
       area12 = area1 + area2;
       error12 = error1 + error2;
@@ -30,11 +30,11 @@
 #include "qpsrt2.c"
 #include "qelg.c"
 #include "positivity.c"
+#include "integrand.c"
 
-static int qags (const gsl_function * f, const double a, const double
+static int qags (const integrand * g, const double a, const double
   b, const double epsabs, const double epsrel, const size_t limit,
-  gsl_integration_workspace * workspace, double *result, double *abserr,
-  gsl_integration_rule * q);
+  gsl_integration_workspace * workspace, double *result, double *abserr);
 
 int
 gsl_integration_qags (const gsl_function *f,
@@ -43,10 +43,24 @@ gsl_integration_qags (const gsl_function *f,
                       gsl_integration_workspace * workspace,
                       double * result, double * abserr)
 {
-  int status = qags (f, a, b, epsabs, epsrel, limit,
+  integrand g = integrand_scalar (f, &gsl_integration_qk21);
+  int status = qags (&g, a, b, epsabs, epsrel, limit,
                      workspace, 
-                     result, abserr, 
-                     &gsl_integration_qk21) ;
+                     result, abserr) ;
+  return status ;
+}
+
+int
+gsl_integration_qags_array (const gsl_function_array *f,
+                            double a, double b,
+                            double epsabs, double epsrel, size_t limit,
+                            gsl_integration_workspace * workspace,
+                            double * result, double * abserr)
+{
+  integrand g = integrand_array (f, &gsl_integration_qk21_array);
+  int status = qags (&g, a, b, epsabs, epsrel, limit,
+                     workspace, 
+                     result, abserr) ;
   return status ;
 }
 
@@ -72,11 +86,14 @@ gsl_integration_qagi (gsl_function * f,
   f_transform.function = &i_transform;
   f_transform.params = f;
 
-  status = qags (&f_transform, 0.0, 1.0, 
-                 epsabs, epsrel, limit,
-                 workspace,
-                 result, abserr,
-                 &gsl_integration_qk15);
+  {
+    integrand g = integrand_scalar (&f_transform, &gsl_integration_qk15);
+
+    status = qags (&g, 0.0, 1.0, 
+                   epsabs, epsrel, limit,
+                   workspace,
+                   result, abserr);
+  }
 
   return status;
 }
@@ -120,11 +137,14 @@ gsl_integration_qagil (gsl_function * f,
   f_transform.function = &il_transform;
   f_transform.params = &transform_params;
 
-  status = qags (&f_transform, 0.0, 1.0, 
-                 epsabs, epsrel, limit,
-                 workspace,
-                 result, abserr,
-                 &gsl_integration_qk15);
+  {
+    integrand g = integrand_scalar (&f_transform, &gsl_integration_qk15);
+
+    status = qags (&g, 0.0, 1.0, 
+                   epsabs, epsrel, limit,
+                   workspace,
+                   result, abserr);
+  }
 
   return status;
 }
@@ -169,11 +189,14 @@ gsl_integration_qagiu (gsl_function * f,
   f_transform.function = &iu_transform;
   f_transform.params = &transform_params;
 
-  status = qags (&f_transform, 0.0, 1.0, 
-                 epsabs, epsrel, limit,
-                 workspace,
-                 result, abserr,
-                 &gsl_integration_qk15);
+  {
+    integrand g = integrand_scalar (&f_transform, &gsl_integration_qk15);
+
+    status = qags (&g, 0.0, 1.0, 
+                   epsabs, epsrel, limit,
+                   workspace,
+                   result, abserr);
+  }
 
   return status;
 }
@@ -192,13 +215,12 @@ iu_transform (double t, void *params)
 /* Main integration function */
 
 static int
-qags (const gsl_function * f,
+qags (const integrand * g,
       const double a, const double b,
       const double epsabs, const double epsrel,
       const size_t limit,
       gsl_integration_workspace * workspace,
-      double *result, double *abserr,
-      gsl_integration_rule * q)
+      double *result, double *abserr)
 {
   double area, errsum;
   double res_ext, err_ext;
@@ -242,7 +264,7 @@ qags (const gsl_function * f,
 
   /* Perform the first integration */
 
-  q (f, a, b, &result0, &abserr0, &resabs0, &resasc0);
+  integrand_rule (g, a, b, &result0, &abserr0, &resabs0, &resasc0);
 
   set_initial_result (workspace, result0, abserr0);
 
@@ -310,8 +332,8 @@ qags (const gsl_function * f,
 
       iteration++;
 
-      q (f, a1, b1, &area1, &error1, &resabs1, &resasc1);
-      q (f, a2, b2, &area2, &error2, &resabs2, &resasc2);
+      integrand_rule (g, a1, b1, &area1, &error1, &resabs1, &resasc1);
+      integrand_rule (g, a2, b2, &area2, &error2, &resabs2, &resasc2);
 
       area12 = area1 + area2;
       error12 = error1 + error2;
@@ -100,3 +100,96 @@ gsl_integration_qk (const int n,
   *abserr = rescale_error (err, result_abs, result_asc);
 
 }
+
+void
+gsl_integration_qk_array (const int n, 
+                          const double xgk[], const double wg[], const double wgk[],
+                          double x[], double fx[],
+                          const gsl_function_array * f, double a, double b,
+                          double *result, double *abserr,
+                          double *resabs, double *resasc)
+{
+  /* Same as gsl_integration_qk, but the 2n-1 nodes are stored in x in
+     increasing order for b > a and f is called once for all of them,
+     returning the values in fx. The sums are formed in the same order
+     as in gsl_integration_qk. */
+
+  const double center = 0.5 * (a + b);
+  const double half_length = 0.5 * (b - a);
+  const double abs_half_length = fabs (half_length);
+  const int m = 2 * n - 2;      /* fx[j] and fx[m - j] are the values
+                                   at center -/+ abscissa j */
+  double f_center;
+
+  double result_gauss = 0;
+  double result_kronrod;
+
+  double result_abs;
+  double result_asc = 0;
+  double mean = 0, err = 0;
+
+  int j;
+
+  for (j = 0; j < n - 1; j++)
+    {
+      const double abscissa = half_length * xgk[j];
+      x[j] = center - abscissa;
+      x[m - j] = center + abscissa;
+    }
+
+  x[n - 1] = center;
+
+  GSL_FN_ARRAY_EVAL (f, x, fx, (size_t) (m + 1));
+
+  f_center = fx[n - 1];
+  result_kronrod = f_center * wgk[n - 1];
+  result_abs = fabs (result_kronrod);
+
+  if (n % 2 == 0)
+    {
+      result_gauss = f_center * wg[n / 2 - 1];
+    }
+
+  for (j = 0; j < (n - 1) / 2; j++)
+    {
+      const int jtw = j * 2 + 1;
+      const double fval1 = fx[jtw];
+      const double fval2 = fx[m - jtw];
+      const double fsum = fval1 + fval2;
+      result_gauss += wg[j] * fsum;
+      result_kronrod += wgk[jtw] * fsum;
+      result_abs += wgk[jtw] * (fabs (fval1) + fabs (fval2));
+    }
+
+  for (j = 0; j < n / 2; j++)
+    {
+      int jtwm1 = j * 2;
+      const double fval1 = fx[jtwm1];
+      const double fval2 = fx[m - jtwm1];
+      result_kronrod += wgk[jtwm1] * (fval1 + fval2);
+      result_abs += wgk[jtwm1] * (fabs (fval1) + fabs (fval2));
+    };
+
+  mean = result_kronrod * 0.5;
+
+  result_asc = wgk[n - 1] * fabs (f_center - mean);
+
+  for (j = 0; j < n - 1; j++)
+    {
+      result_asc += wgk[j] * (fabs (fx[j] - mean) + fabs (fx[m - j] - mean));
+    }
+
+  /* scale by the width of the integration region */
+
+  err = (result_kronrod - result_gauss) * half_length;
+
+  result_kronrod *= half_length;
+  result_abs *= abs_half_length;
+  result_asc *= abs_half_length;
+
+  *result = result_kronrod;
+  *resabs = result_abs;
+  *resasc = result_asc;
+  *abserr = rescale_error (err, result_abs, result_asc);
+
+}
@@ -68,3 +68,12 @@ gsl_integration_qk15 (const gsl_function * f, double a, double b,
   gsl_integration_qk (8, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
 
+
+void
+gsl_integration_qk15_array (const gsl_function_array * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double x[15], fx[15];
+  gsl_integration_qk_array (8, xgk, wg, wgk, x, fx, f, a, b, result, abserr, resabs, resasc);
+}
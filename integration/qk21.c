@@ -75,3 +75,12 @@ gsl_integration_qk21 (const gsl_function * f, double a, double b,
   double fv1[11], fv2[11];
   gsl_integration_qk (11, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
+
+void
+gsl_integration_qk21_array (const gsl_function_array * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double x[21], fx[21];
+  gsl_integration_qk_array (11, xgk, wg, wgk, x, fx, f, a, b, result, abserr, resabs, resasc);
+}
@@ -87,3 +87,12 @@ gsl_integration_qk31 (const gsl_function * f, double a, double b,
   double fv1[16], fv2[16];
   gsl_integration_qk (16, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
+
+void
+gsl_integration_qk31_array (const gsl_function_array * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double x[31], fx[31];
+  gsl_integration_qk_array (16, xgk, wg, wgk, x, fx, f, a, b, result, abserr, resabs, resasc);
+}
@@ -100,3 +100,12 @@ gsl_integration_qk41 (const gsl_function * f, double a, double b,
   gsl_integration_qk (21, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
 
+
+void
+gsl_integration_qk41_array (const gsl_function_array * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double x[41], fx[41];
+  gsl_integration_qk_array (21, xgk, wg, wgk, x, fx, f, a, b, result, abserr, resabs, resasc);
+}
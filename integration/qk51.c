@@ -115,3 +115,12 @@ gsl_integration_qk51 (const gsl_function * f, double a, double b,
   gsl_integration_qk (26, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
 
+
+void
+gsl_integration_qk51_array (const gsl_function_array * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double x[51], fx[51];
+  gsl_integration_qk_array (26, xgk, wg, wgk, x, fx, f, a, b, result, abserr, resabs, resasc);
+}
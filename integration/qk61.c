@@ -124,3 +124,12 @@ gsl_integration_qk61 (const gsl_function * f, double a, double b,
   double fv1[31], fv2[31];
   gsl_integration_qk (31, xgk, wg, wgk, fv1, fv2, f, a, b, result, abserr, resabs, resasc);
 }
+
+void
+gsl_integration_qk61_array (const gsl_function_array * f, double a, double b,
+                            double *result, double *abserr,
+                            double *resabs, double *resasc)
+{
+  double x[61], fx[61];
+  gsl_integration_qk_array (31, xgk, wg, wgk, x, fx, f, a, b, result, abserr, resabs, resasc);
+}
@@ -82,6 +82,52 @@ gsl_function make_counter (gsl_function * f, struct counter_params * p)
   return f_new;
 }
 
+/* Evaluates a gsl_function at an array of points, counting the calls
+   and the points and checking that the points are in increasing order */
+
+struct array_params {
+  gsl_function * f;
+  int ncall;
+  int neval;
+  int unordered;
+} ;
+
+void array_eval (const double x[], double y[], size_t n, void * params);
+gsl_function_array make_array (gsl_function * f, struct array_params * p);
+
+void
+array_eval (const double x[], double y[], size_t n, void * params)
+{
+  struct array_params * p = (struct array_params *) params;
+  size_t i;
+
+  p->ncall++ ;
+  p->neval += (int) n ;
+
+  for (i = 0; i < n; i++)
+    {
+      if (i > 0 && !(x[i] > x[i - 1]))
+        p->unordered++ ;
+
+      y[i] = GSL_FN_EVAL(p->f, x[i]);
+    }
+}
+
+gsl_function_array make_array (gsl_function * f, struct array_params * p)
+{
+  gsl_function_array f_new;
+
+  p->f = f;
+  p->ncall = 0;
+  p->neval = 0;
+  p->unordered = 0;
+
+  f_new.function = &array_eval ;
+  f_new.params = p ;
+
+  return f_new;
+}
+
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
@@ -2444,6 +2490,147 @@ main (void)
     }
   }
 
+  /* Test the array integrand interface. The rules form their sums in
+     the same order for both interfaces, so the results agree exactly */
+
+  {
+    gsl_integration_rule * rules[6] = {
+      gsl_integration_qk15, gsl_integration_qk21, gsl_integration_qk31,
+      gsl_integration_qk41, gsl_integration_qk51, gsl_integration_qk61 } ;
+    gsl_integration_rule_array * rules_array[6] = {
+      gsl_integration_qk15_array, gsl_integration_qk21_array,
+      gsl_integration_qk31_array, gsl_integration_qk41_array,
+      gsl_integration_qk51_array, gsl_integration_qk61_array } ;
+    const int npts[6] = { 15, 21, 31, 41, 51, 61 } ;
+    double alpha = 2.6 ;
+    gsl_function f = make_function(&f1, &alpha) ;
+    struct array_params p ;
+    gsl_function_array fa = make_array(&f, &p) ;
+    int k ;
+
+    for (k = 0; k < 6; k++)
+      {
+        double result, abserr, resabs, resasc ;
+        double result_a, abserr_a, resabs_a, resasc_a ;
+
+        p.ncall = 0 ; p.neval = 0 ;
+
+        rules[k] (&f, 0.0, 1.0, &result, &abserr, &resabs, &resasc) ;
+        rules_array[k] (&fa, 0.0, 1.0, &result_a, &abserr_a, &resabs_a,
+                        &resasc_a) ;
+
+        gsl_test_rel(result_a,result,0.0,"qk%d_array(f1) result",npts[k]) ;
+        gsl_test_rel(abserr_a,abserr,0.0,"qk%d_array(f1) abserr",npts[k]) ;
+        gsl_test_rel(resabs_a,resabs,0.0,"qk%d_array(f1) resabs",npts[k]) ;
+        gsl_test_rel(resasc_a,resasc,0.0,"qk%d_array(f1) resasc",npts[k]) ;
+        gsl_test_int(p.ncall,1,"qk%d_array(f1) calls",npts[k]) ;
+        gsl_test_int(p.neval,npts[k],"qk%d_array(f1) neval",npts[k]) ;
+      }
+
+    gsl_test_int(p.unordered,0,"qk_array(f1) nodes in increasing order") ;
+  }
+
+  {
+    const int npts[6] = { 15, 21, 31, 41, 51, 61 } ;
+    int status, status_a, key ;
+    struct counter_params pc ;
+    struct array_params p ;
+    double result = 0, abserr = 0, result_a = 0, abserr_a = 0 ;
+    double alpha = 2.6 ;
+    gsl_integration_workspace * w = gsl_integration_workspace_alloc (1000) ;
+    gsl_function f = make_function(&f1, &alpha) ;
+    gsl_function fc = make_counter(&f, &pc) ;
+    gsl_function_array fa = make_array(&f, &p) ;
+
+    for (key = GSL_INTEG_GAUSS15; key <= GSL_INTEG_GAUSS61; key++)
+      {
+        pc.neval = 0 ; p.ncall = 0 ; p.neval = 0 ;
+
+        status = gsl_integration_qag (&fc, 0.0, 1.0, 0.0, 1e-10, w->limit,
+                                      key, w, &result, &abserr) ;
+        status_a = gsl_integration_qag_array (&fa, 0.0, 1.0, 0.0, 1e-10,
+                                              w->limit, key, w,
+                                              &result_a, &abserr_a) ;
+
+        gsl_test_rel(result_a,result,0.0,"qag_array(f1) key %d result",key) ;
+        gsl_test_rel(abserr_a,abserr,0.0,"qag_array(f1) key %d abserr",key) ;
+        gsl_test_int(p.neval,pc.neval,"qag_array(f1) key %d neval",key) ;
+        gsl_test_int(p.neval,p.ncall * npts[key - 1],
+                     "qag_array(f1) key %d calls",key) ;
+        gsl_test_int(status_a,status,"qag_array(f1) key %d status",key) ;
+      }
+
+    pc.neval = 0 ; p.ncall = 0 ; p.neval = 0 ;
+
+    status = gsl_integration_qags (&fc, 1.0, 0.0, 0.0, 1e-10, w->limit, w,
+                                   &result, &abserr) ;
+    status_a = gsl_integration_qags_array (&fa, 1.0, 0.0, 0.0, 1e-10,
+                                           w->limit, w, &result_a, &abserr_a) ;
+
+    gsl_test_rel(result_a,result,0.0,"qags_array(f1) reverse result") ;
+    gsl_test_rel(abserr_a,abserr,0.0,"qags_array(f1) reverse abserr") ;
+    gsl_test_int(p.neval,pc.neval,"qags_array(f1) reverse neval") ;
+    gsl_test_int(p.neval,p.ncall * 21,"qags_array(f1) reverse calls") ;
+    gsl_test_int(status_a,status,"qags_array(f1) reverse status") ;
+
+    gsl_integration_workspace_free (w) ;
+  }
+
+  {
+    int status, status_a ;
+    struct counter_params pc ;
+    struct array_params p ;
+    double result = 0, abserr = 0, result_a = 0, abserr_a = 0 ;
+    double pts[4] = { 0.0, 1.0, M_SQRT2, 3.0 } ;
+    gsl_integration_workspace * w = gsl_integration_workspace_alloc (1000) ;
+    gsl_function f = make_function(&f454, 0) ;
+    gsl_function fc = make_counter(&f, &pc) ;
+    gsl_function_array fa = make_array(&f, &p) ;
+
+    status = gsl_integration_qagp (&fc, pts, 4, 0.0, 1.0e-3, w->limit, w,
+                                   &result, &abserr) ;
+    status_a = gsl_integration_qagp_array (&fa, pts, 4, 0.0, 1.0e-3,
+                                           w->limit, w, &result_a, &abserr_a) ;
+
+    gsl_test_rel(result_a,result,0.0,"qagp_array(f454) singular result") ;
+    gsl_test_rel(abserr_a,abserr,0.0,"qagp_array(f454) singular abserr") ;
+    gsl_test_int(p.neval,pc.neval,"qagp_array(f454) singular neval") ;
+    gsl_test_int(p.neval,p.ncall * 21,"qagp_array(f454) singular calls") ;
+    gsl_test_int(status_a,status,"qagp_array(f454) singular status") ;
+
+    gsl_integration_workspace_free (w) ;
+  }
+
+  {
+    typedef double (*fptr) ( double , void * );
+
+    const fptr funs[5] = { &cqf1 , &cqf7 , &cqf11 , &cqf16 , &cqf22 };
+    const double ranges[10] = { 0, 1 , 0, 1 , 0, 1 , 0, 10 , 0, 1 };
+    gsl_integration_cquad_workspace *ws = gsl_integration_cquad_workspace_alloc ( 200 );
+    int fid;
+
+    for ( fid = 0 ; fid < 5 ; fid++ ) {
+      gsl_function f = make_function(funs[fid], NULL);
+      struct array_params p ;
+      gsl_function_array fa = make_array(&f, &p) ;
+      double result, abserr, result_a, abserr_a;
+      size_t neval, neval_a;
+
+      int status = gsl_integration_cquad (&f, ranges[2*fid] , ranges[2*fid+1] , 0.0 , 1.0e-12 , ws , &result , &abserr , &neval);
+      int status_a = gsl_integration_cquad_array (&fa, ranges[2*fid] , ranges[2*fid+1] , 0.0 , 1.0e-12 , ws , &result_a , &abserr_a , &neval_a);
+
+      gsl_test_rel (result_a, result, 0.0, "cquad_array f%d result", fid);
+      gsl_test_rel (abserr_a, abserr, 0.0, "cquad_array f%d abserr", fid);
+      gsl_test_int ((int) neval_a, (int) neval, "cquad_array f%d neval", fid);
+      gsl_test_int (p.neval, (int) neval, "cquad_array f%d points", fid);
+      gsl_test (p.ncall >= p.neval / 3, "cquad_array f%d calls", fid);
+      gsl_test_int (p.unordered, 0, "cquad_array f%d nodes in increasing order", fid);
+      gsl_test_int (status_a, status, "cquad_array f%d status", fid);
+    }
+
+    gsl_integration_cquad_workspace_free(ws);
+  }
+
   /* test fixed quadrature */
   {
     size_t n;
@@ -0,0 +1,107 @@
+/* moments.h
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_MOMENTS_H__
+#define __GSL_MOMENTS_H__
+
+/* running central moments of a (possibly weighted) set of samples:
+ *
+ * W    = total weight (number of samples if unweighted)
+ * mean = mean
+ * M2   = sum_i w_i (x_i - mean)^2
+ * M3   = sum_i w_i (x_i - mean)^3
+ * M4   = sum_i w_i (x_i - mean)^4
+ */
+typedef struct
+{
+  double W;
+  double mean;
+  double M2;
+  double M3;
+  double M4;
+} moment_accum;
+
+static inline void
+moments_init (moment_accum * a)
+{
+  a->W = 0.0;
+  a->mean = 0.0;
+  a->M2 = 0.0;
+  a->M3 = 0.0;
+  a->M4 = 0.0;
+}
+
+/* combine the moments of two disjoint sets of samples, a <- a U b,
+ * using the pairwise formulas of Chan et al, extended to third and
+ * fourth order by Pebay (SAND2008-6212). The formulas hold for
+ * non-integer weights */
+static inline void
+moments_combine (moment_accum * a, const moment_accum * b)
+{
+  const double na = a->W;
+  const double nb = b->W;
+  const double n = na + nb;
+  double delta, delta_n, delta_n2, term1;
+
+  if (nb == 0.0)
+    return;
+
+  if (na == 0.0)
+    {
+      *a = *b;
+      return;
+    }
+
+  delta = b->mean - a->mean;
+  delta_n = delta / n;
+  delta_n2 = delta_n * delta_n;
+  term1 = delta * delta_n * na * nb;
+
+  a->M4 += b->M4 + term1 * delta_n2 * (na * na - na * nb + nb * nb)
+           + 6.0 * delta_n2 * (na * na * b->M2 + nb * nb * a->M2)
+           + 4.0 * delta_n * (na * b->M3 - nb * a->M3);
+  a->M3 += b->M3 + term1 * delta_n * (na - nb)
+           + 3.0 * delta_n * (na * b->M2 - nb * a->M2);
+  a->M2 += b->M2 + term1;
+  a->mean += nb * delta_n;
+  a->W = n;
+}
+
+/* add a single sample x with weight w > 0 */
+static inline void
+moments_add (moment_accum * a, const double x, const double w)
+{
+  const double na = a->W;
+  const double n = na + w;
+  const double delta = x - a->mean;
+  const double delta_n = delta * (w / n);
+  const double delta_n2 = delta_n * delta_n;
+  const double term1 = delta * delta_n * na;
+
+  /* this is moments_combine() with nb = w and M2b = M3b = M4b = 0,
+     after simplifying the powers of w into delta_n */
+  a->M4 += term1 * delta_n2 * (na * na - na * w + w * w) / (w * w)
+           + 6.0 * delta_n2 * a->M2 - 4.0 * delta_n * a->M3;
+  a->M3 += term1 * delta_n * (na - w) / w - 3.0 * delta_n * a->M2;
+  a->M2 += term1;
+  a->mean += delta_n;
+  a->W = n;
+}
+
+#endif /* __GSL_MOMENTS_H__ */
@@ -0,0 +1,158 @@
+/* movstat/benchmark.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Timings of the moving order statistic data structures, used to choose
+ * the window size thresholds in medacc.c and qqracc.c, followed by
+ * timings of gsl_movstat_median and gsl_movstat_qqr.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_movstat.h>
+
+#include "mediator.c"
+#include "sortwin.c"
+#include "ostree.c"
+
+#define N 1000000
+
+double dsum;
+
+static double
+bench_mediator(const size_t K, const double * x)
+{
+  void *state = malloc(mediator_size(K));
+  clock_t start = clock();
+  double y;
+  size_t i;
+
+  mediator_init(K, state);
+
+  for (i = 0; i < N; ++i)
+    {
+      mediator_insert(x[i], state);
+      mediator_get(NULL, &y, state);
+      dsum += y;
+    }
+
+  free(state);
+
+  return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double
+bench_sortwin(const size_t K, const double * x)
+{
+  sortwin *s = malloc(sortwin_size(K));
+  clock_t start = clock();
+  size_t i;
+
+  sortwin_init(K, s);
+
+  for (i = 0; i < N; ++i)
+    {
+      sortwin_insert(x[i], s);
+      dsum += sortwin_select(s->ct / 2, s);
+    }
+
+  free(s);
+
+  return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double
+bench_ostree(const size_t K, const double * x)
+{
+  ostree *t = malloc(ostree_size(K));
+  clock_t start = clock();
+  size_t i;
+
+  ostree_init(K, t);
+
+  for (i = 0; i < N; ++i)
+    {
+      ostree_insert(x[i], t);
+      dsum += ostree_select(t->ct / 2, t);
+    }
+
+  free(t);
+
+  return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+static double
+bench_movstat(const size_t K, const int qqr, const gsl_vector * x, gsl_vector * y)
+{
+  gsl_movstat_workspace *w = gsl_movstat_alloc(K);
+  clock_t start = clock();
+
+  if (qqr)
+    gsl_movstat_qqr(GSL_MOVSTAT_END_PADVALUE, x, 0.25, y, w);
+  else
+    gsl_movstat_median(GSL_MOVSTAT_END_PADVALUE, x, y, w);
+
+  dsum += gsl_vector_get(y, 0);
+
+  gsl_movstat_free(w);
+
+  return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+int
+main (void)
+{
+  const size_t K[] = { 3, 5, 7, 9, 15, 31, 63, 127, 255, 511,
+                       1023, 2047, 4095, 8191, 16383, 32767 };
+  const size_t nK = sizeof(K) / sizeof(size_t);
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  gsl_vector *x = gsl_vector_alloc(N);
+  gsl_vector *y = gsl_vector_alloc(N);
+  size_t i;
+
+  for (i = 0; i < N; ++i)
+    gsl_vector_set(x, i, gsl_rng_uniform(r));
+
+  printf("%6s %10s %10s %10s %10s %10s\n",
+         "K", "mediator", "sortwin", "ostree", "median", "qqr");
+
+  for (i = 0; i < nK; ++i)
+    {
+      double t1 = bench_mediator(K[i], x->data);
+      double t2 = bench_sortwin(K[i], x->data);
+      double t3 = bench_ostree(K[i], x->data);
+      double t4 = bench_movstat(K[i], 0, x, y);
+      double t5 = bench_movstat(K[i], 1, x, y);
+
+      printf("%6zu %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+             K[i], t1, t2, t3, t4, t5);
+    }
+
+  gsl_rng_free(r);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+
+  return 0;
+}
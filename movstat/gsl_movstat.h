@@ -22,6 +22,7 @@
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -77,6 +78,8 @@ typedef struct
   double *work;      /* workspace, size K */
   void *state;       /* state workspace for various accumulators */
   size_t state_size; /* bytes allocated for 'state' */
+  size_t nstream;    /* number of samples received in current stream */
+  double xlast;      /* last sample received in current stream */
 } gsl_movstat_workspace;
 
 /* alloc.c */
@@ -94,6 +97,22 @@ int gsl_movstat_apply_accum(const gsl_movstat_end_t endtype, const gsl_vector *
 int gsl_movstat_apply(const gsl_movstat_end_t endtype, const gsl_movstat_function * F,
                       const gsl_vector * x, gsl_vector * y, gsl_movstat_workspace * w);
 
+/* stream.c */
+int gsl_movstat_stream_reset(gsl_movstat_workspace * w);
+int gsl_movstat_stream_accum(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                             const gsl_movstat_accum * accum, void * accum_params,
+                             gsl_vector * y, gsl_vector * z, size_t * ny,
+                             gsl_movstat_workspace * w);
+int gsl_movstat_stream_finish(const gsl_movstat_end_t endtype,
+                              const gsl_movstat_accum * accum, void * accum_params,
+                              gsl_vector * y, gsl_vector * z, size_t * ny,
+                              gsl_movstat_workspace * w);
+int gsl_movstat_stream_apply(const gsl_movstat_end_t endtype, const gsl_movstat_function * F,
+                             const gsl_vector * x, gsl_vector * y, size_t * ny,
+                             gsl_movstat_workspace * w);
+int gsl_movstat_stream_apply_finish(const gsl_movstat_end_t endtype, const gsl_movstat_function * F,
+                                    gsl_vector * y, size_t * ny, gsl_movstat_workspace * w);
+
 /* fill.c */
 size_t gsl_movstat_fill(const gsl_movstat_end_t endtype, const gsl_vector * x, const size_t idx,
                         const size_t H, const size_t J, double * window);
@@ -117,6 +136,33 @@ int gsl_movstat_Qn(const gsl_movstat_end_t endtype, const gsl_vector * x,
                    gsl_vector * xscale, gsl_movstat_workspace * w);
 int gsl_movstat_sum(const gsl_movstat_end_t endtype, const gsl_vector * x, gsl_vector * y, gsl_movstat_workspace * w);
 
+/* workspace for multichannel moving window statistics */
+
+typedef struct
+{
+  size_t H;          /* number of previous samples in window */
+  size_t J;          /* number of after samples in window */
+  size_t K;          /* window size K = H + J + 1 */
+  size_t nchan;      /* maximum number of channels */
+  double *ring;      /* last K rows of input, size K * nchan */
+  double *suffix;    /* suffix extrema of previous block, size K * nchan */
+  double *acc;       /* running sum or prefix extremum, size nchan */
+  double *pad;       /* pad rows for window end points, size 2 * nchan */
+} gsl_movstat_matrix_workspace;
+
+/* movmatrix.c */
+gsl_movstat_matrix_workspace *gsl_movstat_matrix_alloc(const size_t K, const size_t nchan);
+gsl_movstat_matrix_workspace *gsl_movstat_matrix_alloc2(const size_t H, const size_t J, const size_t nchan);
+void gsl_movstat_matrix_free(gsl_movstat_matrix_workspace * w);
+int gsl_movstat_matrix_mean(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                            gsl_movstat_matrix_workspace * w);
+int gsl_movstat_matrix_sum(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                           gsl_movstat_matrix_workspace * w);
+int gsl_movstat_matrix_min(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                           gsl_movstat_matrix_workspace * w);
+int gsl_movstat_matrix_max(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                           gsl_movstat_matrix_workspace * w);
+
 /* accumulator variables */
 
 GSL_VAR const gsl_movstat_accum * gsl_movstat_accum_mad;
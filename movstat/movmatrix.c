@@ -0,0 +1,360 @@
+/* movstat/movmatrix.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_movstat.h>
+
+/*
+ * Moving window statistics of multichannel signals, stored as the
+ * columns of a matrix (rows = samples, columns = channels).
+ *
+ * Rather than running one accumulator per channel, each kernel
+ * advances all channels together by one row at a time, so that the
+ * inner loops run over contiguous memory and contain no branches or
+ * function pointer calls, which allows the compiler to vectorize them.
+ *
+ * The input is viewed as the extended sequence
+ *
+ *   e = { p_lo (H rows), x_0, ..., x_{n-1}, p_hi (J rows) }
+ *
+ * where the pad rows p_lo, p_hi depend on the end point handling. For
+ * truncated windows, the pad rows hold the identity element of the
+ * statistic (0 for sums, +/-Inf for min/max), so that every window
+ * e_{i}, ..., e_{i+K-1} has exactly K rows. The last K rows of e are
+ * kept in a ring buffer, which allows in-place operation (X = Y).
+ */
+
+typedef enum
+{
+  MOVMATRIX_SUM,
+  MOVMATRIX_MIN,
+  MOVMATRIX_MAX
+} movmatrix_op_t;
+
+static int movmatrix_check(const gsl_matrix * X, const gsl_matrix * Y,
+                           const gsl_movstat_matrix_workspace * w);
+static void movmatrix_pad(const gsl_movstat_end_t endtype, const movmatrix_op_t op,
+                          const gsl_matrix * X, gsl_movstat_matrix_workspace * w);
+static int movmatrix_sum(const gsl_movstat_end_t endtype, const int mean,
+                         const gsl_matrix * X, gsl_matrix * Y,
+                         gsl_movstat_matrix_workspace * w);
+
+/* get pointer to row r of the extended sequence */
+static inline const double *
+movmatrix_row(const size_t r, const gsl_matrix * X, const gsl_movstat_matrix_workspace * w)
+{
+  if (r < w->H)
+    return w->pad;
+  else if (r < w->H + X->size1)
+    return X->data + (r - w->H) * X->tda;
+  else
+    return w->pad + w->nchan;
+}
+
+/* van Herk / Gil-Werman moving minimum and maximum */
+
+#define MOVMATRIX_EXT_FUNC   movmatrix_min
+#define MOVMATRIX_EXT_OP(a,b) ((b) < (a) ? (b) : (a))
+#include "movmatrix_ext.c"
+#undef MOVMATRIX_EXT_FUNC
+#undef MOVMATRIX_EXT_OP
+
+#define MOVMATRIX_EXT_FUNC   movmatrix_max
+#define MOVMATRIX_EXT_OP(a,b) ((b) > (a) ? (b) : (a))
+#include "movmatrix_ext.c"
+#undef MOVMATRIX_EXT_FUNC
+#undef MOVMATRIX_EXT_OP
+
+/*
+gsl_movstat_matrix_alloc()
+  Allocate a workspace for multichannel moving window statistics with
+a symmetric window of K samples
+
+Inputs: K     - total samples in window (H = J = K / 2)
+        nchan - maximum number of channels (matrix columns)
+
+Return: pointer to workspace
+*/
+
+gsl_movstat_matrix_workspace *
+gsl_movstat_matrix_alloc(const size_t K, const size_t nchan)
+{
+  const size_t H = K / 2;
+  return gsl_movstat_matrix_alloc2(H, H, nchan);
+}
+
+/*
+gsl_movstat_matrix_alloc2()
+  Allocate a workspace for multichannel moving window statistics
+
+Inputs: H     - number of samples before current sample
+        J     - number of samples after current sample
+        nchan - maximum number of channels (matrix columns)
+
+Return: pointer to workspace
+*/
+
+gsl_movstat_matrix_workspace *
+gsl_movstat_matrix_alloc2(const size_t H, const size_t J, const size_t nchan)
+{
+  gsl_movstat_matrix_workspace *w;
+
+  if (nchan == 0)
+    {
+      GSL_ERROR_NULL ("number of channels must be positive", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_movstat_matrix_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->H = H;
+  w->J = J;
+  w->K = H + J + 1;
+  w->nchan = nchan;
+
+  w->ring = malloc(w->K * nchan * sizeof(double));
+  w->suffix = malloc(w->K * nchan * sizeof(double));
+  w->acc = malloc(nchan * sizeof(double));
+  w->pad = malloc(2 * nchan * sizeof(double));
+
+  if (w->ring == 0 || w->suffix == 0 || w->acc == 0 || w->pad == 0)
+    {
+      gsl_movstat_matrix_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for work arrays", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_movstat_matrix_free(gsl_movstat_matrix_workspace * w)
+{
+  if (w->ring)
+    free(w->ring);
+
+  if (w->suffix)
+    free(w->suffix);
+
+  if (w->acc)
+    free(w->acc);
+
+  if (w->pad)
+    free(w->pad);
+
+  free(w);
+}
+
+/*
+gsl_movstat_matrix_sum()
+  Apply moving sum to each column of input matrix
+
+Inputs: endtype - end point handling criteria
+        X       - input matrix, n-by-nchan
+        Y       - output matrix, n-by-nchan
+        w       - workspace
+
+Notes:
+1) It is allowed to have X = Y for in-place moving statistics
+*/
+
+int
+gsl_movstat_matrix_sum(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                       gsl_movstat_matrix_workspace * w)
+{
+  return movmatrix_sum(endtype, 0, X, Y, w);
+}
+
+int
+gsl_movstat_matrix_mean(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                        gsl_movstat_matrix_workspace * w)
+{
+  return movmatrix_sum(endtype, 1, X, Y, w);
+}
+
+int
+gsl_movstat_matrix_min(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                       gsl_movstat_matrix_workspace * w)
+{
+  int status = movmatrix_check(X, Y, w);
+
+  if (status)
+    return status;
+
+  movmatrix_pad(endtype, MOVMATRIX_MIN, X, w);
+  movmatrix_min(X, Y, w);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_movstat_matrix_max(const gsl_movstat_end_t endtype, const gsl_matrix * X, gsl_matrix * Y,
+                       gsl_movstat_matrix_workspace * w)
+{
+  int status = movmatrix_check(X, Y, w);
+
+  if (status)
+    return status;
+
+  movmatrix_pad(endtype, MOVMATRIX_MAX, X, w);
+  movmatrix_max(X, Y, w);
+
+  return GSL_SUCCESS;
+}
+
+static int
+movmatrix_check(const gsl_matrix * X, const gsl_matrix * Y,
+                const gsl_movstat_matrix_workspace * w)
+{
+  if (X->size1 != Y->size1 || X->size2 != Y->size2)
+    {
+      GSL_ERROR("input and output matrices must have same dimensions", GSL_EBADLEN);
+    }
+  else if (X->size2 > w->nchan)
+    {
+      GSL_ERROR("matrix has more columns than workspace channels", GSL_EBADLEN);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* fill pad rows p_lo and p_hi */
+static void
+movmatrix_pad(const gsl_movstat_end_t endtype, const movmatrix_op_t op,
+              const gsl_matrix * X, gsl_movstat_matrix_workspace * w)
+{
+  const size_t n = X->size1;
+  const size_t m = X->size2;
+  double *lo = w->pad;
+  double *hi = w->pad + w->nchan;
+  size_t j;
+
+  if (endtype == GSL_MOVSTAT_END_PADVALUE && n > 0)
+    {
+      memcpy(lo, X->data, m * sizeof(double));
+      memcpy(hi, X->data + (n - 1) * X->tda, m * sizeof(double));
+    }
+  else
+    {
+      double val = 0.0;
+
+      if (endtype == GSL_MOVSTAT_END_TRUNCATE)
+        {
+          if (op == MOVMATRIX_MIN)
+            val = GSL_POSINF;
+          else if (op == MOVMATRIX_MAX)
+            val = GSL_NEGINF;
+        }
+
+      for (j = 0; j < m; ++j)
+        {
+          lo[j] = val;
+          hi[j] = val;
+        }
+    }
+}
+
+/* moving sum or mean of each column */
+static int
+movmatrix_sum(const gsl_movstat_end_t endtype, const int mean,
+              const gsl_matrix * X, gsl_matrix * Y,
+              gsl_movstat_matrix_workspace * w)
+{
+  int status = movmatrix_check(X, Y, w);
+
+  if (status)
+    return status;
+  else
+    {
+      const size_t n = X->size1;
+      const size_t m = X->size2;
+      const size_t H = w->H;
+      const size_t J = w->J;
+      const size_t K = w->K;
+      const size_t N = n + H + J; /* length of extended sequence */
+      double *sum = w->acc;
+      size_t r, j;
+
+      movmatrix_pad(endtype, MOVMATRIX_SUM, X, w);
+
+      for (j = 0; j < m; ++j)
+        sum[j] = 0.0;
+
+      for (r = 0; r < N; ++r)
+        {
+          const double *e = movmatrix_row(r, X, w);
+          double *ring = w->ring + (r % K) * m;
+
+          if (r >= K)
+            {
+              /* remove row r - K, which is stored in the ring buffer, and add row r */
+              for (j = 0; j < m; ++j)
+                {
+                  sum[j] += e[j] - ring[j];
+                  ring[j] = e[j];
+                }
+            }
+          else
+            {
+              for (j = 0; j < m; ++j)
+                {
+                  sum[j] += e[j];
+                  ring[j] = e[j];
+                }
+            }
+
+          if (r + 1 >= K)
+            {
+              /* output row i contains extended rows i, ..., i + K - 1 */
+              const size_t i = r + 1 - K;
+              double *y = Y->data + i * Y->tda;
+
+              if (mean)
+                {
+                  double scale = 1.0 / K;
+
+                  if (endtype == GSL_MOVSTAT_END_TRUNCATE)
+                    {
+                      /* window x(max(i-H,0):min(i+J,n-1)) */
+                      size_t a = (i > H) ? i - H : 0;
+                      size_t b = GSL_MIN(i + J, n - 1);
+                      scale = 1.0 / (b - a + 1.0);
+                    }
+
+                  for (j = 0; j < m; ++j)
+                    y[j] = scale * sum[j];
+                }
+              else
+                {
+                  for (j = 0; j < m; ++j)
+                    y[j] = sum[j];
+                }
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
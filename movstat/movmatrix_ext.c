@@ -0,0 +1,107 @@
+/* movstat/movmatrix_ext.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Moving window extremum of each column, using the algorithm of
+ *
+ * [1] M. van Herk, "A fast algorithm for local minimum and maximum
+ *     filters on rectangular and octagonal kernels", Pattern
+ *     Recognition Letters, 13(7), 517-521, 1992
+ *
+ * [2] J. Gil and M. Werman, "Computing 2-D min, median, and max
+ *     filters", IEEE Trans. Pattern Anal. Mach. Intell., 15(5),
+ *     504-507, 1993
+ *
+ * The extended sequence is divided into blocks of K rows. A window of
+ * K rows consists of the tail of one block and the head of the next,
+ * so its extremum is OP(suffix[a], prefix[b]) where suffix holds the
+ * running extrema of the previous block taken from its end, and prefix
+ * the running extremum of the current block. This requires three
+ * applications of OP per sample, independent of K.
+ *
+ * The including file defines MOVMATRIX_EXT_FUNC (function name) and
+ * MOVMATRIX_EXT_OP(a,b) (binary extremum).
+ */
+
+static void
+MOVMATRIX_EXT_FUNC (const gsl_matrix * X, gsl_matrix * Y, gsl_movstat_matrix_workspace * w)
+{
+  const size_t n = X->size1;
+  const size_t m = X->size2;
+  const size_t K = w->K;
+  const size_t N = n + w->H + w->J; /* length of extended sequence */
+  double *prefix = w->acc;
+  size_t r, j, k;
+
+  for (r = 0; r < N; ++r)
+    {
+      const size_t pos = r % K;                       /* position within current block */
+      const double *e = movmatrix_row(r, X, w);
+      double *ring = w->ring + pos * m;
+
+      /* store row and update prefix extremum of current block */
+      if (pos == 0)
+        {
+          for (j = 0; j < m; ++j)
+            {
+              ring[j] = e[j];
+              prefix[j] = e[j];
+            }
+        }
+      else
+        {
+          for (j = 0; j < m; ++j)
+            {
+              ring[j] = e[j];
+              prefix[j] = MOVMATRIX_EXT_OP(prefix[j], e[j]);
+            }
+        }
+
+      if (pos == K - 1)
+        {
+          /* window coincides with current block */
+          double *y = Y->data + (r + 1 - K) * Y->tda;
+
+          for (j = 0; j < m; ++j)
+            y[j] = prefix[j];
+
+          /* block complete: compute its suffix extrema for the next block */
+          memcpy(w->suffix + (K - 1) * m, w->ring + (K - 1) * m, m * sizeof(double));
+
+          for (k = K - 1; k-- > 0; )
+            {
+              const double *a = w->ring + k * m;
+              const double *b = w->suffix + (k + 1) * m;
+              double *s = w->suffix + k * m;
+
+              for (j = 0; j < m; ++j)
+                s[j] = MOVMATRIX_EXT_OP(b[j], a[j]);
+            }
+        }
+      else if (r + 1 >= K)
+        {
+          /* window = rows pos+1:K-1 of previous block and 0:pos of current block */
+          const double *s = w->suffix + (pos + 1) * m;
+          double *y = Y->data + (r + 1 - K) * Y->tda;
+
+          for (j = 0; j < m; ++j)
+            y[j] = MOVMATRIX_EXT_OP(s[j], prefix[j]);
+        }
+    }
+}
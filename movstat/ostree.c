@@ -0,0 +1,266 @@
+/* movstat/ostree.c
+ *
+ * Order statistic tree module for moving order statistics
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_OSTREE_C__
+#define __GSL_OSTREE_C__
+
+#include <math.h>
+
+/*
+ * The window samples are stored in a treap (randomized binary search
+ * tree) in which every node also records the size of its subtree.
+ * Insertion, deletion and selection of the k-th smallest sample all
+ * take O(log n) expected time, so arbitrary order statistics of large
+ * windows can be maintained cheaply. Nodes are taken from a fixed pool
+ * of n nodes with a free list, so no memory is allocated after
+ * initialization. A ring buffer of values records the arrival order so
+ * that the oldest sample can be located and removed.
+ *
+ * NaNs are ordered after all other values, so the tree remains
+ * consistent for any input.
+ */
+
+#ifndef MOVSTAT_LESS
+#define MOVSTAT_LESS(a,b) ((a) < (b) || (isnan(b) && !isnan(a)))
+#endif
+
+typedef struct
+{
+  int n;            /* window size */
+  int ct;           /* number of samples in window */
+  int head;         /* ring buffer position for next sample */
+  int root;         /* root node, -1 if empty */
+  int nfree;        /* number of nodes in free list */
+  unsigned long seed; /* state of priority generator */
+  double *ring;     /* samples in arrival order, size n */
+  double *val;      /* node values, size n */
+  int *left;        /* left child of each node, size n */
+  int *right;       /* right child of each node, size n */
+  int *count;       /* number of nodes in subtree of each node, size n */
+  int *freelist;    /* unused nodes, size n */
+  unsigned long *prio; /* heap priority of each node, size n */
+} ostree;
+
+static size_t ostree_size(const size_t n);
+static int ostree_init(const size_t n, ostree * t);
+static int ostree_insert(const double x, ostree * t);
+static int ostree_delete_oldest(ostree * t);
+static double ostree_select(int k, const ostree * t);
+static int ostree_remove(const double x, ostree * t);
+static void ostree_split(int node, const double x, int * l, int * r, ostree * t);
+static int ostree_merge(int l, int r, ostree * t);
+static int ostree_erase(int node, const double x, int * found, ostree * t);
+
+#define OSTREE_COUNT(t,i) ((i) < 0 ? 0 : (t)->count[i])
+
+static size_t
+ostree_size(const size_t n)
+{
+  size_t size = 0;
+
+  size += sizeof(ostree);
+  size += 2 * n * sizeof(double);
+  size += n * sizeof(unsigned long);
+  size += 4 * n * sizeof(int);
+
+  return size;
+}
+
+static int
+ostree_init(const size_t n, ostree * t)
+{
+  int i;
+
+  t->n = (int) n;
+  t->ct = 0;
+  t->head = 0;
+  t->root = -1;
+  t->seed = 2463534242UL;
+
+  t->ring = (double *) ((unsigned char *) t + sizeof(ostree));
+  t->val = t->ring + n;
+  t->prio = (unsigned long *) (t->val + n);
+  t->left = (int *) (t->prio + n);
+  t->right = t->left + n;
+  t->count = t->right + n;
+  t->freelist = t->count + n;
+
+  t->nfree = t->n;
+  for (i = 0; i < t->n; ++i)
+    t->freelist[i] = t->n - 1 - i;
+
+  return GSL_SUCCESS;
+}
+
+/* insert x into window, replacing oldest sample if window is full */
+static int
+ostree_insert(const double x, ostree * t)
+{
+  int node, l, r;
+
+  if (t->ct == t->n)
+    ostree_remove(t->ring[t->head], t);
+  else
+    ++(t->ct);
+
+  t->ring[t->head] = x;
+  t->head = (t->head + 1) % t->n;
+
+  node = t->freelist[--(t->nfree)];
+
+  /* xorshift priorities */
+  t->seed ^= (t->seed << 13) & 0xffffffffUL;
+  t->seed ^= t->seed >> 17;
+  t->seed ^= (t->seed << 5) & 0xffffffffUL;
+
+  t->val[node] = x;
+  t->prio[node] = t->seed;
+  t->left[node] = -1;
+  t->right[node] = -1;
+  t->count[node] = 1;
+
+  ostree_split(t->root, x, &l, &r, t);
+  t->root = ostree_merge(ostree_merge(l, node, t), r, t);
+
+  return GSL_SUCCESS;
+}
+
+static int
+ostree_delete_oldest(ostree * t)
+{
+  if (t->ct > 0)
+    {
+      ostree_remove(t->ring[(t->head - t->ct + t->n) % t->n], t);
+      --(t->ct);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* return k-th smallest sample in window, k = 0, ..., ct - 1 */
+static double
+ostree_select(int k, const ostree * t)
+{
+  int node = t->root;
+
+  while (1)
+    {
+      int nl = OSTREE_COUNT(t, t->left[node]);
+
+      if (k < nl)
+        {
+          node = t->left[node];
+        }
+      else if (k == nl)
+        {
+          return t->val[node];
+        }
+      else
+        {
+          k -= nl + 1;
+          node = t->right[node];
+        }
+    }
+}
+
+/* remove one node with value x from tree and return it to the free list */
+static int
+ostree_remove(const double x, ostree * t)
+{
+  int found = -1;
+
+  t->root = ostree_erase(t->root, x, &found, t);
+
+  if (found >= 0)
+    t->freelist[(t->nfree)++] = found;
+
+  return GSL_SUCCESS;
+}
+
+/* split subtree into nodes with values <= x (l) and > x (r) */
+static void
+ostree_split(int node, const double x, int * l, int * r, ostree * t)
+{
+  if (node < 0)
+    {
+      *l = -1;
+      *r = -1;
+    }
+  else if (MOVSTAT_LESS(x, t->val[node]))
+    {
+      ostree_split(t->left[node], x, l, &(t->left[node]), t);
+      t->count[node] = OSTREE_COUNT(t, t->left[node]) + OSTREE_COUNT(t, t->right[node]) + 1;
+      *r = node;
+    }
+  else
+    {
+      ostree_split(t->right[node], x, &(t->right[node]), r, t);
+      t->count[node] = OSTREE_COUNT(t, t->left[node]) + OSTREE_COUNT(t, t->right[node]) + 1;
+      *l = node;
+    }
+}
+
+/* merge subtrees l and r, where all values in l are <= all values in r */
+static int
+ostree_merge(int l, int r, ostree * t)
+{
+  if (l < 0)
+    return r;
+  else if (r < 0)
+    return l;
+  else if (t->prio[l] > t->prio[r])
+    {
+      t->right[l] = ostree_merge(t->right[l], r, t);
+      t->count[l] = OSTREE_COUNT(t, t->left[l]) + OSTREE_COUNT(t, t->right[l]) + 1;
+      return l;
+    }
+  else
+    {
+      t->left[r] = ostree_merge(l, t->left[r], t);
+      t->count[r] = OSTREE_COUNT(t, t->left[r]) + OSTREE_COUNT(t, t->right[r]) + 1;
+      return r;
+    }
+}
+
+/* erase one node with value x from subtree; found is set to the erased node */
+static int
+ostree_erase(int node, const double x, int * found, ostree * t)
+{
+  if (node < 0)
+    return node;
+
+  if (MOVSTAT_LESS(x, t->val[node]))
+    t->left[node] = ostree_erase(t->left[node], x, found, t);
+  else if (MOVSTAT_LESS(t->val[node], x))
+    t->right[node] = ostree_erase(t->right[node], x, found, t);
+  else
+    {
+      *found = node;
+      return ostree_merge(t->left[node], t->right[node], t);
+    }
+
+  if (*found >= 0)
+    --(t->count[node]);
+
+  return node;
+}
+
+#endif /* __GSL_OSTREE_C__ */
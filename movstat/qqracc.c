@@ -21,31 +21,43 @@
 
 #include <config.h>
 #include <gsl/gsl_math.h>
-#include <gsl/gsl_vector.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_movstat.h>
-#include <gsl/gsl_sort.h>
-#include <gsl/gsl_statistics.h>
 
-typedef double qqracc_type_t;
-typedef qqracc_type_t ringbuf_type_t;
+/*
+ * The window is kept in sorted order, so that the quantiles are
+ * available without sorting the window for each sample. Small and
+ * moderate windows use a sorted array (sortwin.c), which costs O(K)
+ * contiguous data movement per sample; larger windows use an order
+ * statistic tree (ostree.c) with O(log K) updates. The crossover
+ * QQRACC_SORTWIN_MAX was chosen from the timings of benchmark.c for
+ * both random and monotone input.
+ */
+
+#include "sortwin.c"
+#include "ostree.c"
 
-#include "ringbuf.c"
+#define QQRACC_SORTWIN_MAX  2048
 
 typedef struct
 {
-  qqracc_type_t *window; /* linear array for current window */
-  ringbuf *rbuf;         /* ring buffer storing current window */
+  int use_tree;     /* 1 if order statistic tree is used, 0 for sorted window */
+  void *state;      /* sortwin or ostree */
 } qqracc_state_t;
 
+static double qqracc_quantile(const double f, const qqracc_state_t * state);
+
 static size_t
 qqracc_size(const size_t n)
 {
   size_t size = 0;
 
   size += sizeof(qqracc_state_t);
-  size += n * sizeof(qqracc_type_t);
-  size += ringbuf_size(n);
+
+  if (n > QQRACC_SORTWIN_MAX)
+    size += ostree_size(n);
+  else
+    size += sortwin_size(n);
 
   return size;
 }
@@ -55,21 +67,26 @@ qqracc_init(const size_t n, void * vstate)
 {
   qqracc_state_t * state = (qqracc_state_t *) vstate;
 
-  state->window = (qqracc_type_t *) ((unsigned char *) vstate + sizeof(qqracc_state_t));
-  state->rbuf = (ringbuf *) ((unsigned char *) state->window + n * sizeof(qqracc_type_t));
+  state->use_tree = (n > QQRACC_SORTWIN_MAX);
+  state->state = (unsigned char *) vstate + sizeof(qqracc_state_t);
 
-  ringbuf_init(n, state->rbuf);
+  if (state->use_tree)
+    ostree_init(n, (ostree *) state->state);
+  else
+    sortwin_init(n, (sortwin *) state->state);
 
   return GSL_SUCCESS;
 }
 
 static int
-qqracc_insert(const qqracc_type_t x, void * vstate)
+qqracc_insert(const double x, void * vstate)
 {
   qqracc_state_t * state = (qqracc_state_t *) vstate;
 
-  /* add new element to ring buffer */
-  ringbuf_insert(x, state->rbuf);
+  if (state->use_tree)
+    ostree_insert(x, (ostree *) state->state);
+  else
+    sortwin_insert(x, (sortwin *) state->state);
 
   return GSL_SUCCESS;
 }
@@ -79,26 +96,23 @@ qqracc_delete(void * vstate)
 {
   qqracc_state_t * state = (qqracc_state_t *) vstate;
 
-  if (!ringbuf_is_empty(state->rbuf))
-    ringbuf_pop_back(state->rbuf);
+  if (state->use_tree)
+    ostree_delete_oldest((ostree *) state->state);
+  else
+    sortwin_delete_oldest((sortwin *) state->state);
 
   return GSL_SUCCESS;
 }
 
-/* FIXME XXX: this is inefficient - could be improved by maintaining a sorted ring buffer */
 static int
-qqracc_get(void * params, qqracc_type_t * result, const void * vstate)
+qqracc_get(void * params, double * result, const void * vstate)
 {
   const qqracc_state_t * state = (const qqracc_state_t *) vstate;
   double q = *(double *) params;
-  size_t n = ringbuf_copy(state->window, state->rbuf);
-  double quant1, quant2;
-
-  gsl_sort(state->window, 1, n);
 
   /* compute q-quantile and (1-q)-quantile */
-  quant1 = gsl_stats_quantile_from_sorted_data(state->window, 1, n, q);
-  quant2 = gsl_stats_quantile_from_sorted_data(state->window, 1, n, 1.0 - q);
+  double quant1 = qqracc_quantile(q, state);
+  double quant2 = qqracc_quantile(1.0 - q, state);
 
   /* compute q-quantile range */
   *result = quant2 - quant1;
@@ -106,6 +120,39 @@ qqracc_get(void * params, qqracc_type_t * result, const void * vstate)
   return GSL_SUCCESS;
 }
 
+/* f-quantile of current window, with the same interpolation as
+   gsl_stats_quantile_from_sorted_data() */
+static double
+qqracc_quantile(const double f, const qqracc_state_t * state)
+{
+  const int n = state->use_tree ? ((const ostree *) state->state)->ct :
+                                  ((const sortwin *) state->state)->ct;
+  const double index = f * (n - 1);
+  const int lhs = (int) index;
+  const double delta = index - lhs;
+  double a, b;
+
+  if (n == 0)
+    return 0.0;
+
+  if (state->use_tree)
+    {
+      a = ostree_select(lhs, (const ostree *) state->state);
+      if (lhs == n - 1)
+        return a;
+      b = ostree_select(lhs + 1, (const ostree *) state->state);
+    }
+  else
+    {
+      a = sortwin_select(lhs, (const sortwin *) state->state);
+      if (lhs == n - 1)
+        return a;
+      b = sortwin_select(lhs + 1, (const sortwin *) state->state);
+    }
+
+  return (1 - delta) * a + delta * b;
+}
+
 static const gsl_movstat_accum qqr_accum_type =
 {
   qqracc_size,
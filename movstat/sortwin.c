@@ -0,0 +1,163 @@
+/* movstat/sortwin.c
+ *
+ * Sorted window module for moving order statistics
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_SORTWIN_C__
+#define __GSL_SORTWIN_C__
+
+#include <string.h>
+#include <math.h>
+
+/*
+ * The window is kept both in arrival order (a ring buffer) and in
+ * sorted order. Replacing the oldest sample by a new one requires two
+ * binary searches and a single memmove of the elements lying between
+ * the old and new values, so the cost per sample is O(log n) comparisons
+ * plus O(n) contiguous data movement, with no pointer chasing. For
+ * small windows this is faster than heap or tree based structures, and
+ * any order statistic is available in O(1).
+ *
+ * NaNs are ordered after all other values, so the sorted array remains
+ * consistent for any input.
+ */
+
+#ifndef MOVSTAT_LESS
+#define MOVSTAT_LESS(a,b) ((a) < (b) || (isnan(b) && !isnan(a)))
+#endif
+
+typedef struct
+{
+  int n;          /* window size */
+  int ct;         /* number of samples in window */
+  int head;       /* ring buffer position for next sample */
+  double *ring;   /* samples in arrival order, size n */
+  double *sorted; /* samples in ascending order, size n */
+} sortwin;
+
+static size_t sortwin_size(const size_t n);
+static int sortwin_init(const size_t n, sortwin * s);
+static int sortwin_insert(const double x, sortwin * s);
+static int sortwin_delete_oldest(sortwin * s);
+static double sortwin_select(const int k, const sortwin * s);
+static int sortwin_upper(const double x, const double * a, const int n);
+
+static size_t
+sortwin_size(const size_t n)
+{
+  size_t size = 0;
+
+  size += sizeof(sortwin);
+  size += 2 * n * sizeof(double);
+
+  return size;
+}
+
+static int
+sortwin_init(const size_t n, sortwin * s)
+{
+  s->n = (int) n;
+  s->ct = 0;
+  s->head = 0;
+  s->ring = (double *) ((unsigned char *) s + sizeof(sortwin));
+  s->sorted = s->ring + n;
+  return GSL_SUCCESS;
+}
+
+/* insert x into window, replacing oldest sample if window is full */
+static int
+sortwin_insert(const double x, sortwin * s)
+{
+  double *a = s->sorted;
+  int q;
+
+  if (s->ct == s->n)
+    {
+      /* find position p of oldest sample, then shift the elements between
+         p and the insertion point of x by one position */
+      const double old = s->ring[s->head];
+      int p = sortwin_upper(old, a, s->ct) - 1;
+
+      if (!MOVSTAT_LESS(x, old))
+        {
+          q = sortwin_upper(x, a, s->ct) - 1;
+          memmove(a + p, a + p + 1, (q - p) * sizeof(double));
+        }
+      else
+        {
+          q = sortwin_upper(x, a, p);
+          memmove(a + q + 1, a + q, (p - q) * sizeof(double));
+        }
+    }
+  else
+    {
+      q = sortwin_upper(x, a, s->ct);
+      memmove(a + q + 1, a + q, (s->ct - q) * sizeof(double));
+      ++(s->ct);
+    }
+
+  a[q] = x;
+  s->ring[s->head] = x;
+  s->head = (s->head + 1) % s->n;
+
+  return GSL_SUCCESS;
+}
+
+static int
+sortwin_delete_oldest(sortwin * s)
+{
+  if (s->ct > 0)
+    {
+      const double old = s->ring[(s->head - s->ct + s->n) % s->n];
+      int p = sortwin_upper(old, s->sorted, s->ct) - 1;
+
+      memmove(s->sorted + p, s->sorted + p + 1, (s->ct - p - 1) * sizeof(double));
+      --(s->ct);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* return k-th smallest sample in window, k = 0, ..., ct - 1 */
+static double
+sortwin_select(const int k, const sortwin * s)
+{
+  return s->sorted[k];
+}
+
+/* return number of elements of sorted array a[0..n-1] which are <= x */
+static int
+sortwin_upper(const double x, const double * a, const int n)
+{
+  int lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      int mid = (lo + hi) / 2;
+
+      if (!MOVSTAT_LESS(x, a[mid]))
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
+
+#endif /* __GSL_SORTWIN_C__ */
@@ -0,0 +1,282 @@
+/* movstat/stream.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_movstat.h>
+
+/*
+ * Streaming interface to moving window statistics. The input is
+ * supplied in chunks of arbitrary size, and the accumulator state
+ * is kept in the workspace between calls. The sequence of accumulator
+ * operations is identical to gsl_movstat_apply_accum(), so that the
+ * concatenated output of a stream is the same as the output of the
+ * corresponding batch routine applied to the concatenated input.
+ */
+
+/* store the last K samples for truncated windows at the end of the stream */
+#define STREAM_NEED_HISTORY(endtype, accum) \
+  ((endtype) == GSL_MOVSTAT_END_TRUNCATE && (accum)->delete_oldest == NULL)
+
+static void stream_output(const gsl_movstat_accum * accum, void * accum_params,
+                          gsl_vector * y, gsl_vector * z, const size_t idx,
+                          const gsl_movstat_workspace * w);
+
+/*
+gsl_movstat_stream_reset()
+  Discard any stream in progress, so that the next call to
+gsl_movstat_stream_accum() begins a new stream
+*/
+
+int
+gsl_movstat_stream_reset(gsl_movstat_workspace * w)
+{
+  w->nstream = 0;
+  w->xlast = 0.0;
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_movstat_stream_accum()
+  Process the next chunk of a data stream. Since the window around
+sample x_i extends J samples into the future, y_i is available only
+after x_{i+J} has been received. Therefore a chunk of length m
+produces between m - J and m outputs, which are the next values of the
+output sequence.
+
+Inputs: endtype      - end point handling criteria; must be the same
+                       for all calls belonging to one stream
+        x            - next chunk of input stream, size m
+        accum        - accumulator to apply moving window statistic
+        accum_params - parameters to pass to accumulator
+        y            - (output) next outputs in y(0:ny-1), size at least m
+        z            - second output vector (i.e. minmax), size at least m; can be NULL
+        ny           - (output) number of outputs stored in y
+        w            - workspace
+
+Notes:
+1) It is allowed to have x = y for in-place moving statistics
+2) No memory is allocated
+*/
+
+int
+gsl_movstat_stream_accum(const gsl_movstat_end_t endtype,
+                         const gsl_vector * x,
+                         const gsl_movstat_accum * accum,
+                         void * accum_params,
+                         gsl_vector * y,
+                         gsl_vector * z,
+                         size_t * ny,
+                         gsl_movstat_workspace * w)
+{
+  if (y->size < x->size)
+    {
+      GSL_ERROR("output vector must be at least as long as input", GSL_EBADLEN);
+    }
+  else if (z != NULL && z->size < x->size)
+    {
+      GSL_ERROR("output vector must be at least as long as input", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t m = x->size;
+      const int save = STREAM_NEED_HISTORY(endtype, accum);
+      size_t i;
+
+      *ny = 0;
+
+      if (m == 0)
+        return GSL_SUCCESS;
+
+      if (w->nstream == 0)
+        {
+          /* start of a new stream: initialize accumulator */
+          (accum->init)(w->K, w->state);
+
+          if (endtype != GSL_MOVSTAT_END_TRUNCATE)
+            {
+              double x1 = (endtype == GSL_MOVSTAT_END_PADVALUE) ? gsl_vector_get(x, 0) : 0.0;
+
+              /* pad initial windows with H values */
+              for (i = 0; i < w->H; ++i)
+                (accum->insert)(x1, w->state);
+            }
+        }
+
+      for (i = 0; i < m; ++i)
+        {
+          double xi = gsl_vector_get(x, i);
+
+          (accum->insert)(xi, w->state);
+
+          if (save)
+            w->work[w->nstream % w->K] = xi;
+
+          if (w->nstream >= w->J)
+            stream_output(accum, accum_params, y, z, (*ny)++, w);
+
+          ++(w->nstream);
+        }
+
+      w->xlast = gsl_vector_get(x, m - 1);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_movstat_stream_finish()
+  Finish a data stream by computing the last min(J, n) outputs, where
+n is the total number of samples in the stream, using the end point
+handling given by endtype. The workspace is then ready for a new
+stream.
+
+Inputs: endtype      - end point handling criteria
+        accum        - accumulator to apply moving window statistic
+        accum_params - parameters to pass to accumulator
+        y            - (output) final outputs in y(0:ny-1), size at least min(J, n)
+        z            - second output vector (i.e. minmax); can be NULL
+        ny           - (output) number of outputs stored in y
+        w            - workspace
+*/
+
+int
+gsl_movstat_stream_finish(const gsl_movstat_end_t endtype,
+                          const gsl_movstat_accum * accum,
+                          void * accum_params,
+                          gsl_vector * y,
+                          gsl_vector * z,
+                          size_t * ny,
+                          gsl_movstat_workspace * w)
+{
+  const size_t n = w->nstream;
+  const size_t nout = GSL_MIN(w->J, n);
+
+  if (y->size < nout)
+    {
+      GSL_ERROR("output vector too short for remaining samples", GSL_EBADLEN);
+    }
+  else if (z != NULL && z->size < nout)
+    {
+      GSL_ERROR("output vector too short for remaining samples", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t H = w->H;
+      const size_t K = w->K;
+      size_t i;
+
+      *ny = 0;
+
+      if (n == 0)
+        return GSL_SUCCESS;
+
+      if (endtype == GSL_MOVSTAT_END_TRUNCATE)
+        {
+          /* fill y(n-J:n-1) using shrinking windows */
+          if (accum->delete_oldest == NULL)
+            {
+              for (i = n - nout; i < n; ++i)
+                {
+                  /* window contains x(max(i-H,0):n-1) */
+                  size_t j = (i > H) ? i - H : 0;
+
+                  (accum->init)(K, w->state);
+
+                  for ( ; j < n; ++j)
+                    (accum->insert)(w->work[j % K], w->state);
+
+                  stream_output(accum, accum_params, y, z, (*ny)++, w);
+                }
+            }
+          else
+            {
+              for (i = n - nout; i < n; ++i)
+                {
+                  if (i > H)
+                    {
+                      /* delete oldest window sample as we move closer to edge */
+                      (accum->delete_oldest)(w->state);
+                    }
+
+                  stream_output(accum, accum_params, y, z, (*ny)++, w);
+                }
+            }
+        }
+      else
+        {
+          const double xN = (endtype == GSL_MOVSTAT_END_PADVALUE) ? w->xlast : 0.0;
+
+          /* pad final windows */
+          for (i = 0; i < w->J; ++i)
+            {
+              (accum->insert)(xN, w->state);
+
+              if (n + i >= w->J)
+                stream_output(accum, accum_params, y, z, (*ny)++, w);
+            }
+        }
+
+      gsl_movstat_stream_reset(w);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_movstat_stream_apply()
+  Process the next chunk of a data stream with a user-defined moving
+window function; see gsl_movstat_stream_accum()
+*/
+
+int
+gsl_movstat_stream_apply(const gsl_movstat_end_t endtype, const gsl_movstat_function * F,
+                         const gsl_vector * x, gsl_vector * y, size_t * ny,
+                         gsl_movstat_workspace * w)
+{
+  int status = gsl_movstat_stream_accum(endtype, x, gsl_movstat_accum_userfunc, (void *) F, y, NULL, ny, w);
+  return status;
+}
+
+int
+gsl_movstat_stream_apply_finish(const gsl_movstat_end_t endtype, const gsl_movstat_function * F,
+                                gsl_vector * y, size_t * ny, gsl_movstat_workspace * w)
+{
+  int status = gsl_movstat_stream_finish(endtype, gsl_movstat_accum_userfunc, (void *) F, y, NULL, ny, w);
+  return status;
+}
+
+/* compute the current window statistic and store it in y(idx) and z(idx) */
+static void
+stream_output(const gsl_movstat_accum * accum, void * accum_params,
+              gsl_vector * y, gsl_vector * z, const size_t idx,
+              const gsl_movstat_workspace * w)
+{
+  double result[2];
+
+  (accum->get)(accum_params, result, w->state);
+  gsl_vector_set(y, idx, result[0]);
+
+  if (z != NULL)
+    gsl_vector_set(z, idx, result[1]);
+}
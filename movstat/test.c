@@ -79,11 +79,13 @@ test_noisy_sine(const double sigma, gsl_vector * x, gsl_rng * r)
 }
 
 #include "test_mad.c"
+#include "test_matrix.c"
 #include "test_mean.c"
 #include "test_median.c"
 #include "test_minmax.c"
 #include "test_Qn.c"
 #include "test_qqr.c"
+#include "test_stream.c"
 #include "test_sum.c"
 #include "test_Sn.c"
 #include "test_variance.c"
@@ -102,6 +104,8 @@ main()
   test_sum(r);
   test_Sn(r);
   test_variance(r);
+  test_stream(r);
+  test_matrix(r);
 
   gsl_rng_free(r);
 
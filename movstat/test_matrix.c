@@ -0,0 +1,115 @@
+/* movstat/test_matrix.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_movstat.h>
+
+typedef int (*movstat_vector_func) (const gsl_movstat_end_t endtype, const gsl_vector * x,
+                                    gsl_vector * y, gsl_movstat_workspace * w);
+typedef int (*movstat_matrix_func) (const gsl_movstat_end_t endtype, const gsl_matrix * X,
+                                    gsl_matrix * Y, gsl_movstat_matrix_workspace * w);
+
+/* compare multichannel routine against single channel routine applied to each column */
+static void
+test_matrix_proc(const double tol, const size_t n, const size_t nchan, const size_t H, const size_t J,
+                 const gsl_movstat_end_t etype, movstat_vector_func vfunc, movstat_matrix_func mfunc,
+                 const char * name, gsl_rng * rng_p)
+{
+  gsl_movstat_workspace * w = gsl_movstat_alloc2(H, J);
+  gsl_movstat_matrix_workspace * mw = gsl_movstat_matrix_alloc2(H, J, nchan + 1);
+  gsl_matrix * X = gsl_matrix_alloc(n, nchan);
+  gsl_matrix * Y = gsl_matrix_alloc(n, nchan);
+  gsl_matrix * Z = gsl_matrix_alloc(n, nchan);
+  size_t i, j;
+
+  for (j = 0; j < nchan; ++j)
+    {
+      gsl_vector_view x = gsl_matrix_column(X, j);
+      gsl_vector_view y = gsl_matrix_column(Y, j);
+
+      random_vector(&x.vector, rng_p);
+      vfunc(etype, &x.vector, &y.vector, w);
+    }
+
+  /* Z = f(X) */
+  mfunc(etype, X, Z, mw);
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < nchan; ++j)
+        {
+          gsl_test_abs(gsl_matrix_get(Z, i, j), gsl_matrix_get(Y, i, j), tol,
+                       "%s matrix n=%zu nchan=%zu H=%zu J=%zu endtype=%u i=%zu j=%zu",
+                       name, n, nchan, H, J, etype, i, j);
+        }
+    }
+
+  /* Z = f(Z) in-place */
+  gsl_matrix_memcpy(Z, X);
+  mfunc(etype, Z, Z, mw);
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < nchan; ++j)
+        {
+          gsl_test_abs(gsl_matrix_get(Z, i, j), gsl_matrix_get(Y, i, j), tol,
+                       "%s matrix in-place n=%zu nchan=%zu H=%zu J=%zu endtype=%u i=%zu j=%zu",
+                       name, n, nchan, H, J, etype, i, j);
+        }
+    }
+
+  gsl_matrix_free(X);
+  gsl_matrix_free(Y);
+  gsl_matrix_free(Z);
+  gsl_movstat_free(w);
+  gsl_movstat_matrix_free(mw);
+}
+
+static void
+test_matrix_func(const double tol, movstat_vector_func vfunc, movstat_matrix_func mfunc,
+                 const char * name, gsl_rng * rng_p)
+{
+  const gsl_movstat_end_t etypes[] = { GSL_MOVSTAT_END_PADZERO,
+                                       GSL_MOVSTAT_END_PADVALUE,
+                                       GSL_MOVSTAT_END_TRUNCATE };
+  size_t i;
+
+  for (i = 0; i < 3; ++i)
+    {
+      test_matrix_proc(tol, 1, 1, 0, 0, etypes[i], vfunc, mfunc, name, rng_p);
+      test_matrix_proc(tol, 5, 3, 4, 6, etypes[i], vfunc, mfunc, name, rng_p);
+      test_matrix_proc(tol, 100, 7, 0, 3, etypes[i], vfunc, mfunc, name, rng_p);
+      test_matrix_proc(tol, 100, 8, 5, 0, etypes[i], vfunc, mfunc, name, rng_p);
+      test_matrix_proc(tol, 200, 16, 5, 5, etypes[i], vfunc, mfunc, name, rng_p);
+      test_matrix_proc(tol, 300, 5, 12, 3, etypes[i], vfunc, mfunc, name, rng_p);
+    }
+}
+
+static void
+test_matrix(gsl_rng * rng_p)
+{
+  test_matrix_func(1.0e-12, gsl_movstat_mean, gsl_movstat_matrix_mean, "mean", rng_p);
+  test_matrix_func(1.0e-12, gsl_movstat_sum, gsl_movstat_matrix_sum, "sum", rng_p);
+  test_matrix_func(0.0, gsl_movstat_min, gsl_movstat_matrix_min, "min", rng_p);
+  test_matrix_func(0.0, gsl_movstat_max, gsl_movstat_matrix_max, "max", rng_p);
+}
@@ -132,6 +132,33 @@ test_median_proc(const double tol, const size_t n, const size_t H, const size_t
   gsl_movstat_free(w);
 }
 
+/* test moving median of input with many repeated values */
+static void
+test_median_ties(const double tol, const size_t n, const size_t H, const size_t J,
+                 const gsl_movstat_end_t etype, gsl_rng *rng_p)
+{
+  gsl_movstat_workspace *w = gsl_movstat_alloc2(H, J);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *z = gsl_vector_alloc(n);
+  char buf[2048];
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    gsl_vector_set(x, i, (double) gsl_rng_uniform_int(rng_p, 5));
+
+  slow_movmedian(etype, x, y, H, J);
+  gsl_movstat_median(etype, x, z, w);
+
+  sprintf(buf, "n=%zu H=%zu J=%zu endtype=%u median ties", n, H, J, etype);
+  compare_vectors(tol, z, y, buf);
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(z);
+  gsl_movstat_free(w);
+}
+
 static void
 test_median(gsl_rng * rng_p)
 {
@@ -174,4 +201,15 @@ test_median(gsl_rng * rng_p)
   test_median_proc(GSL_DBL_EPSILON, 50, 100, 150, GSL_MOVSTAT_END_TRUNCATE, rng_p);
   test_median_proc(GSL_DBL_EPSILON, 50, 150, 100, GSL_MOVSTAT_END_TRUNCATE, rng_p);
   test_median_proc(GSL_DBL_EPSILON, 50, 100, 100, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+
+  /* large windows */
+  test_median_proc(GSL_DBL_EPSILON, 3000, 1200, 1000, GSL_MOVSTAT_END_PADZERO, rng_p);
+  test_median_proc(GSL_DBL_EPSILON, 3000, 1000, 1200, GSL_MOVSTAT_END_PADVALUE, rng_p);
+  test_median_proc(GSL_DBL_EPSILON, 3000, 1100, 1100, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+
+  test_median_ties(GSL_DBL_EPSILON, 1000, 3, 4, GSL_MOVSTAT_END_PADZERO, rng_p);
+  test_median_ties(GSL_DBL_EPSILON, 1000, 10, 7, GSL_MOVSTAT_END_PADVALUE, rng_p);
+  test_median_ties(GSL_DBL_EPSILON, 1000, 8, 8, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+  test_median_ties(GSL_DBL_EPSILON, 1000, 0, 25, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+  test_median_ties(GSL_DBL_EPSILON, 3000, 1000, 1200, GSL_MOVSTAT_END_TRUNCATE, rng_p);
 }
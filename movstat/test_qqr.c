@@ -110,6 +110,33 @@ test_qqr_proc(const double tol, const double q, const size_t n, const size_t H,
   gsl_vector_free(z);
 }
 
+/* test moving QQR of input with many repeated values */
+static void
+test_qqr_ties(const double tol, const double q, const size_t n, const size_t H, const size_t J,
+              const gsl_movstat_end_t etype, gsl_rng * rng_p)
+{
+  gsl_movstat_workspace * w = gsl_movstat_alloc2(H, J);
+  gsl_vector * x = gsl_vector_alloc(n);
+  gsl_vector * y = gsl_vector_alloc(n);
+  gsl_vector * z = gsl_vector_alloc(n);
+  char buf[2048];
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    gsl_vector_set(x, i, (double) gsl_rng_uniform_int(rng_p, 5));
+
+  slow_movqqr(etype, q, x, y, H, J);
+  gsl_movstat_qqr(etype, x, q, z, w);
+
+  sprintf(buf, "n=%zu H=%zu J=%zu endtype=%u QQR ties", n, H, J, etype);
+  compare_vectors(tol, z, y, buf);
+
+  gsl_movstat_free(w);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(z);
+}
+
 static void
 test_qqr(gsl_rng * rng_p)
 {
@@ -144,4 +171,14 @@ test_qqr(gsl_rng * rng_p)
   test_qqr_proc(eps, 0.25, 20, 50, 50, GSL_MOVSTAT_END_TRUNCATE, rng_p);
   test_qqr_proc(eps, 0.25, 20, 10, 50, GSL_MOVSTAT_END_TRUNCATE, rng_p);
   test_qqr_proc(eps, 0.25, 20, 50, 10, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+
+  /* large windows */
+  test_qqr_proc(eps, 0.25, 3000, 1200, 1000, GSL_MOVSTAT_END_PADZERO, rng_p);
+  test_qqr_proc(eps, 0.1, 3000, 1000, 1200, GSL_MOVSTAT_END_PADVALUE, rng_p);
+  test_qqr_proc(eps, 0.3, 3000, 1100, 1100, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+
+  test_qqr_ties(eps, 0.25, 1000, 3, 4, GSL_MOVSTAT_END_PADZERO, rng_p);
+  test_qqr_ties(eps, 0.1, 1000, 10, 7, GSL_MOVSTAT_END_PADVALUE, rng_p);
+  test_qqr_ties(eps, 0.25, 1000, 8, 8, GSL_MOVSTAT_END_TRUNCATE, rng_p);
+  test_qqr_ties(eps, 0.3, 3000, 1000, 1200, GSL_MOVSTAT_END_TRUNCATE, rng_p);
 }
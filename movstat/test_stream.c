@@ -0,0 +1,142 @@
+/* movstat/test_stream.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_movstat.h>
+
+/* process x in randomly sized chunks through the streaming interface
+   and compare with the batch routine */
+static void
+test_stream_proc(const size_t n, const size_t H, const size_t J,
+                 const gsl_movstat_end_t etype, const gsl_movstat_accum * accum,
+                 void * accum_params, const char * name, gsl_rng * rng_p)
+{
+  gsl_movstat_workspace * w = gsl_movstat_alloc2(H, J);
+  gsl_vector * x = gsl_vector_alloc(n);
+  gsl_vector * y = gsl_vector_alloc(n);
+  gsl_vector * z = gsl_vector_alloc(n);
+  gsl_vector * u = gsl_vector_alloc(n + J + 1);
+  gsl_vector * v = gsl_vector_alloc(n + J + 1);
+  size_t nout = 0, start = 0, ny;
+  size_t i;
+
+  random_vector(x, rng_p);
+
+  /* batch computation */
+  gsl_movstat_apply_accum(etype, x, accum, accum_params, y, z, w);
+
+  /* streaming computation with chunks of size 0 to 2K */
+  while (start < n)
+    {
+      size_t r = gsl_rng_uniform_int(rng_p, 2 * w->K + 1);
+      size_t m = GSL_MIN(r, n - start);
+      gsl_vector_const_view xc = gsl_vector_const_subvector(x, start, m);
+      gsl_vector_view uc = gsl_vector_subvector(u, nout, GSL_MAX(m, 1));
+      gsl_vector_view vc = gsl_vector_subvector(v, nout, GSL_MAX(m, 1));
+
+      gsl_movstat_stream_accum(etype, &xc.vector, accum, accum_params, &uc.vector, &vc.vector, &ny, w);
+
+      gsl_test(ny > m, "%s stream n=%zu H=%zu J=%zu endtype=%u ny=%zu m=%zu",
+               name, n, H, J, etype, ny, m);
+
+      nout += ny;
+      start += m;
+    }
+
+  gsl_test_int(nout, n - GSL_MIN(n, J), "%s stream n=%zu H=%zu J=%zu endtype=%u delay",
+               name, n, H, J, etype);
+
+  {
+    gsl_vector_view uc = gsl_vector_subvector(u, nout, GSL_MAX(J, 1));
+    gsl_vector_view vc = gsl_vector_subvector(v, nout, GSL_MAX(J, 1));
+
+    gsl_movstat_stream_finish(etype, accum, accum_params, &uc.vector, &vc.vector, &ny, w);
+    nout += ny;
+  }
+
+  gsl_test_int(nout, n, "%s stream n=%zu H=%zu J=%zu endtype=%u nout", name, n, H, J, etype);
+
+  for (i = 0; i < n; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(u, i), gsl_vector_get(y, i), GSL_DBL_EPSILON,
+                   "%s stream n=%zu H=%zu J=%zu endtype=%u i=%zu", name, n, H, J, etype, i);
+
+      if (accum == gsl_movstat_accum_minmax || accum == gsl_movstat_accum_mad)
+        gsl_test_rel(gsl_vector_get(v, i), gsl_vector_get(z, i), GSL_DBL_EPSILON,
+                     "%s stream n=%zu H=%zu J=%zu endtype=%u z i=%zu", name, n, H, J, etype, i);
+    }
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(z);
+  gsl_vector_free(u);
+  gsl_vector_free(v);
+  gsl_movstat_free(w);
+}
+
+static void
+test_stream_accum(const gsl_movstat_accum * accum, void * accum_params,
+                  const char * name, gsl_rng * rng_p)
+{
+  const gsl_movstat_end_t etypes[] = { GSL_MOVSTAT_END_PADZERO,
+                                       GSL_MOVSTAT_END_PADVALUE,
+                                       GSL_MOVSTAT_END_TRUNCATE };
+  size_t i;
+
+  for (i = 0; i < 3; ++i)
+    {
+      test_stream_proc(1, 0, 0, etypes[i], accum, accum_params, name, rng_p);
+      test_stream_proc(3, 5, 4, etypes[i], accum, accum_params, name, rng_p);
+      test_stream_proc(100, 0, 4, etypes[i], accum, accum_params, name, rng_p);
+      test_stream_proc(100, 7, 0, etypes[i], accum, accum_params, name, rng_p);
+      test_stream_proc(500, 5, 5, etypes[i], accum, accum_params, name, rng_p);
+      test_stream_proc(500, 3, 12, etypes[i], accum, accum_params, name, rng_p);
+      test_stream_proc(1000, 20, 9, etypes[i], accum, accum_params, name, rng_p);
+    }
+}
+
+static double
+func_stream_max(const size_t n, double x[], void * params)
+{
+  (void) params;
+  return gsl_stats_max(x, 1, n);
+}
+
+static void
+test_stream(gsl_rng * rng_p)
+{
+  gsl_movstat_function F;
+  double q = 0.25;
+  double scale = 1.0;
+
+  F.function = func_stream_max;
+  F.params = NULL;
+
+  test_stream_accum(gsl_movstat_accum_mean, NULL, "mean", rng_p);
+  test_stream_accum(gsl_movstat_accum_sum, NULL, "sum", rng_p);
+  test_stream_accum(gsl_movstat_accum_variance, NULL, "variance", rng_p);
+  test_stream_accum(gsl_movstat_accum_minmax, NULL, "minmax", rng_p);
+  test_stream_accum(gsl_movstat_accum_median, NULL, "median", rng_p);
+  test_stream_accum(gsl_movstat_accum_mad, &scale, "mad", rng_p);
+  test_stream_accum(gsl_movstat_accum_qqr, &q, "qqr", rng_p);
+  test_stream_accum(gsl_movstat_accum_userfunc, &F, "userfunc", rng_p);
+}
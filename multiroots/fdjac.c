@@ -109,3 +109,211 @@ gsl_multiroot_fdjacobian (gsl_multiroot_function * F,
   else
     return GSL_SUCCESS;
 }
+
+static void
+fdjac_set (const gsl_vector * x, const gsl_vector * x1,
+           const gsl_vector * f, const gsl_vector * f1,
+           const size_t i, const size_t j, gsl_matrix * jacobian)
+{
+  /* the element (i,j) only depends on the perturbation of x_j */
+
+  double dx = gsl_vector_get (x1, j) - gsl_vector_get (x, j);
+  double g1 = gsl_vector_get (f1, i);
+  double g0 = gsl_vector_get (f, i);
+
+  gsl_matrix_set (jacobian, i, j, (g1 - g0) / dx);
+}
+
+/* Finite difference jacobian with a known sparsity pattern. The
+   columns are grouped by colors[j] (for example from
+   gsl_spmatrix_color_columns) such that columns of the same group
+   have no non-zero rows in common. All columns of a group are
+   perturbed together, so only ncolors function evaluations are
+   needed. Elements outside the pattern are set to zero. */
+
+int
+gsl_multiroot_fdjacobian_colored (gsl_multiroot_function * F,
+                                  const gsl_vector * x, const gsl_vector * f,
+                                  double epsrel, const gsl_spmatrix * pattern,
+                                  const size_t colors[], const size_t ncolors,
+                                  gsl_matrix * jacobian)
+{
+  const size_t n = x->size;
+  const size_t m = f->size;
+  const size_t n1 = jacobian->size1;
+  const size_t n2 = jacobian->size2;
+  int status = 0;
+
+  if (m != n1 || n != n2)
+    {
+      GSL_ERROR ("function and jacobian are not conformant", GSL_EBADLEN);
+    }
+
+  if (pattern->size1 != m || pattern->size2 != n)
+    {
+      GSL_ERROR ("pattern and jacobian are not conformant", GSL_EBADLEN);
+    }
+
+  {
+    size_t j;
+
+    for (j = 0; j < n; j++)
+      {
+        if (colors[j] >= ncolors)
+          {
+            GSL_ERROR ("column color must be less than ncolors", GSL_EINVAL);
+          }
+      }
+  }
+
+  {
+    size_t i, j, k, c;
+    gsl_vector *x1, *f1;
+
+    x1 = gsl_vector_alloc (n);
+
+    if (x1 == 0)
+      {
+        GSL_ERROR ("failed to allocate space for x1 workspace", GSL_ENOMEM);
+      }
+
+    f1 = gsl_vector_alloc (m);
+
+    if (f1 == 0)
+      {
+        gsl_vector_free (x1);
+
+        GSL_ERROR ("failed to allocate space for f1 workspace", GSL_ENOMEM);
+      }
+
+    gsl_vector_memcpy (x1, x);  /* copy x into x1 */
+    gsl_matrix_set_zero (jacobian);
+
+    for (c = 0; c < ncolors; c++)
+      {
+        /* perturb all columns of group c */
+
+        for (j = 0; j < n; j++)
+          {
+            if (colors[j] == c)
+              {
+                double xj = gsl_vector_get (x, j);
+                double dx = epsrel * fabs (xj);
+
+                if (dx == 0)
+                  {
+                    dx = epsrel;
+                  }
+
+                gsl_vector_set (x1, j, xj + dx);
+              }
+          }
+
+        {
+          int f_stat = GSL_MULTIROOT_FN_EVAL (F, x1, f1);
+
+          if (f_stat != GSL_SUCCESS) 
+            {
+              status = GSL_EBADFUNC;
+              break; /* x1 and f1 are freed below */
+            }
+        }
+
+        /* fill the pattern elements of the columns of group c */
+
+        if (GSL_SPMATRIX_ISCOO (pattern))
+          {
+            for (k = 0; k < pattern->nz; k++)
+              {
+                i = pattern->i[k];
+                j = pattern->p[k];
+
+                if (colors[j] == c)
+                  fdjac_set (x, x1, f, f1, i, j, jacobian);
+              }
+          }
+        else if (GSL_SPMATRIX_ISCSC (pattern))
+          {
+            for (j = 0; j < n; j++)
+              {
+                if (colors[j] != c)
+                  continue;
+
+                for (k = pattern->p[j]; k < (size_t) pattern->p[j + 1]; k++)
+                  fdjac_set (x, x1, f, f1, pattern->i[k], j, jacobian);
+              }
+          }
+        else
+          {
+            for (i = 0; i < m; i++)
+              {
+                for (k = pattern->p[i]; k < (size_t) pattern->p[i + 1]; k++)
+                  {
+                    j = pattern->i[k];
+
+                    if (colors[j] == c)
+                      fdjac_set (x, x1, f, f1, i, j, jacobian);
+                  }
+              }
+          }
+
+        for (j = 0; j < n; j++)
+          {
+            if (colors[j] == c)
+              {
+                gsl_vector_set (x1, j, gsl_vector_get (x, j));
+              }
+          }
+      }
+
+    if (status == 0)
+      {
+        /* mark the columns with pattern elements in x1, which is no
+           longer needed; a structurally empty column is zero by
+           definition and is not checked */
+
+        gsl_vector_set_zero (x1);
+
+        if (GSL_SPMATRIX_ISCSR (pattern))
+          {
+            for (k = 0; k < pattern->nz; k++)
+              gsl_vector_set (x1, pattern->i[k], 1.0);
+          }
+        else if (GSL_SPMATRIX_ISCSC (pattern))
+          {
+            for (j = 0; j < n; j++)
+              {
+                if (pattern->p[j + 1] > pattern->p[j])
+                  gsl_vector_set (x1, j, 1.0);
+              }
+          }
+        else
+          {
+            for (k = 0; k < pattern->nz; k++)
+              gsl_vector_set (x1, pattern->p[k], 1.0);
+          }
+
+        for (j = 0; j < n; j++)
+          {
+            gsl_vector_view col = gsl_matrix_column (jacobian, j);
+
+            /* if a column with pattern elements is null, return an
+               error - this may be due to dx being too small. Try
+               increasing epsrel */
+            if (gsl_vector_get (x1, j) != 0.0 &&
+                gsl_vector_isnull (&col.vector))
+              {
+                status = GSL_ESING;
+              }
+          }
+      }
+
+    gsl_vector_free (x1);
+    gsl_vector_free (f1);
+  }
+
+  if (status)
+    return status;
+  else
+    return GSL_SUCCESS;
+}
@@ -25,6 +25,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_vector.h>
 #include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -55,6 +56,14 @@ int gsl_multiroot_fdjacobian (gsl_multiroot_function * F,
                               const gsl_vector * x, const gsl_vector * f,
                               double epsrel, gsl_matrix * jacobian);
 
+int gsl_multiroot_fdjacobian_colored (gsl_multiroot_function * F,
+                                      const gsl_vector * x,
+                                      const gsl_vector * f, double epsrel,
+                                      const gsl_spmatrix * pattern,
+                                      const size_t colors[],
+                                      const size_t ncolors,
+                                      gsl_matrix * jacobian);
+
 
 typedef struct
   {
@@ -29,6 +29,7 @@
 #include "test_funcs.h"
 int test_fdf (const char * desc, gsl_multiroot_function_fdf * function, initpt_function initpt, double factor, const gsl_multiroot_fdfsolver_type * T);
 int test_f (const char * desc, gsl_multiroot_function_fdf * fdf, initpt_function initpt, double factor, const gsl_multiroot_fsolver_type * T);
+void test_fdjac_colored (const char * desc, gsl_multiroot_function_fdf * fdf, initpt_function initpt, const int sptype);
 
 
 int 
@@ -91,6 +92,10 @@ main (void)
       T2++;
     }
 
+  test_fdjac_colored ("Discrete BVP", &dbv, dbv_initpt, GSL_SPMATRIX_COO);
+  test_fdjac_colored ("Discrete BVP", &dbv, dbv_initpt, GSL_SPMATRIX_CSC);
+  test_fdjac_colored ("Discrete BVP", &dbv, dbv_initpt, GSL_SPMATRIX_CSR);
+
   exit (gsl_test_summary ());
 }
 
@@ -258,3 +263,107 @@ test_f (const char * desc, gsl_multiroot_function_fdf * fdf,
 
   return status;
 }
+
+
+void
+test_fdjac_colored (const char * desc, gsl_multiroot_function_fdf * fdf,
+                    initpt_function initpt, const int sptype)
+{
+  /* compare the colored finite difference jacobian with the
+     analytic one, using the non-zero pattern of the latter */
+
+  int status;
+  size_t i, j, n = fdf->n, ncolors;
+
+  gsl_vector *x = gsl_vector_alloc (n);
+  gsl_vector *f = gsl_vector_alloc (n);
+  gsl_matrix *J = gsl_matrix_alloc (n, n);
+  gsl_matrix *Jfd = gsl_matrix_alloc (n, n);
+  gsl_spmatrix *P = gsl_spmatrix_alloc (n, n);
+  gsl_spmatrix *Pc;
+  size_t *colors = malloc (n * sizeof (size_t));
+
+  gsl_multiroot_function F;
+  F.f = fdf->f;
+  F.n = fdf->n;
+  F.params = fdf->params;
+
+  (*initpt) (x);
+  GSL_MULTIROOT_FN_EVAL (&F, x, f);
+  (*(fdf->df)) (x, fdf->params, J);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n; j++)
+      {
+        if (gsl_matrix_get (J, i, j) != 0.0)
+          gsl_spmatrix_set (P, i, j, 1.0);
+      }
+
+  Pc = gsl_spmatrix_compress (P, sptype);
+  gsl_spmatrix_color_columns (Pc, colors, &ncolors);
+
+  status = gsl_multiroot_fdjacobian_colored (&F, x, f, GSL_SQRT_DBL_EPSILON,
+                                             Pc, colors, ncolors, Jfd);
+  gsl_test (status, "fdjacobian_colored on %s (%s), %u colors", desc,
+            gsl_spmatrix_type (Pc), (unsigned int) ncolors);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n; j++)
+      {
+        gsl_test_abs (gsl_matrix_get (Jfd, i, j), gsl_matrix_get (J, i, j),
+                      1e-6, "fdjacobian_colored on %s (%s) J(%u,%u)", desc,
+                      gsl_spmatrix_type (Pc), (unsigned int) i,
+                      (unsigned int) j);
+      }
+
+  /* a color out of range is rejected */
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+    const size_t c0 = colors[0];
+
+    colors[0] = ncolors;
+    status = gsl_multiroot_fdjacobian_colored (&F, x, f, GSL_SQRT_DBL_EPSILON,
+                                               Pc, colors, ncolors, Jfd);
+    gsl_test_int (status, GSL_EINVAL, "fdjacobian_colored on %s (%s), "
+                  "invalid color", desc, gsl_spmatrix_type (Pc));
+    colors[0] = c0;
+
+    gsl_set_error_handler (old_handler);
+  }
+
+  gsl_spmatrix_free (Pc);
+
+  /* a column without pattern elements is zero, not singular */
+  gsl_spmatrix_set_zero (P);
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n - 1; j++)
+      {
+        if (gsl_matrix_get (J, i, j) != 0.0)
+          gsl_spmatrix_set (P, i, j, 1.0);
+      }
+
+  Pc = gsl_spmatrix_compress (P, sptype);
+  gsl_spmatrix_color_columns (Pc, colors, &ncolors);
+
+  status = gsl_multiroot_fdjacobian_colored (&F, x, f, GSL_SQRT_DBL_EPSILON,
+                                             Pc, colors, ncolors, Jfd);
+  gsl_test (status, "fdjacobian_colored on %s (%s), empty column", desc,
+            gsl_spmatrix_type (Pc));
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_test_abs (gsl_matrix_get (Jfd, i, n - 1), 0.0, 0.0,
+                    "fdjacobian_colored on %s (%s) empty column J(%u,%u)",
+                    desc, gsl_spmatrix_type (Pc), (unsigned int) i,
+                    (unsigned int) (n - 1));
+    }
+
+  free (colors);
+  gsl_spmatrix_free (P);
+  gsl_spmatrix_free (Pc);
+  gsl_matrix_free (Jfd);
+  gsl_matrix_free (J);
+  gsl_vector_free (f);
+  gsl_vector_free (x);
+}
@@ -0,0 +1,788 @@
+/* ntuple/column.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Columnar ntuple files. Rows are collected in memory and written in
+ * chunks of at most chunk_size rows; within a chunk the values of each
+ * column are stored contiguously, optionally compressed, and the chunk
+ * header records the stored size and the minimum and maximum of every
+ * column. A projection therefore reads only the columns it needs, and
+ * skips whole chunks whose column ranges cannot match the selection.
+ *
+ * File layout (native byte order and type sizes, as for gsl_ntuple):
+ *
+ *   "GSLNTCOL", size, ncols, chunk_size, flags,
+ *   ncols x { type, offset }
+ *
+ * followed by the chunks
+ *
+ *   nrows, ncols x { nbytes, min, max }, ncols x { column data }
+ *
+ * A column is stored uncompressed when nbytes = nrows * width.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_ntuple.h>
+
+#include "rle.c"
+#include "fileoff.c"
+
+static const char ntcol_magic[8] = { 'G', 'S', 'L', 'N', 'T', 'C', 'O', 'L' };
+
+static gsl_ntuple_col * ntcol_alloc (void * ntuple_data, size_t size,
+                                     const gsl_ntuple_column cols[],
+                                     const size_t ncols, const size_t chunk_size,
+                                     const int flags);
+static void ntcol_free (gsl_ntuple_col * ntuple);
+static int ntcol_flush (gsl_ntuple_col * ntuple);
+static int ntcol_read_header (gsl_ntuple_col * ntuple);
+static int ntcol_read_column (gsl_ntuple_col * ntuple, const size_t j);
+static void ntcol_get_row (gsl_ntuple_col * ntuple, const size_t row,
+                           const char * want);
+
+static size_t
+ntcol_width (const gsl_ntuple_type type)
+{
+  switch (type)
+    {
+    case GSL_NTUPLE_DOUBLE:
+      return sizeof (double);
+    case GSL_NTUPLE_FLOAT:
+      return sizeof (float);
+    case GSL_NTUPLE_INT:
+      return sizeof (int);
+    case GSL_NTUPLE_LONG:
+      return sizeof (long);
+    default:
+      return 0;
+    }
+}
+
+static double
+ntcol_value (const gsl_ntuple_type type, const unsigned char * p)
+{
+  switch (type)
+    {
+    case GSL_NTUPLE_DOUBLE:
+      {
+        double x;
+        memcpy (&x, p, sizeof (double));
+        return x;
+      }
+    case GSL_NTUPLE_FLOAT:
+      {
+        float x;
+        memcpy (&x, p, sizeof (float));
+        return (double) x;
+      }
+    case GSL_NTUPLE_INT:
+      {
+        int x;
+        memcpy (&x, p, sizeof (int));
+        return (double) x;
+      }
+    default:
+      {
+        long x;
+        memcpy (&x, p, sizeof (long));
+        return (double) x;
+      }
+    }
+}
+
+/* check column descriptions against the size of the ntuple data */
+static int
+ntcol_check (const gsl_ntuple_column cols[], const size_t ncols,
+             const size_t size)
+{
+  size_t j;
+
+  for (j = 0; j < ncols; j++)
+    {
+      const size_t w = ntcol_width (cols[j].type);
+
+      if (w == 0 || cols[j].offset > size || w > size - cols[j].offset)
+        return 1;
+    }
+
+  return 0;
+}
+
+/*
+ * gsl_ntuple_col_create:
+ * Initialize a columnar ntuple and create the related file
+ */
+
+gsl_ntuple_col *
+gsl_ntuple_col_create (char *filename, void *ntuple_data, size_t size,
+                       const gsl_ntuple_column cols[], const size_t ncols,
+                       const size_t chunk_size, const int flags)
+{
+  gsl_ntuple_col *ntuple;
+  size_t j, nwrite = 0;
+
+  if (ncols == 0)
+    {
+      GSL_ERROR_VAL ("ntuple must have at least one column", GSL_EINVAL, 0);
+    }
+  else if (chunk_size == 0)
+    {
+      GSL_ERROR_VAL ("chunk size must be positive", GSL_EINVAL, 0);
+    }
+  else if (ntcol_check (cols, ncols, size))
+    {
+      GSL_ERROR_VAL ("invalid column type or offset", GSL_EINVAL, 0);
+    }
+
+  ntuple = ntcol_alloc (ntuple_data, size, cols, ncols, chunk_size, flags);
+
+  if (ntuple == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->writing = 1;
+  ntuple->file = fopen (filename, "wb");
+
+  if (ntuple->file == 0)
+    {
+      ntcol_free (ntuple);
+      GSL_ERROR_VAL ("unable to create ntuple file", GSL_EFAILED, 0);
+    }
+
+  nwrite += fwrite (ntcol_magic, sizeof (ntcol_magic), 1, ntuple->file);
+  nwrite += fwrite (&size, sizeof (size_t), 1, ntuple->file);
+  nwrite += fwrite (&ncols, sizeof (size_t), 1, ntuple->file);
+  nwrite += fwrite (&chunk_size, sizeof (size_t), 1, ntuple->file);
+  nwrite += fwrite (&flags, sizeof (int), 1, ntuple->file);
+
+  for (j = 0; j < ncols; j++)
+    {
+      int type = (int) cols[j].type;
+      nwrite += fwrite (&type, sizeof (int), 1, ntuple->file);
+      nwrite += fwrite (&cols[j].offset, sizeof (size_t), 1, ntuple->file);
+    }
+
+  if (nwrite != 5 + 2 * ncols)
+    {
+      fclose (ntuple->file);
+      ntcol_free (ntuple);
+      GSL_ERROR_VAL ("failed to write ntuple header", GSL_EFAILED, 0);
+    }
+
+  return ntuple;
+}
+
+/*
+ * gsl_ntuple_col_open:
+ * Open an existing columnar ntuple file; the column descriptions
+ * are read from the file
+ */
+
+gsl_ntuple_col *
+gsl_ntuple_col_open (char *filename, void *ntuple_data, size_t size)
+{
+  gsl_ntuple_col *ntuple;
+  gsl_ntuple_column *cols;
+  char magic[8];
+  size_t fsize, ncols, chunk_size, j, nread = 0;
+  int flags;
+  FILE *file = fopen (filename, "rb");
+
+  if (file == 0)
+    {
+      GSL_ERROR_VAL ("unable to open ntuple file for reading",
+                     GSL_EFAILED, 0);
+    }
+
+  nread += fread (magic, sizeof (magic), 1, file);
+  nread += fread (&fsize, sizeof (size_t), 1, file);
+  nread += fread (&ncols, sizeof (size_t), 1, file);
+  nread += fread (&chunk_size, sizeof (size_t), 1, file);
+  nread += fread (&flags, sizeof (int), 1, file);
+
+  if (nread != 5 || memcmp (magic, ntcol_magic, sizeof (magic)) != 0 ||
+      ncols == 0 || chunk_size == 0)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("file is not a columnar ntuple file", GSL_EFAILED, 0);
+    }
+
+  if (fsize != size)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("ntuple size does not match file", GSL_EBADLEN, 0);
+    }
+
+  cols = malloc (ncols * sizeof (gsl_ntuple_column));
+
+  if (cols == 0)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple columns",
+                     GSL_ENOMEM, 0);
+    }
+
+  nread = 0;
+
+  for (j = 0; j < ncols; j++)
+    {
+      int type;
+      nread += fread (&type, sizeof (int), 1, file);
+      nread += fread (&cols[j].offset, sizeof (size_t), 1, file);
+      cols[j].type = (gsl_ntuple_type) type;
+    }
+
+  if (nread != 2 * ncols || ntcol_check (cols, ncols, size))
+    {
+      free (cols);
+      fclose (file);
+      GSL_ERROR_VAL ("invalid columns in ntuple file", GSL_EFAILED, 0);
+    }
+
+  ntuple = ntcol_alloc (ntuple_data, size, cols, ncols, chunk_size, flags);
+  free (cols);
+
+  if (ntuple == 0)
+    {
+      fclose (file);
+      GSL_ERROR_VAL ("failed to allocate space for ntuple struct",
+                     GSL_ENOMEM, 0);
+    }
+
+  ntuple->file = file;
+
+  return ntuple;
+}
+
+/* 
+ * gsl_ntuple_col_write:
+ * append the current data row; the row is written to the file when
+ * its chunk is complete
+ */
+
+int
+gsl_ntuple_col_write (gsl_ntuple_col * ntuple)
+{
+  const unsigned char *row = (const unsigned char *) ntuple->ntuple_data;
+  size_t j;
+
+  if (!ntuple->writing)
+    {
+      GSL_ERROR ("ntuple is not open for writing", GSL_EINVAL);
+    }
+
+  if (ntuple->nrows == ntuple->chunk_size)
+    {
+      int status = ntcol_flush (ntuple);
+
+      if (status)
+        return status;
+    }
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      const size_t w = ntuple->width[j];
+      memcpy (ntuple->data[j] + ntuple->nrows * w, row + ntuple->cols[j].offset, w);
+    }
+
+  ntuple->nrows++;
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_col_read:
+ * read the next data row; returns GSL_EOF at the end of the file
+ */
+
+int
+gsl_ntuple_col_read (gsl_ntuple_col * ntuple)
+{
+  if (ntuple->writing)
+    {
+      GSL_ERROR ("ntuple is not open for reading", GSL_EINVAL);
+    }
+
+  while (ntuple->pos == ntuple->nrows)
+    {
+      size_t j;
+      int status = ntcol_read_header (ntuple);
+
+      if (status)
+        return status;
+
+      for (j = 0; j < ntuple->ncols; j++)
+        {
+          status = ntcol_read_column (ntuple, j);
+
+          if (status)
+            return status;
+        }
+    }
+
+  ntcol_get_row (ntuple, ntuple->pos++, NULL);
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_col_project:
+ * fill a histogram from the remaining rows of a columnar ntuple. Only
+ * the columns cols[0..ncols-1] are read into the ntuple data (all
+ * columns if cols is NULL), and chunks for which chunk_func, given the
+ * minimum and maximum of every column, returns zero are skipped
+ * without being read.
+ */
+
+#define EVAL(f,x) ((*((f)->function))(x,(f)->params))
+
+int
+gsl_ntuple_col_project (gsl_histogram * h, gsl_ntuple_col * ntuple,
+                        const size_t cols[], const size_t ncols,
+                        gsl_ntuple_value_fn * value_func,
+                        gsl_ntuple_select_fn * select_func,
+                        gsl_ntuple_chunk_fn * chunk_func)
+{
+  char *want;
+  size_t j, k;
+  int status = GSL_SUCCESS;
+
+  if (ntuple->writing)
+    {
+      GSL_ERROR ("ntuple is not open for reading", GSL_EINVAL);
+    }
+
+  want = calloc (ntuple->ncols, 1);
+
+  if (want == 0)
+    {
+      GSL_ERROR ("failed to allocate space for column flags", GSL_ENOMEM);
+    }
+
+  if (cols == NULL)
+    {
+      memset (want, 1, ntuple->ncols);
+    }
+  else
+    {
+      for (k = 0; k < ncols; k++)
+        {
+          if (cols[k] >= ntuple->ncols)
+            {
+              free (want);
+              GSL_ERROR ("column index exceeds number of columns", GSL_EINVAL);
+            }
+
+          want[cols[k]] = 1;
+        }
+    }
+
+  /* rows remaining in the current chunk have all columns loaded */
+  for (; ntuple->pos < ntuple->nrows; ntuple->pos++)
+    {
+      ntcol_get_row (ntuple, ntuple->pos, want);
+
+      if (EVAL (select_func, ntuple->ntuple_data))
+        gsl_histogram_increment (h, EVAL (value_func, ntuple->ntuple_data));
+    }
+
+  while (1)
+    {
+      ntuple_off_t start;
+      size_t total = 0;
+
+      status = ntcol_read_header (ntuple);
+
+      if (status == GSL_EOF)
+        {
+          status = GSL_SUCCESS;
+          break;
+        }
+      else if (status)
+        {
+          break;
+        }
+
+      start = ntuple_tell (ntuple->file);
+
+      if (start < 0)
+        {
+          status = GSL_EFAILED;
+          break;
+        }
+
+      /* bounded by ntcol_read_header, so the sum cannot overflow */
+      for (j = 0; j < ntuple->ncols; j++)
+        total += ntuple->nbytes[j];
+
+      if (chunk_func == NULL || (*chunk_func->function) (ntuple->min, ntuple->max,
+                                                         chunk_func->params))
+        {
+          size_t offset = 0;
+
+          for (j = 0; j < ntuple->ncols && status == GSL_SUCCESS; j++)
+            {
+              if (want[j])
+                {
+                  status = ntuple_seek (ntuple->file, start, offset);
+
+                  if (status == GSL_SUCCESS)
+                    status = ntcol_read_column (ntuple, j);
+                }
+
+              offset += ntuple->nbytes[j];
+            }
+
+          if (status)
+            break;
+
+          for (k = 0; k < ntuple->nrows; k++)
+            {
+              ntcol_get_row (ntuple, k, want);
+
+              if (EVAL (select_func, ntuple->ntuple_data))
+                gsl_histogram_increment (h, EVAL (value_func, ntuple->ntuple_data));
+            }
+        }
+
+      /* the chunk is consumed; partially loaded data must not be
+         returned by gsl_ntuple_col_read */
+      ntuple->pos = ntuple->nrows;
+
+      status = ntuple_seek (ntuple->file, start, total);
+
+      if (status)
+        break;
+    }
+
+  free (want);
+
+  if (status)
+    {
+      GSL_ERROR ("failed to read ntuple for projection", status);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_col_close:
+ * write any pending rows, close the ntuple file and free the memory
+ */
+
+int
+gsl_ntuple_col_close (gsl_ntuple_col * ntuple)
+{
+  int status = GSL_SUCCESS;
+
+  if (ntuple->writing)
+    status = ntcol_flush (ntuple);
+
+  if (fclose (ntuple->file))
+    status = GSL_EFAILED;
+
+  ntcol_free (ntuple);
+
+  if (status)
+    {
+      GSL_ERROR ("failed to close ntuple file", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static gsl_ntuple_col *
+ntcol_alloc (void * ntuple_data, size_t size, const gsl_ntuple_column cols[],
+             const size_t ncols, const size_t chunk_size, const int flags)
+{
+  gsl_ntuple_col *ntuple = calloc (1, sizeof (gsl_ntuple_col));
+  size_t j, wmax = 0;
+
+  if (ntuple == 0)
+    return 0;
+
+  ntuple->ntuple_data = ntuple_data;
+  ntuple->size = size;
+  ntuple->ncols = ncols;
+  ntuple->chunk_size = chunk_size;
+  ntuple->flags = flags;
+
+  ntuple->cols = malloc (ncols * sizeof (gsl_ntuple_column));
+  ntuple->width = malloc (ncols * sizeof (size_t));
+  ntuple->data = calloc (ncols, sizeof (unsigned char *));
+  ntuple->nbytes = calloc (ncols, sizeof (size_t));
+  ntuple->min = malloc (ncols * sizeof (double));
+  ntuple->max = malloc (ncols * sizeof (double));
+
+  if (ntuple->cols == 0 || ntuple->width == 0 || ntuple->data == 0 ||
+      ntuple->nbytes == 0 || ntuple->min == 0 || ntuple->max == 0)
+    {
+      ntcol_free (ntuple);
+      return 0;
+    }
+
+  for (j = 0; j < ncols; j++)
+    {
+      ntuple->cols[j] = cols[j];
+      ntuple->width[j] = ntcol_width (cols[j].type);
+      ntuple->data[j] = malloc (chunk_size * ntuple->width[j]);
+
+      if (ntuple->data[j] == 0)
+        {
+          ntcol_free (ntuple);
+          return 0;
+        }
+
+      wmax = GSL_MAX (wmax, ntuple->width[j]);
+    }
+
+  /* shuffled data followed by encoded data */
+  ntuple->work = malloc (chunk_size * wmax + RLE_BOUND (chunk_size * wmax));
+
+  if (ntuple->work == 0)
+    {
+      ntcol_free (ntuple);
+      return 0;
+    }
+
+  return ntuple;
+}
+
+static void
+ntcol_free (gsl_ntuple_col * ntuple)
+{
+  if (ntuple->data)
+    {
+      size_t j;
+
+      for (j = 0; j < ntuple->ncols; j++)
+        free (ntuple->data[j]);
+
+      free (ntuple->data);
+    }
+
+  free (ntuple->cols);
+  free (ntuple->width);
+  free (ntuple->nbytes);
+  free (ntuple->min);
+  free (ntuple->max);
+  free (ntuple->work);
+  free (ntuple);
+}
+
+/* write the rows collected in memory as one chunk */
+static int
+ntcol_flush (gsl_ntuple_col * ntuple)
+{
+  FILE *file = ntuple->file;
+  const size_t nrows = ntuple->nrows;
+  size_t j, i, nwrite = 0;
+  ntuple_off_t start;
+  int status;
+
+  if (nrows == 0)
+    return GSL_SUCCESS;
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      const size_t w = ntuple->width[j];
+      double min = GSL_POSINF, max = GSL_NEGINF;
+
+      for (i = 0; i < nrows; i++)
+        {
+          double x = ntcol_value (ntuple->cols[j].type, ntuple->data[j] + i * w);
+
+          if (x < min)
+            min = x;
+
+          if (x > max)
+            max = x;
+        }
+
+      ntuple->min[j] = min;
+      ntuple->max[j] = max;
+    }
+
+  /* chunk header, rewritten below once the stored sizes are known */
+  start = ntuple_tell (file);
+
+  if (start < 0)
+    {
+      GSL_ERROR ("unable to determine position in ntuple file", GSL_EFAILED);
+    }
+
+  nwrite += fwrite (&nrows, sizeof (size_t), 1, file);
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      nwrite += fwrite (&ntuple->nbytes[j], sizeof (size_t), 1, file);
+      nwrite += fwrite (&ntuple->min[j], sizeof (double), 1, file);
+      nwrite += fwrite (&ntuple->max[j], sizeof (double), 1, file);
+    }
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      const size_t raw = nrows * ntuple->width[j];
+      const unsigned char *p = ntuple->data[j];
+      size_t len = raw;
+
+      if (ntuple->flags & GSL_NTUPLE_COMPRESS)
+        {
+          unsigned char *enc = ntuple->work + ntuple->chunk_size * ntuple->width[j];
+
+          rle_shuffle (ntuple->data[j], ntuple->work, nrows, ntuple->width[j]);
+          len = rle_encode (ntuple->work, raw, enc);
+
+          if (len < raw)
+            p = enc;
+          else
+            len = raw;
+        }
+
+      ntuple->nbytes[j] = len;
+      nwrite += (fwrite (p, 1, len, file) == len);
+    }
+
+  status = ntuple_seek (file, start, 0);
+
+  if (status == GSL_SUCCESS)
+    {
+      nwrite += fwrite (&nrows, sizeof (size_t), 1, file);
+
+      for (j = 0; j < ntuple->ncols; j++)
+        {
+          nwrite += fwrite (&ntuple->nbytes[j], sizeof (size_t), 1, file);
+          nwrite += fwrite (&ntuple->min[j], sizeof (double), 1, file);
+          nwrite += fwrite (&ntuple->max[j], sizeof (double), 1, file);
+        }
+
+      status = ntuple_seek_end (file);
+    }
+
+  ntuple->nrows = 0;
+
+  if (status || nwrite != 2 * (1 + 3 * ntuple->ncols) + ntuple->ncols)
+    {
+      GSL_ERROR ("failed to write ntuple chunk to file", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* read the header of the next chunk; returns GSL_EOF at end of file */
+static int
+ntcol_read_header (gsl_ntuple_col * ntuple)
+{
+  size_t nrows, j, nread = 0;
+
+  ntuple->nrows = 0;
+  ntuple->pos = 0;
+
+  if (fread (&nrows, sizeof (size_t), 1, ntuple->file) != 1)
+    {
+      if (feof (ntuple->file))
+        return GSL_EOF;
+
+      GSL_ERROR ("failed to read ntuple chunk", GSL_EFAILED);
+    }
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      nread += fread (&ntuple->nbytes[j], sizeof (size_t), 1, ntuple->file);
+      nread += fread (&ntuple->min[j], sizeof (double), 1, ntuple->file);
+      nread += fread (&ntuple->max[j], sizeof (double), 1, ntuple->file);
+    }
+
+  if (nread != 3 * ntuple->ncols || nrows == 0 || nrows > ntuple->chunk_size)
+    {
+      GSL_ERROR ("corrupt ntuple chunk header", GSL_EFAILED);
+    }
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      if (ntuple->nbytes[j] > RLE_BOUND (nrows * ntuple->width[j]))
+        {
+          GSL_ERROR ("corrupt ntuple chunk header", GSL_EFAILED);
+        }
+    }
+
+  ntuple->nrows = nrows;
+
+  return GSL_SUCCESS;
+}
+
+/* read and decode column j of the current chunk from the current file position */
+static int
+ntcol_read_column (gsl_ntuple_col * ntuple, const size_t j)
+{
+  const size_t w = ntuple->width[j];
+  const size_t raw = ntuple->nrows * w;
+  const size_t len = ntuple->nbytes[j];
+
+  if (len == raw)
+    {
+      if (fread (ntuple->data[j], 1, raw, ntuple->file) != raw)
+        {
+          GSL_ERROR ("failed to read ntuple column", GSL_EFAILED);
+        }
+    }
+  else
+    {
+      unsigned char *enc = ntuple->work + ntuple->chunk_size * w;
+
+      if (fread (enc, 1, len, ntuple->file) != len)
+        {
+          GSL_ERROR ("failed to read ntuple column", GSL_EFAILED);
+        }
+
+      if (rle_decode (enc, len, ntuple->work, raw))
+        {
+          GSL_ERROR ("corrupt ntuple column data", GSL_EFAILED);
+        }
+
+      rle_unshuffle (ntuple->work, ntuple->data[j], ntuple->nrows, w);
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* copy row of the current chunk into the ntuple data; only the columns
+   flagged in want are copied, or all columns if want is NULL */
+static void
+ntcol_get_row (gsl_ntuple_col * ntuple, const size_t row, const char * want)
+{
+  unsigned char *dest = (unsigned char *) ntuple->ntuple_data;
+  size_t j;
+
+  for (j = 0; j < ntuple->ncols; j++)
+    {
+      if (want == NULL || want[j])
+        {
+          const size_t w = ntuple->width[j];
+          memcpy (dest + ntuple->cols[j].offset, ntuple->data[j] + row * w, w);
+        }
+    }
+}
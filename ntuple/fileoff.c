@@ -0,0 +1,87 @@
+/* ntuple/fileoff.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_NTUPLE_FILEOFF_C__
+#define __GSL_NTUPLE_FILEOFF_C__
+
+#include <stdio.h>
+#include <limits.h>
+#include <sys/types.h>
+#include <gsl/gsl_errno.h>
+
+/*
+ * File positions for ntuple files. Where fseeko and ftello are
+ * available, configure enables large file support so that off_t is
+ * 64 bits wide; otherwise positions are limited to the range of long.
+ * Seeks are checked so that an unrepresentable position is reported
+ * rather than silently truncated.
+ */
+
+#if HAVE_FSEEKO
+typedef off_t ntuple_off_t;
+#define NTUPLE_FSEEK(f,o,w) fseeko (f, o, w)
+#define NTUPLE_FTELL(f)     ftello (f)
+#else
+typedef long ntuple_off_t;
+#define NTUPLE_FSEEK(f,o,w) fseek (f, o, w)
+#define NTUPLE_FTELL(f)     ftell (f)
+#endif
+
+/* largest positive value of the signed type ntuple_off_t */
+#define NTUPLE_OFF_MAX \
+  ((((ntuple_off_t) 1 << (sizeof (ntuple_off_t) * CHAR_BIT - 2)) - 1) * 2 + 1)
+
+/* return the current position of file, or -1 on error */
+static inline ntuple_off_t
+ntuple_tell (FILE * file)
+{
+  return NTUPLE_FTELL (file);
+}
+
+/* position file at base + offset bytes from its start; returns
+   GSL_EOVRFLW if the position cannot be represented */
+static inline int
+ntuple_seek (FILE * file, const ntuple_off_t base, const size_t offset)
+{
+  const ntuple_off_t room = NTUPLE_OFF_MAX - base;
+
+  if (base < 0)
+    return GSL_EINVAL;
+
+  if (sizeof (size_t) >= sizeof (ntuple_off_t) ? offset > (size_t) room
+                                               : (ntuple_off_t) offset > room)
+    return GSL_EOVRFLW;
+
+  if (NTUPLE_FSEEK (file, base + (ntuple_off_t) offset, SEEK_SET))
+    return GSL_EFAILED;
+
+  return GSL_SUCCESS;
+}
+
+/* position file at its end */
+static inline int
+ntuple_seek_end (FILE * file)
+{
+  if (NTUPLE_FSEEK (file, 0, SEEK_END))
+    return GSL_EFAILED;
+
+  return GSL_SUCCESS;
+}
+
+#endif /* __GSL_NTUPLE_FILEOFF_C__ */
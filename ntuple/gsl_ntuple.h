@@ -44,6 +44,9 @@ typedef struct {
     FILE * file;
     void * ntuple_data;
     size_t size;
+    void * buffer;        /* rows waiting to be written */
+    size_t buffer_size;   /* capacity of buffer in rows */
+    size_t nbuffered;     /* number of rows in buffer */
 } gsl_ntuple;
 
 typedef struct {
@@ -67,12 +70,85 @@ int gsl_ntuple_read (gsl_ntuple * ntuple);
 
 int gsl_ntuple_bookdata (gsl_ntuple * ntuple);  /* synonym for write */
 
+int gsl_ntuple_write_array (gsl_ntuple * ntuple, const void * rows,
+                            const size_t n);
+int gsl_ntuple_set_buffer (gsl_ntuple * ntuple, const size_t nrows);
+int gsl_ntuple_flush (gsl_ntuple * ntuple);
+
 int gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple, 
                         gsl_ntuple_value_fn *value_func,
                         gsl_ntuple_select_fn *select_func);
 
+int gsl_ntuple_project_range (gsl_histogram * h, gsl_ntuple * ntuple,
+                              const size_t first, const size_t n,
+                              gsl_ntuple_value_fn *value_func,
+                              gsl_ntuple_select_fn *select_func);
+
+int gsl_ntuple_nrows (gsl_ntuple * ntuple, size_t * nrows);
+int gsl_ntuple_seek (gsl_ntuple * ntuple, const size_t row);
+
 int gsl_ntuple_close (gsl_ntuple * ntuple);
 
+/* columnar ntuples */
+
+typedef enum
+{
+  GSL_NTUPLE_DOUBLE = 0,
+  GSL_NTUPLE_FLOAT  = 1,
+  GSL_NTUPLE_INT    = 2,
+  GSL_NTUPLE_LONG   = 3
+} gsl_ntuple_type;
+
+#define GSL_NTUPLE_COMPRESS  (1 << 0)
+
+typedef struct {
+  gsl_ntuple_type type;  /* type of the member */
+  size_t offset;         /* offset of the member in the ntuple data struct */
+} gsl_ntuple_column;
+
+typedef struct {
+  FILE * file;
+  void * ntuple_data;
+  size_t size;
+  size_t ncols;                 /* number of columns */
+  gsl_ntuple_column * cols;     /* column descriptions */
+  size_t * width;               /* size in bytes of each column */
+  size_t chunk_size;            /* maximum number of rows per chunk */
+  int flags;
+  int writing;                  /* 1 if opened for writing */
+  size_t nrows;                 /* number of rows in current chunk */
+  size_t pos;                   /* next row of current chunk to read */
+  unsigned char ** data;        /* column data of current chunk */
+  unsigned char * work;         /* compression workspace */
+  size_t * nbytes;              /* stored size of each column in current chunk */
+  double * min;                 /* minimum of each column in current chunk */
+  double * max;                 /* maximum of each column in current chunk */
+} gsl_ntuple_col;
+
+typedef struct {
+  int (* function) (const double min[], const double max[], void * params);
+  void * params;
+} gsl_ntuple_chunk_fn;
+
+gsl_ntuple_col *
+gsl_ntuple_col_create (char * filename, void * ntuple_data, size_t size,
+                       const gsl_ntuple_column cols[], const size_t ncols,
+                       const size_t chunk_size, const int flags);
+
+gsl_ntuple_col *
+gsl_ntuple_col_open (char * filename, void * ntuple_data, size_t size);
+
+int gsl_ntuple_col_write (gsl_ntuple_col * ntuple);
+int gsl_ntuple_col_read (gsl_ntuple_col * ntuple);
+
+int gsl_ntuple_col_project (gsl_histogram * h, gsl_ntuple_col * ntuple,
+                            const size_t cols[], const size_t ncols,
+                            gsl_ntuple_value_fn * value_func,
+                            gsl_ntuple_select_fn * select_func,
+                            gsl_ntuple_chunk_fn * chunk_func);
+
+int gsl_ntuple_col_close (gsl_ntuple_col * ntuple);
+
 __END_DECLS
 
 #endif /* __GSL_NTUPLE_H__ */
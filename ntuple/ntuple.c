@@ -21,9 +21,17 @@
 
 #include <config.h>
 #include <errno.h>
+#include <string.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_ntuple.h>
 
+#include "fileoff.c"
+
+/* rows are read and written in blocks of about this many bytes */
+#define NTUPLE_BLOCK_BYTES 65536
+
+static int ntuple_write_buffer (gsl_ntuple * ntuple);
+
 /* 
  * gsl_ntuple_open:
  * Initialize an ntuple structure and create the related file
@@ -32,7 +40,14 @@
 gsl_ntuple *
 gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
 {
-  gsl_ntuple *ntuple = (gsl_ntuple *)malloc (sizeof (gsl_ntuple));
+  gsl_ntuple *ntuple;
+
+  if (size == 0)
+    {
+      GSL_ERROR_VAL ("ntuple size must be positive", GSL_EINVAL, 0);
+    }
+
+  ntuple = (gsl_ntuple *)malloc (sizeof (gsl_ntuple));
 
   if (ntuple == 0)
     {
@@ -42,6 +57,9 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
 
   ntuple->ntuple_data = ntuple_data;
   ntuple->size = size;
+  ntuple->buffer = 0;
+  ntuple->buffer_size = 0;
+  ntuple->nbuffered = 0;
 
   ntuple->file = fopen (filename, "wb");
 
@@ -51,6 +69,17 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
       GSL_ERROR_VAL ("unable to create ntuple file", GSL_EFAILED, 0);
     }
 
+  /* rows are collected in a buffer by default; if it cannot be
+     allocated each row is written directly */
+  {
+    size_t nrows = (size < NTUPLE_BLOCK_BYTES) ? NTUPLE_BLOCK_BYTES / size : 1;
+
+    ntuple->buffer = malloc (nrows * size);
+
+    if (ntuple->buffer != 0)
+      ntuple->buffer_size = nrows;
+  }
+
   return ntuple;
 }
 
@@ -62,7 +91,14 @@ gsl_ntuple_create (char *filename, void *ntuple_data, size_t size)
 gsl_ntuple *
 gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
 {
-  gsl_ntuple *ntuple = (gsl_ntuple *)malloc (sizeof (gsl_ntuple));
+  gsl_ntuple *ntuple;
+
+  if (size == 0)
+    {
+      GSL_ERROR_VAL ("ntuple size must be positive", GSL_EINVAL, 0);
+    }
+
+  ntuple = (gsl_ntuple *)malloc (sizeof (gsl_ntuple));
 
   if (ntuple == 0)
     {
@@ -72,6 +108,9 @@ gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
 
   ntuple->ntuple_data = ntuple_data;
   ntuple->size = size;
+  ntuple->buffer = 0;
+  ntuple->buffer_size = 0;
+  ntuple->nbuffered = 0;
 
   ntuple->file = fopen (filename, "rb");
 
@@ -87,22 +126,157 @@ gsl_ntuple_open (char *filename, void *ntuple_data, size_t size)
 
 /* 
  * gsl_ntuple_write:
- * write to file a data row, must be used in a loop!
+ * write to file a data row, must be used in a loop! The row is
+ * copied to the row buffer, which is written to the file when full
  */
 
 int
 gsl_ntuple_write (gsl_ntuple * ntuple)
 {
-  size_t nwrite;
+  if (ntuple->buffer_size > 0)
+    {
+      if (ntuple->nbuffered == ntuple->buffer_size)
+        {
+          int status = ntuple_write_buffer (ntuple);
+
+          if (status)
+            return status;
+        }
+
+      memcpy ((unsigned char *) ntuple->buffer + ntuple->nbuffered * ntuple->size,
+              ntuple->ntuple_data, ntuple->size);
+      ntuple->nbuffered++;
+    }
+  else
+    {
+      size_t nwrite = fwrite (ntuple->ntuple_data, ntuple->size,
+                              1, ntuple->file);
+
+      if (nwrite != 1)
+        {
+          GSL_ERROR ("failed to write ntuple entry to file", GSL_EFAILED);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_write_array:
+ * write n data rows stored contiguously in rows, each of size
+ * ntuple->size
+ */
+
+int
+gsl_ntuple_write_array (gsl_ntuple * ntuple, const void * rows,
+                        const size_t n)
+{
+  const size_t size = ntuple->size;
+
+  if (n == 0)
+    return GSL_SUCCESS;
+
+  if (ntuple->nbuffered + n <= ntuple->buffer_size)
+    {
+      /* fits in the buffer */
+      memcpy ((unsigned char *) ntuple->buffer + ntuple->nbuffered * size,
+              rows, n * size);
+      ntuple->nbuffered += n;
+    }
+  else
+    {
+      int status = ntuple_write_buffer (ntuple);
+
+      if (status)
+        return status;
+
+      if (fwrite (rows, size, n, ntuple->file) != n)
+        {
+          GSL_ERROR ("failed to write ntuple entries to file", GSL_EFAILED);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_set_buffer:
+ * set the number of rows held in memory before they are written
+ * to the file; 0 writes each row immediately
+ */
+
+int
+gsl_ntuple_set_buffer (gsl_ntuple * ntuple, const size_t nrows)
+{
+  int status = ntuple_write_buffer (ntuple);
+  void *buffer = 0;
+
+  if (status)
+    return status;
+
+  if (nrows > 0)
+    {
+      buffer = malloc (nrows * ntuple->size);
+
+      if (buffer == 0)
+        {
+          GSL_ERROR ("failed to allocate space for ntuple buffer", GSL_ENOMEM);
+        }
+    }
+
+  free (ntuple->buffer);
+  ntuple->buffer = buffer;
+  ntuple->buffer_size = nrows;
+
+  return GSL_SUCCESS;
+}
+
+/* 
+ * gsl_ntuple_flush:
+ * write all buffered rows and flush the file stream
+ */
+
+int
+gsl_ntuple_flush (gsl_ntuple * ntuple)
+{
+  int status = ntuple_write_buffer (ntuple);
+
+  if (status)
+    return status;
+
+  if (fflush (ntuple->file))
+    {
+      GSL_ERROR ("failed to flush ntuple file", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+ntuple_write_buffer (gsl_ntuple * ntuple)
+{
+  const size_t n = ntuple->nbuffered;
+  size_t nwritten;
+
+  if (n == 0)
+    return GSL_SUCCESS;
 
-  nwrite = fwrite (ntuple->ntuple_data, ntuple->size,
-                   1, ntuple->file);
+  nwritten = fwrite (ntuple->buffer, ntuple->size, n, ntuple->file);
 
-  if (nwrite != 1)
+  if (nwritten != n)
     {
-      GSL_ERROR ("failed to write ntuple entry to file", GSL_EFAILED);
+      /* keep the rows which were not written, so that a later flush
+         can retry them */
+      char *buf = (char *) ntuple->buffer;
+
+      memmove (buf, buf + nwritten * ntuple->size, (n - nwritten) * ntuple->size);
+      ntuple->nbuffered = n - nwritten;
+
+      GSL_ERROR ("failed to write ntuple entries to file", GSL_EFAILED);
     }
 
+  ntuple->nbuffered = 0;
+
   return GSL_SUCCESS;
 }
 
@@ -148,38 +322,152 @@ gsl_ntuple_read (gsl_ntuple * ntuple)
 
 #define EVAL(f,x) ((*((f)->function))(x,(f)->params))
 
-int
-gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
-                    gsl_ntuple_value_fn * value_func, 
-                    gsl_ntuple_select_fn * select_func)
+/* project at most nmax rows, starting at the current file position */
+static int
+ntuple_project_rows (gsl_histogram * h, gsl_ntuple * ntuple,
+                     size_t nmax,
+                     gsl_ntuple_value_fn * value_func,
+                     gsl_ntuple_select_fn * select_func)
 {
-  size_t nread;
+  const size_t size = ntuple->size;
+  const size_t nblock = (size < NTUPLE_BLOCK_BYTES) ? NTUPLE_BLOCK_BYTES / size : 1;
+  unsigned char *block = malloc (nblock * size);
 
-  do
+  if (block == 0)
     {
-      nread = fread (ntuple->ntuple_data, ntuple->size,
-                     1, ntuple->file);
+      GSL_ERROR ("failed to allocate space for ntuple rows", GSL_ENOMEM);
+    }
+
+  while (nmax > 0)
+    {
+      size_t nread = fread (block, size, (nmax < nblock) ? nmax : nblock,
+                            ntuple->file);
+      size_t i;
 
-      if (nread == 0 && feof(ntuple->file))
+      for (i = 0; i < nread; i++)
         {
-          break ;
+          memcpy (ntuple->ntuple_data, block + i * size, size);
+
+          if (EVAL(select_func, ntuple->ntuple_data))
+            {
+              gsl_histogram_increment (h, EVAL(value_func, ntuple->ntuple_data));
+            }
         }
-      
-      if (nread != 1) 
+
+      nmax -= nread;
+
+      if (nread < nblock && nmax > 0)
         {
+          if (feof (ntuple->file))
+            {
+              break ;
+            }
+
+          free (block);
           GSL_ERROR ("failed to read ntuple for projection", GSL_EFAILED);
         }
+    }
 
-      if (EVAL(select_func, ntuple->ntuple_data))
-        {
-          gsl_histogram_increment (h, EVAL(value_func, ntuple->ntuple_data));
-        }
+  free (block);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
+                    gsl_ntuple_value_fn * value_func, 
+                    gsl_ntuple_select_fn * select_func)
+{
+  return ntuple_project_rows (h, ntuple, (size_t) -1, value_func, select_func);
+}
+
+/* 
+ * gsl_ntuple_project_range:
+ * fill an histogram with rows first, ..., first + n - 1 of an ntuple
+ * file (or up to the end of the file). Separate ranges may be
+ * projected into separate histograms, for example in parallel with
+ * one ntuple struct per thread, and the results combined with
+ * gsl_histogram_add
+ */
+
+int
+gsl_ntuple_project_range (gsl_histogram * h, gsl_ntuple * ntuple,
+                          const size_t first, const size_t n,
+                          gsl_ntuple_value_fn * value_func,
+                          gsl_ntuple_select_fn * select_func)
+{
+  int status = gsl_ntuple_seek (ntuple, first);
+
+  if (status)
+    return status;
+
+  return ntuple_project_rows (h, ntuple, n, value_func, select_func);
+}
+
+/* 
+ * gsl_ntuple_nrows:
+ * find the number of rows in an ntuple file opened for reading
+ */
+
+int
+gsl_ntuple_nrows (gsl_ntuple * ntuple, size_t * nrows)
+{
+  const ntuple_off_t pos = ntuple_tell (ntuple->file);
+  ntuple_off_t end;
+
+  if (pos < 0 || ntuple_seek_end (ntuple->file))
+    {
+      GSL_ERROR ("unable to determine size of ntuple file", GSL_EFAILED);
+    }
+
+  end = ntuple_tell (ntuple->file);
+
+  if (end < 0 || ntuple_seek (ntuple->file, pos, 0))
+    {
+      GSL_ERROR ("unable to determine size of ntuple file", GSL_EFAILED);
+    }
+
+  end /= (ntuple_off_t) ntuple->size;
+
+  if (sizeof (ntuple_off_t) > sizeof (size_t) && end > (ntuple_off_t) ((size_t) -1))
+    {
+      GSL_ERROR ("number of ntuple rows exceeds size_t", GSL_EOVRFLW);
     }
-  while (1);
+
+  *nrows = (size_t) end;
 
   return GSL_SUCCESS;
 }
 
+/* 
+ * gsl_ntuple_seek:
+ * position an ntuple file opened for reading so that the next row
+ * read is the given row
+ */
+
+int
+gsl_ntuple_seek (gsl_ntuple * ntuple, const size_t row)
+{
+  int status;
+
+  if (row > ((size_t) -1) / ntuple->size)
+    {
+      GSL_ERROR ("ntuple row offset exceeds size_t", GSL_EOVRFLW);
+    }
+
+  status = ntuple_seek (ntuple->file, 0, row * ntuple->size);
+
+  if (status == GSL_EOVRFLW)
+    {
+      GSL_ERROR ("ntuple row offset exceeds file offset range", GSL_EOVRFLW);
+    }
+  else if (status)
+    {
+      GSL_ERROR ("unable to seek to ntuple row", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+}
 
 /* 
  * gsl_ntuple_close:
@@ -189,14 +477,18 @@ gsl_ntuple_project (gsl_histogram * h, gsl_ntuple * ntuple,
 int
 gsl_ntuple_close (gsl_ntuple * ntuple)
 {
-  int status = fclose (ntuple->file);
-  
+  int status = ntuple_write_buffer (ntuple);
+
+  if (fclose (ntuple->file))
+    status = GSL_EFAILED;
+
+  free (ntuple->buffer);
+  free (ntuple);
+
   if (status)
     {
       GSL_ERROR ("failed to close ntuple file", GSL_EFAILED);
     }
 
-  free (ntuple);
-
   return GSL_SUCCESS;
 }
@@ -0,0 +1,138 @@
+/* ntuple/rle.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_NTUPLE_RLE_C__
+#define __GSL_NTUPLE_RLE_C__
+
+#include <string.h>
+
+/*
+ * Lightweight compression of column chunks. The n values of s bytes
+ * each are first transposed so that byte b of every value is stored
+ * contiguously ("byte shuffling"); for numeric columns the high order
+ * bytes (signs, exponents, leading zeros) are then highly repetitive.
+ * The shuffled bytes are run-length encoded in the PackBits format: a
+ * control byte c < 128 is followed by c + 1 literal bytes, and a
+ * control byte c >= 128 by one byte which is repeated c - 125 times.
+ * Both steps are a single pass over the data.
+ */
+
+/* maximum encoded size of n bytes */
+#define RLE_BOUND(n) ((n) + (n) / 128 + 1)
+
+static void
+rle_shuffle (const unsigned char * src, unsigned char * dest,
+             const size_t n, const size_t s)
+{
+  size_t i, b;
+
+  for (b = 0; b < s; b++)
+    for (i = 0; i < n; i++)
+      dest[b * n + i] = src[i * s + b];
+}
+
+static void
+rle_unshuffle (const unsigned char * src, unsigned char * dest,
+               const size_t n, const size_t s)
+{
+  size_t i, b;
+
+  for (b = 0; b < s; b++)
+    for (i = 0; i < n; i++)
+      dest[i * s + b] = src[b * n + i];
+}
+
+/* encode src[0..n-1] into dest, returning the encoded length */
+static size_t
+rle_encode (const unsigned char * src, const size_t n, unsigned char * dest)
+{
+  size_t i = 0, len = 0;
+
+  while (i < n)
+    {
+      size_t run = 1;
+
+      while (i + run < n && run < 130 && src[i + run] == src[i])
+        run++;
+
+      if (run >= 3)
+        {
+          dest[len++] = (unsigned char) (run + 125);
+          dest[len++] = src[i];
+          i += run;
+        }
+      else
+        {
+          /* literal sequence, ending before the next run of 3 */
+          size_t lit = 0;
+
+          while (i + lit < n && lit < 128)
+            {
+              if (i + lit + 2 < n && src[i + lit] == src[i + lit + 1] &&
+                  src[i + lit] == src[i + lit + 2])
+                break;
+
+              lit++;
+            }
+
+          dest[len++] = (unsigned char) (lit - 1);
+          memcpy (dest + len, src + i, lit);
+          len += lit;
+          i += lit;
+        }
+    }
+
+  return len;
+}
+
+/* decode src[0..len-1] into dest, which has room for n bytes; returns
+   nonzero if the input is corrupt */
+static int
+rle_decode (const unsigned char * src, const size_t len,
+            unsigned char * dest, const size_t n)
+{
+  size_t i = 0, k = 0;
+
+  while (i < len)
+    {
+      const size_t c = src[i++];
+
+      if (c < 128)
+        {
+          if (i + c + 1 > len || k + c + 1 > n)
+            return 1;
+
+          memcpy (dest + k, src + i, c + 1);
+          i += c + 1;
+          k += c + 1;
+        }
+      else
+        {
+          if (i >= len || k + c - 125 > n)
+            return 1;
+
+          memset (dest + k, src[i++], c - 125);
+          k += c - 125;
+        }
+    }
+
+  return (k != n);
+}
+
+#endif /* __GSL_NTUPLE_RLE_C__ */
@@ -14,6 +14,7 @@ struct data
 };
 int sel_func (void *ntuple_data, void * params);
 double val_func (void *ntuple_data, void * params);
+void test_col (void);
 
 int
 main (void)
@@ -136,6 +137,137 @@ main (void)
     gsl_histogram_free (h);
   }
 
+  {
+    /* project separate row ranges into separate histograms and add them */
+    const size_t first[3] = { 0, 333, 700 };
+    const size_t count[3] = { 333, 367, 1000 };
+    gsl_histogram *h = gsl_histogram_calloc_uniform (100, 0., 1.);
+    size_t nrows = 0, k;
+    int status = 0;
+
+    for (k = 0; k < 3; k++)
+      {
+        struct data row;
+        gsl_ntuple *ntuple = gsl_ntuple_open ("test.dat", &row, sizeof (row));
+        gsl_histogram *hk = gsl_histogram_calloc_uniform (100, 0., 1.);
+
+        if (k == 0)
+          {
+            gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+
+            gsl_ntuple_nrows (ntuple, &nrows);
+
+            /* row offset overflows size_t */
+            gsl_test_int (gsl_ntuple_seek (ntuple, ((size_t) -1) / 2),
+                          GSL_EOVRFLW, "gsl_ntuple_seek overflow");
+
+            gsl_set_error_handler (old_handler);
+          }
+
+        gsl_ntuple_project_range (hk, ntuple, first[k], count[k], &V, &S);
+        gsl_histogram_add (h, hk);
+
+        gsl_histogram_free (hk);
+        gsl_ntuple_close (ntuple);
+      }
+
+    gsl_test_int ((int) nrows, 1000, "gsl_ntuple_nrows");
+
+    for (i = 0; i < 100; i++)
+      {
+        if (h->bin[i] != f[i])
+          {
+            status = 1;
+          }
+      }
+
+    gsl_test (status, "gsl_ntuple_project_range");
+
+    gsl_histogram_free (h);
+  }
+
+  {
+    /* buffered and batched writes */
+    struct data rows[1000];
+    gsl_ntuple *ntuple = gsl_ntuple_create ("test.dat", &ntuple_row,
+                                            sizeof (ntuple_row));
+    size_t nrows = 0;
+    int status = 0;
+
+    memset (rows, 0, sizeof (rows));
+
+    for (i = 0; i < 1000; i++)
+      {
+        rows[i].num = i;
+        rows[i].x = x[i];
+        rows[i].y = y[i];
+        rows[i].z = z[i];
+      }
+
+    status |= gsl_ntuple_set_buffer (ntuple, 7);
+
+    for (i = 0; i < 100; i++)
+      {
+        ntuple_row = rows[i];
+        status |= gsl_ntuple_write (ntuple);
+      }
+
+    status |= gsl_ntuple_write_array (ntuple, rows + 100, 3);   /* buffered */
+    status |= gsl_ntuple_write_array (ntuple, rows + 103, 297); /* direct */
+    status |= gsl_ntuple_flush (ntuple);
+
+    {
+      gsl_ntuple *r = gsl_ntuple_open ("test.dat", &ntuple_row,
+                                       sizeof (ntuple_row));
+      gsl_ntuple_nrows (r, &nrows);
+      gsl_ntuple_close (r);
+    }
+
+    gsl_test_int ((int) nrows, 400, "gsl_ntuple_flush");
+
+    status |= gsl_ntuple_set_buffer (ntuple, 0);
+
+    for (i = 400; i < 500; i++)
+      {
+        ntuple_row = rows[i];
+        status |= gsl_ntuple_write (ntuple);
+      }
+
+    status |= gsl_ntuple_set_buffer (ntuple, 1000);
+    status |= gsl_ntuple_write_array (ntuple, rows + 500, 500);
+    status |= gsl_ntuple_close (ntuple);
+
+    gsl_test (status, "gsl_ntuple_write_array");
+
+    ntuple = gsl_ntuple_open ("test.dat", &ntuple_row, sizeof (ntuple_row));
+    status = 0;
+
+    for (i = 0; i < 1000; i++)
+      {
+        status |= gsl_ntuple_read (ntuple);
+        status |= (memcmp (&ntuple_row, &rows[i], sizeof (ntuple_row)) != 0);
+      }
+
+    status |= (gsl_ntuple_read (ntuple) != GSL_EOF);
+    gsl_ntuple_close (ntuple);
+
+    gsl_test (status, "reading buffered ntuples");
+  }
+
+  {
+    /* rows of zero size are rejected */
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off ();
+
+    gsl_test (gsl_ntuple_create ("test.dat", &ntuple_row, 0) != 0,
+              "gsl_ntuple_create size 0");
+    gsl_test (gsl_ntuple_open ("test.dat", &ntuple_row, 0) != 0,
+              "gsl_ntuple_open size 0");
+
+    gsl_set_error_handler (old_handler);
+  }
+
+  test_col ();
+
   exit (gsl_test_summary());
 }
 
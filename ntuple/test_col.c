@@ -0,0 +1,259 @@
+/* ntuple/test_col.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_ntuple.h>
+#include <gsl/gsl_test.h>
+
+#define NROWS 1000
+
+struct col_data
+{
+  int num;
+  float f;
+  double x;
+  long l;
+  double y;
+};
+
+struct col_params
+{
+  double scale;
+  size_t nselect;  /* number of calls to selection function */
+};
+
+static int
+col_sel (void *ntuple_data, void *params)
+{
+  struct col_params *p = (struct col_params *) params;
+  double x = ((struct col_data *) ntuple_data)->x;
+
+  p->nselect++;
+
+  return (x * p->scale > 0.1);
+}
+
+static int
+col_sel_all (void *ntuple_data, void *params)
+{
+  struct col_params *p = (struct col_params *) params;
+
+  (void) ntuple_data;
+  p->nselect++;
+
+  return 1;
+}
+
+static double
+col_val (void *ntuple_data, void *params)
+{
+  struct col_params *p = (struct col_params *) params;
+  double x = ((struct col_data *) ntuple_data)->x;
+  double y = ((struct col_data *) ntuple_data)->y;
+
+  return (x + y) * p->scale;
+}
+
+/* column 2 is x; a chunk can match only if its largest x is selected */
+static int
+col_chunk (const double min[], const double max[], void *params)
+{
+  struct col_params *p = (struct col_params *) params;
+
+  (void) min;
+
+  return (max[2] * p->scale > 0.1);
+}
+
+static void
+col_row (const int i, struct col_data * row)
+{
+  row->num = i;
+  row->f = (float) (0.5 * i);
+  row->x = 1.0 / (i + 1.5);
+  row->l = 100000L * (i % 7);
+  row->y = row->x * row->x;
+}
+
+/* return the size in bytes of a closed file */
+static long
+file_size (const char *filename)
+{
+  FILE *f = fopen (filename, "rb");
+  long size = -1;
+
+  if (f != NULL)
+    {
+      if (fseek (f, 0L, SEEK_END) == 0)
+        size = ftell (f);
+
+      fclose (f);
+    }
+
+  return size;
+}
+
+static long
+test_col_file (const int flags, const size_t chunk_size)
+{
+  const gsl_ntuple_column cols[5] = {
+    { GSL_NTUPLE_INT, offsetof (struct col_data, num) },
+    { GSL_NTUPLE_FLOAT, offsetof (struct col_data, f) },
+    { GSL_NTUPLE_DOUBLE, offsetof (struct col_data, x) },
+    { GSL_NTUPLE_LONG, offsetof (struct col_data, l) },
+    { GSL_NTUPLE_DOUBLE, offsetof (struct col_data, y) }
+  };
+  struct col_data row, expected;
+  struct col_params params = { 0.5, 0 };
+  gsl_ntuple_select_fn S, Sall;
+  gsl_ntuple_value_fn V;
+  gsl_ntuple_chunk_fn C;
+  double f[100];
+  int i, status;
+  long fsize;
+
+  S.function = &col_sel;
+  S.params = &params;
+  Sall.function = &col_sel_all;
+  Sall.params = &params;
+  V.function = &col_val;
+  V.params = &params;
+  C.function = &col_chunk;
+  C.params = &params;
+
+  memset (&row, 0, sizeof (row));
+  memset (&expected, 0, sizeof (expected));
+
+  for (i = 0; i < 100; i++)
+    f[i] = 0.0;
+
+  {
+    gsl_ntuple_col *ntuple = gsl_ntuple_col_create ("test_col.dat", &row, sizeof (row),
+                                                    cols, 5, chunk_size, flags);
+    status = 0;
+
+    for (i = 0; i < NROWS; i++)
+      {
+        col_row (i, &row);
+
+        if (row.x * params.scale > 0.1)
+          f[(int) (100.0 * (row.x + row.y) * params.scale)]++;
+
+        status |= gsl_ntuple_col_write (ntuple);
+      }
+
+    status |= gsl_ntuple_col_close (ntuple);
+
+    /* the final partial chunk is written by gsl_ntuple_col_close */
+    fsize = file_size ("test_col.dat");
+
+    gsl_test (status, "gsl_ntuple_col_write flags=%d chunk=%zu", flags, chunk_size);
+  }
+
+  {
+    gsl_ntuple_col *ntuple = gsl_ntuple_col_open ("test_col.dat", &row, sizeof (row));
+    status = 0;
+
+    for (i = 0; i < NROWS; i++)
+      {
+        col_row (i, &expected);
+        status |= gsl_ntuple_col_read (ntuple);
+        status |= (memcmp (&row, &expected, sizeof (row)) != 0);
+      }
+
+    gsl_test (status, "gsl_ntuple_col_read flags=%d chunk=%zu", flags, chunk_size);
+
+    status = gsl_ntuple_col_read (ntuple);
+    gsl_test_int (status, GSL_EOF, "gsl_ntuple_col_read EOF flags=%d chunk=%zu",
+                  flags, chunk_size);
+
+    gsl_ntuple_col_close (ntuple);
+  }
+
+  /* projection reading only columns x and y, with and without chunk skipping */
+  for (i = 0; i < 2; i++)
+    {
+      const size_t pcols[2] = { 4, 2 };
+      gsl_ntuple_col *ntuple = gsl_ntuple_col_open ("test_col.dat", &row, sizeof (row));
+      gsl_histogram *h = gsl_histogram_calloc_uniform (100, 0.0, 1.0);
+      size_t k;
+
+      row.num = -1;
+      params.nselect = 0;
+
+      gsl_ntuple_col_project (h, ntuple, pcols, 2, &V, &S, i ? &C : NULL);
+      gsl_ntuple_col_close (ntuple);
+
+      status = (row.num != -1);
+
+      for (k = 0; k < 100; k++)
+        status |= (h->bin[k] != f[k]);
+
+      gsl_test (status, "gsl_ntuple_col_project flags=%d chunk=%zu skip=%d",
+                flags, chunk_size, i);
+
+      if (i && chunk_size < NROWS)
+        gsl_test (params.nselect >= NROWS, "gsl_ntuple_col_project skipped chunks flags=%d chunk=%zu",
+                  flags, chunk_size);
+      else if (!i)
+        gsl_test_int (params.nselect, NROWS, "gsl_ntuple_col_project rows flags=%d chunk=%zu",
+                      flags, chunk_size);
+
+      gsl_histogram_free (h);
+    }
+
+  /* projection of the rows remaining after a partial read */
+  {
+    gsl_ntuple_col *ntuple = gsl_ntuple_col_open ("test_col.dat", &row, sizeof (row));
+    gsl_histogram *h = gsl_histogram_calloc_uniform (1, 0.0, 1.0);
+
+    for (i = 0; i < 10; i++)
+      gsl_ntuple_col_read (ntuple);
+
+    params.nselect = 0;
+    gsl_ntuple_col_project (h, ntuple, NULL, 0, &V, &Sall, NULL);
+    gsl_ntuple_col_close (ntuple);
+
+    gsl_test_int (params.nselect, NROWS - 10, "gsl_ntuple_col_project remaining flags=%d chunk=%zu",
+                  flags, chunk_size);
+
+    gsl_histogram_free (h);
+  }
+
+  return fsize;
+}
+
+void
+test_col (void)
+{
+  long size0, size1;
+
+  size0 = test_col_file (0, 64);
+  size1 = test_col_file (GSL_NTUPLE_COMPRESS, 64);
+  test_col_file (GSL_NTUPLE_COMPRESS, 1);
+  test_col_file (GSL_NTUPLE_COMPRESS, 1000);
+  test_col_file (0, 5000);
+
+  gsl_test (size1 >= size0, "gsl_ntuple_col compression %ld vs %ld", size1, size0);
+}
@@ -34,6 +34,7 @@
 
 #include "odeiv_util.h"
 #include "step_utils.c"
+#include "jacobian.c"
 
 #define SEQUENCE_COUNT 8
 #define SEQUENCE_MAX   7
@@ -45,8 +46,6 @@ static const int bd_sequence[SEQUENCE_COUNT] =
 typedef struct
 {
   gsl_matrix *d;                /* workspace for extrapolation         */
-  gsl_matrix *a_mat;            /* workspace for linear system matrix  */
-  gsl_permutation *p_vec;       /* workspace for LU permutation        */
 
   double x[SEQUENCE_MAX];       /* workspace for extrapolation */
 
@@ -67,7 +66,7 @@ typedef struct
   double *y_temp;
   double *delta_temp;
   double *weight;
-  gsl_matrix *dfdy;
+  odeiv2_jac_t *jac;            /* Jacobian and linear system matrix */
 
   /* workspace for the basic stepper */
   double *rhs_temp;
@@ -201,14 +200,11 @@ bsimp_step_local (void *vstate,
                   const double y[],
                   const double yp[],
                   const double dfdt[],
-                  const gsl_matrix * dfdy,
+                  odeiv2_jac_t * jac,
                   double y_out[], const gsl_odeiv2_system * sys)
 {
   bsimp_state_t *state = (bsimp_state_t *) vstate;
 
-  gsl_matrix *const a_mat = state->a_mat;
-  gsl_permutation *const p_vec = state->p_vec;
-
   double *const delta = state->delta;
   double *const y_temp = state->y_temp;
   double *const delta_temp = state->delta_temp;
@@ -231,23 +227,19 @@ bsimp_step_local (void *vstate,
 
   const double max_sum = 100.0 * dim;
 
-  int signum, status;
-  size_t i, j;
+  int status;
+  size_t i;
   size_t n_inter;
 
-  /* Calculate the matrix for the linear system. */
-  for (i = 0; i < dim; i++)
-    {
-      for (j = 0; j < dim; j++)
-        {
-          gsl_matrix_set (a_mat, i, j, -h * gsl_matrix_get (dfdy, i, j));
-        }
-      gsl_matrix_set (a_mat, i, i, gsl_matrix_get (a_mat, i, i) + 1.0);
-    }
+  /* Calculate the matrix I - h * dfdy for the linear system and
+     decompose it. */
 
-  /* LU decomposition for the linear system. */
+  status = odeiv2_jac_decomp (jac, NULL, h);
 
-  gsl_linalg_LU_decomp (a_mat, p_vec, &signum);
+  if (status)
+    {
+      return status;
+    }
 
   /* Compute weighting factors */
 
@@ -260,8 +252,13 @@ bsimp_step_local (void *vstate,
       y_temp[i] = h * (yp[i] + h * dfdt[i]);
     }
 
-  gsl_linalg_LU_solve (a_mat, p_vec, &y_temp_vec.vector,
-                       &delta_temp_vec.vector);
+  status = odeiv2_jac_solve (jac, &y_temp_vec.vector,
+                             &delta_temp_vec.vector);
+
+  if (status)
+    {
+      return status;
+    }
 
   sum = 0.0;
 
@@ -294,8 +291,13 @@ bsimp_step_local (void *vstate,
           rhs_temp[i] = h * y_out[i] - delta[i];
         }
 
-      gsl_linalg_LU_solve (a_mat, p_vec, &rhs_temp_vec.vector,
-                           &delta_temp_vec.vector);
+      status = odeiv2_jac_solve (jac, &rhs_temp_vec.vector,
+                                 &delta_temp_vec.vector);
+
+      if (status)
+        {
+          return status;
+        }
 
       sum = 0.0;
 
@@ -329,8 +331,13 @@ bsimp_step_local (void *vstate,
       rhs_temp[i] = h * y_out[i] - delta[i];
     }
 
-  gsl_linalg_LU_solve (a_mat, p_vec, &rhs_temp_vec.vector,
-                       &delta_temp_vec.vector);
+  status = odeiv2_jac_solve (jac, &rhs_temp_vec.vector,
+                             &delta_temp_vec.vector);
+
+  if (status)
+    {
+      return status;
+    }
 
   sum = 0.0;
 
@@ -355,8 +362,6 @@ bsimp_alloc (size_t dim)
   bsimp_state_t *state = (bsimp_state_t *) malloc (sizeof (bsimp_state_t));
 
   state->d = gsl_matrix_alloc (SEQUENCE_MAX, dim);
-  state->a_mat = gsl_matrix_alloc (dim, dim);
-  state->p_vec = gsl_permutation_alloc (dim);
 
   state->yp = (double *) malloc (dim * sizeof (double));
   state->y_save = (double *) malloc (dim * sizeof (double));
@@ -369,7 +374,7 @@ bsimp_alloc (size_t dim)
   state->delta_temp = (double *) malloc (dim * sizeof (double));
   state->weight = (double *) malloc (dim * sizeof (double));
 
-  state->dfdy = gsl_matrix_alloc (dim, dim);
+  state->jac = odeiv2_jac_alloc (dim, 1);
 
   state->rhs_temp = (double *) malloc (dim * sizeof (double));
   state->delta = (double *) malloc (dim * sizeof (double));
@@ -410,7 +415,7 @@ bsimp_apply (void *vstate,
   double *const extrap_work = state->extrap_work;
   double *const dfdt = state->dfdt;
   gsl_matrix *d = state->d;
-  gsl_matrix *dfdy = state->dfdy;
+  odeiv2_jac_t *jac = state->jac;
 
   const double t_local = t;
   size_t i, k;
@@ -443,7 +448,7 @@ bsimp_apply (void *vstate,
 
   /* Evaluate the Jacobian for the system. */
   {
-    int s = GSL_ODEIV_JA_EVAL (sys, t_local, y, dfdy->data, dfdt);
+    int s = odeiv2_jac_eval (jac, sys, t_local, y, dfdt);
 
     if (s != GSL_SUCCESS)
       {
@@ -464,7 +469,7 @@ bsimp_apply (void *vstate,
       int status = bsimp_step_local (state,
                                      dim, t_local, h, N,
                                      y_extrap_save, yp,
-                                     dfdt, dfdy,
+                                     dfdt, jac,
                                      y_extrap_sequence,
                                      sys);
 
@@ -537,7 +542,7 @@ bsimp_free (void *vstate)
   free (state->delta);
   free (state->rhs_temp);
 
-  gsl_matrix_free (state->dfdy);
+  odeiv2_jac_free (state->jac);
 
   free (state->weight);
   free (state->delta_temp);
@@ -550,12 +555,18 @@ bsimp_free (void *vstate)
   free (state->yerr_save);
   free (state->yp);
 
-  gsl_permutation_free (state->p_vec);
-  gsl_matrix_free (state->a_mat);
   gsl_matrix_free (state->d);
   free (state);
 }
 
+static void *
+bsimp_jacobian (void *vstate)
+{
+  bsimp_state_t *state = (bsimp_state_t *) vstate;
+
+  return &state->jac->in;
+}
+
 static const gsl_odeiv2_step_type bsimp_type = {
   "bsimp",                      /* name */
   1,                            /* can use dydt_in */
@@ -565,7 +576,11 @@ static const gsl_odeiv2_step_type bsimp_type = {
   &stepper_set_driver_null,
   &bsimp_reset,
   &bsimp_order,
-  &bsimp_free
+  &bsimp_free,
+  NULL,                         /* no dense output */
+  NULL,                         /* no caller-provided workspace */
+  NULL,
+  &bsimp_jacobian
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_bsimp = &bsimp_type;
@@ -23,6 +23,7 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_odeiv2.h>
+#include "odeiv_util.h"
 #include "control_utils.c"
 
 typedef struct
@@ -204,6 +205,41 @@ gsl_odeiv2_control_standard_new (double eps_abs, double eps_rel,
   return c;
 }
 
+size_t
+gsl_odeiv2_control_standard_workspace_size (void)
+{
+  return ODEIV_ALIGN (sizeof (gsl_odeiv2_control))
+    + sizeof (std_control_state_t);
+}
+
+gsl_odeiv2_control *
+gsl_odeiv2_control_standard_init (void *work, size_t size,
+                                  double eps_abs, double eps_rel,
+                                  double a_y, double a_dydt)
+{
+  /* Constructs a standard control object in the caller buffer work */
+
+  gsl_odeiv2_control *c = (gsl_odeiv2_control *) work;
+  int status;
+
+  if (size < gsl_odeiv2_control_standard_workspace_size ())
+    {
+      GSL_ERROR_NULL ("workspace is too small", GSL_EINVAL);
+    }
+
+  c->type = gsl_odeiv2_control_standard;
+  c->state = (char *) work + ODEIV_ALIGN (sizeof (gsl_odeiv2_control));
+
+  status = gsl_odeiv2_control_init (c, eps_abs, eps_rel, a_y, a_dydt);
+
+  if (status != GSL_SUCCESS)
+    {
+      GSL_ERROR_NULL ("error trying to initialize control", status);
+    }
+
+  return c;
+}
+
 gsl_odeiv2_control *
 gsl_odeiv2_control_y_new (double eps_abs, double eps_rel)
 {
@@ -0,0 +1,338 @@
+/* ode-initval2/dense.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Dense output for explicit one-step methods. The solution on the
+   last step [t0, t0 + h] is approximated by a Hermite-Birkhoff
+   polynomial p(theta), theta = (t - t0) / h, which matches y and h
+   dydt at both ends of the step and h dydt at L interior nodes
+   theta_j. The derivatives at the nodes are obtained by bootstrapping:
+   starting from the cubic Hermite interpolant, each sweep evaluates
+   the derivative at the value of the current interpolant at the
+   nodes used so far and at one new node, which raises the order of
+   the interpolant by one. With L nodes the interpolant has local
+   error O(h^(L+4)) and costs L (L + 1) / 2 evaluations, which are
+   made only when it is first used on a step.
+
+   Reference: Enright, W.H., Jackson, K.R., Norsett, S.P., Thomsen,
+   P.G., Interpolants for Runge-Kutta formulas, ACM Transactions on
+   Mathematical Software 12 (1986) 193-218.
+*/
+
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_permutation.h>
+#include <gsl/gsl_linalg.h>
+
+/* interior nodes of the bootstrap evaluations, in order of use. The
+   nodes are chosen so that the interpolation conditions of every
+   level are well conditioned; e.g. theta = 1/2 as the first node
+   makes them singular. */
+
+static const double dense_nodes[] =
+  { 1.0 / 3.0, 2.0 / 3.0, 1.0 / 5.0, 1.0 / 2.0 };
+
+#define DENSE_MAX_BOOT (sizeof (dense_nodes) / sizeof (dense_nodes[0]))
+
+typedef struct
+{
+  size_t dim;
+  size_t nboot;                 /* number of interior nodes */
+  size_t nlevel;                /* bootstrap sweeps done on this step */
+  int valid;                    /* step data is available */
+  int have_f1;                  /* derivative at end of step is available */
+  double t0;                    /* start of step */
+  double h;                     /* step size */
+  double *data;                 /* y0, y1, h f0, h f1, h f(theta_j), each dim */
+  double *minv;                 /* inverse condition matrix of each level */
+  double *ytmp;
+  double *ftmp;                 /* derivatives of a sweep, nboot * dim */
+}
+odeiv2_dense_t;
+
+static double *
+dense_minv (const odeiv2_dense_t * dense, const size_t level)
+{
+  /* The matrix of level L has size (4 + L), and the matrices are
+     stored one after the other */
+
+  size_t offset = 0, l;
+
+  for (l = 0; l < level; l++)
+    offset += (4 + l) * (4 + l);
+
+  return dense->minv + offset;
+}
+
+static int
+dense_init_level (odeiv2_dense_t * dense, const size_t level)
+{
+  /* Inverts the matrix M which maps the monomial coefficients of a
+     polynomial of degree 3 + level to its interpolation conditions
+     p(0), p(1), p'(0), p'(1), p'(theta_j), j < level. M is small, so
+     it is factorized in automatic storage. */
+
+  const size_t m = 4 + level;
+  double mdata[(4 + DENSE_MAX_BOOT) * (4 + DENSE_MAX_BOOT)];
+  size_t pdata[4 + DENSE_MAX_BOOT];
+  gsl_matrix_view M = gsl_matrix_view_array (mdata, m, m);
+  gsl_matrix_view Minv = gsl_matrix_view_array (dense_minv (dense, level),
+                                                m, m);
+  gsl_permutation perm;
+  size_t i, c;
+  int signum, status;
+
+  perm.size = m;
+  perm.data = pdata;
+
+  gsl_matrix_set_zero (&M.matrix);
+
+  for (c = 0; c < m; c++)
+    {
+      gsl_matrix_set (&M.matrix, 0, c, (c == 0) ? 1.0 : 0.0);
+      gsl_matrix_set (&M.matrix, 1, c, 1.0);
+      gsl_matrix_set (&M.matrix, 2, c, (c == 1) ? 1.0 : 0.0);
+      gsl_matrix_set (&M.matrix, 3, c, (double) c);
+
+      for (i = 0; i < level; i++)
+        {
+          const double dp =
+            (c == 0) ? 0.0 : c * gsl_pow_int (dense_nodes[i], c - 1);
+          gsl_matrix_set (&M.matrix, 4 + i, c, dp);
+        }
+    }
+
+  status = gsl_linalg_LU_decomp (&M.matrix, &perm, &signum);
+
+  if (status == GSL_SUCCESS)
+    status = gsl_linalg_LU_invert (&M.matrix, &perm, &Minv.matrix);
+
+  return status;
+}
+
+static size_t
+dense_nminv (const size_t nboot)
+{
+  size_t nminv = 0, l;
+
+  for (l = 0; l <= nboot; l++)
+    nminv += (4 + l) * (4 + l);
+
+  return nminv;
+}
+
+static size_t
+odeiv2_dense_size (const size_t dim, const size_t nboot)
+{
+  /* Size in bytes of the block used by odeiv2_dense_init */
+
+  return ODEIV_ALIGN (sizeof (odeiv2_dense_t))
+    + ((4 + nboot) * dim + dense_nminv (nboot) + dim + (nboot + 1) * dim)
+    * sizeof (double);
+}
+
+static odeiv2_dense_t *
+odeiv2_dense_init (void *mem, const size_t dim, const size_t nboot)
+{
+  /* Lays out the dense output data in the block mem of
+     odeiv2_dense_size (dim, nboot) bytes and computes the condition
+     matrices */
+
+  odeiv2_dense_t *dense = (odeiv2_dense_t *) mem;
+  double *w =
+    (double *) ((char *) mem + ODEIV_ALIGN (sizeof (odeiv2_dense_t)));
+  size_t l;
+
+  if (nboot > DENSE_MAX_BOOT)
+    {
+      GSL_ERROR_NULL ("too many bootstrap nodes for dense output",
+                      GSL_EINVAL);
+    }
+
+  dense->dim = dim;
+  dense->nboot = nboot;
+  dense->nlevel = 0;
+  dense->valid = 0;
+  dense->have_f1 = 0;
+  dense->t0 = 0.0;
+  dense->h = 0.0;
+  dense->data = w;
+  dense->minv = dense->data + (4 + nboot) * dim;
+  dense->ytmp = dense->minv + dense_nminv (nboot);
+  dense->ftmp = dense->ytmp + dim;
+
+  for (l = 0; l <= nboot; l++)
+    {
+      if (dense_init_level (dense, l) != GSL_SUCCESS)
+        {
+          GSL_ERROR_NULL ("failed to initialize dense output", GSL_EFAILED);
+        }
+    }
+
+  return dense;
+}
+
+static void
+odeiv2_dense_reset (odeiv2_dense_t * dense)
+{
+  dense->valid = 0;
+}
+
+static void
+odeiv2_dense_set (odeiv2_dense_t * dense, const double t0, const double h,
+                  const double y0[], const double y1[], const double f0[],
+                  const double f1[])
+{
+  /* Stores the data of an accepted step. f1 may be NULL, in which case
+     the derivative at the end of the step is evaluated when needed. */
+
+  const size_t dim = dense->dim;
+  double *const data = dense->data;
+  size_t i;
+
+  for (i = 0; i < dim; i++)
+    {
+      data[i] = y0[i];
+      data[dim + i] = y1[i];
+      data[2 * dim + i] = h * f0[i];
+    }
+
+  if (f1 != NULL)
+    {
+      for (i = 0; i < dim; i++)
+        data[3 * dim + i] = h * f1[i];
+    }
+
+  dense->t0 = t0;
+  dense->h = h;
+  dense->have_f1 = (f1 != NULL);
+  dense->nlevel = 0;
+  dense->valid = 1;
+}
+
+static void
+dense_poly (const odeiv2_dense_t * dense, const size_t level,
+            const double theta, double y[])
+{
+  /* Evaluates the interpolant of the given level at theta */
+
+  const size_t dim = dense->dim;
+  const size_t m = 4 + level;
+  const double *minv = dense_minv (dense, level);
+  double w[4 + DENSE_MAX_BOOT];
+  size_t r, c, i;
+
+  for (r = 0; r < m; r++)
+    {
+      /* w_r = sum_c theta^c Minv(c,r), by Horner's rule */
+
+      double wr = 0.0;
+
+      for (c = m; c-- > 0;)
+        wr = wr * theta + minv[c * m + r];
+
+      w[r] = wr;
+    }
+
+  for (i = 0; i < dim; i++)
+    {
+      double yi = 0.0;
+
+      for (r = 0; r < m; r++)
+        yi += w[r] * dense->data[r * dim + i];
+
+      y[i] = yi;
+    }
+}
+
+static int
+odeiv2_dense_eval (odeiv2_dense_t * dense, const double t, double y[],
+                   const gsl_odeiv2_system * sys)
+{
+  const size_t dim = dense->dim;
+  const double t0 = dense->t0;
+  const double h = dense->h;
+  double theta;
+
+  if (!dense->valid)
+    {
+      GSL_ERROR ("no step available for interpolation", GSL_EINVAL);
+    }
+
+  /* Allow for rounding of t0 + h at the end of the step */
+
+  {
+    const double t1 = t0 + h;
+    const double tol =
+      4.0 * GSL_DBL_EPSILON * GSL_MAX_DBL (fabs (t0), fabs (t1));
+
+    if (t < GSL_MIN_DBL (t0, t1) - tol || t > GSL_MAX_DBL (t0, t1) + tol)
+      {
+        GSL_ERROR ("t is outside of the last step", GSL_EDOM);
+      }
+  }
+
+  if (!dense->have_f1)
+    {
+      double *const f1 = &dense->data[3 * dim];
+      size_t i;
+      int s = GSL_ODEIV_FN_EVAL (sys, t0 + h, &dense->data[dim], f1);
+
+      if (s != GSL_SUCCESS)
+        return s;
+
+      for (i = 0; i < dim; i++)
+        f1[i] *= h;
+
+      dense->have_f1 = 1;
+    }
+
+  /* Bootstrap sweeps over the interior nodes */
+
+  while (dense->nlevel < dense->nboot)
+    {
+      const size_t l = dense->nlevel;
+      size_t i, j;
+
+      for (j = 0; j <= l; j++)
+        {
+          const double tj = dense_nodes[j];
+          double *const fj = &dense->ftmp[j * dim];
+          int s;
+
+          dense_poly (dense, l, tj, dense->ytmp);
+
+          s = GSL_ODEIV_FN_EVAL (sys, t0 + tj * h, dense->ytmp, fj);
+
+          if (s != GSL_SUCCESS)
+            return s;
+        }
+
+      for (i = 0; i < (l + 1) * dim; i++)
+        dense->data[4 * dim + i] = h * dense->ftmp[i];
+
+      dense->nlevel++;
+    }
+
+  theta = (h != 0.0) ? (t - t0) / h : 0.0;
+
+  dense_poly (dense, dense->nboot, theta, y);
+
+  return GSL_SUCCESS;
+}
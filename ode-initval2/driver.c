@@ -24,10 +24,13 @@
 
 #include <config.h>
 #include <math.h>
+#include <string.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_odeiv2.h>
 #include <gsl/gsl_machine.h>
 
+#include "odeiv_util.h"
+
 static gsl_odeiv2_driver *
 driver_alloc (const gsl_odeiv2_system * sys, const double hstart,
               const gsl_odeiv2_step_type * T)
@@ -322,17 +325,200 @@ gsl_odeiv2_driver_alloc_scaled_new (const gsl_odeiv2_system * sys,
   return state;
 }
 
-int
-gsl_odeiv2_driver_apply (gsl_odeiv2_driver * d, double *t,
-                         const double t1, double y[])
+size_t
+gsl_odeiv2_driver_workspace_size (const gsl_odeiv2_step_type * T,
+                                  const size_t dim)
 {
-  /* Main driver function that evolves the system from t to t1. In
-     beginning vector y contains the values of dependent variables at
-     t. This function returns values at t=t1 in y. In case of
-     unrecoverable error, y and t contains the values after the last
-     successful step.
+  /* Returns the number of bytes needed by the
+     gsl_odeiv2_driver_init_*_new functions, or zero if the stepper
+     cannot be constructed in a caller buffer */
+
+  const size_t ssize = gsl_odeiv2_step_workspace_size (T, dim);
+
+  if (ssize == 0)
+    {
+      return 0;
+    }
+
+  return ODEIV_ALIGN (sizeof (gsl_odeiv2_driver)) + ODEIV_ALIGN (ssize)
+    + ODEIV_ALIGN (gsl_odeiv2_control_standard_workspace_size ())
+    + gsl_odeiv2_evolve_workspace_size (dim);
+}
+
+gsl_odeiv2_driver *
+gsl_odeiv2_driver_init_standard_new (void *work, const size_t size,
+                                     const gsl_odeiv2_system * sys,
+                                     const gsl_odeiv2_step_type * T,
+                                     const double hstart,
+                                     const double epsabs,
+                                     const double epsrel, const double a_y,
+                                     const double a_dydt)
+{
+  /* Constructs an ODE driver system with control object of type
+     standard_new in the caller buffer work. The driver, step, control
+     and evolve objects are laid out one after the other, and no
+     memory is allocated.
    */
 
+  gsl_odeiv2_driver *state = (gsl_odeiv2_driver *) work;
+  char *p = (char *) work;
+  size_t dim, ssize, csize;
+
+  if (sys == NULL)
+    {
+      GSL_ERROR_NULL ("gsl_odeiv2_system must be defined", GSL_EINVAL);
+    }
+
+  dim = sys->dimension;
+
+  if (dim == 0)
+    {
+      GSL_ERROR_NULL
+        ("gsl_odeiv2_system dimension must be a positive integer",
+         GSL_EINVAL);
+    }
+
+  ssize = gsl_odeiv2_step_workspace_size (T, dim);
+  csize = gsl_odeiv2_control_standard_workspace_size ();
+
+  if (ssize == 0)
+    {
+      GSL_ERROR_NULL ("stepper does not support caller-provided workspace",
+                      GSL_EUNIMPL);
+    }
+
+  if (size < gsl_odeiv2_driver_workspace_size (T, dim))
+    {
+      GSL_ERROR_NULL ("workspace is too small", GSL_EINVAL);
+    }
+
+  if (!(hstart > 0.0 || hstart < 0.0))
+    {
+      GSL_ERROR_NULL ("invalid hstart", GSL_EINVAL);
+    }
+
+  if (!(epsabs >= 0.0 && epsrel >= 0.0))
+    {
+      GSL_ERROR_NULL ("epsabs and epsrel must be positive", GSL_EINVAL);
+    }
+
+  p += ODEIV_ALIGN (sizeof (gsl_odeiv2_driver));
+  state->s = gsl_odeiv2_step_init (p, ssize, T, dim);
+
+  if (state->s == NULL)
+    {
+      GSL_ERROR_NULL ("failed to initialize step object", GSL_EFAILED);
+    }
+
+  p += ODEIV_ALIGN (ssize);
+  state->c =
+    gsl_odeiv2_control_standard_init (p, csize, epsabs, epsrel, a_y, a_dydt);
+
+  if (state->c == NULL)
+    {
+      GSL_ERROR_NULL ("failed to initialize control object", GSL_EINVAL);
+    }
+
+  p += ODEIV_ALIGN (csize);
+  state->e =
+    gsl_odeiv2_evolve_init (p, gsl_odeiv2_evolve_workspace_size (dim), dim);
+
+  state->sys = sys;
+  state->h = hstart;
+  state->hmin = 0.0;
+  state->hmax = GSL_DBL_MAX;
+  state->nmax = 0;
+  state->n = 0;
+
+  /* Distribute pointer to driver object */
+
+  gsl_odeiv2_step_set_driver (state->s, state);
+  gsl_odeiv2_evolve_set_driver (state->e, state);
+  gsl_odeiv2_control_set_driver (state->c, state);
+
+  return state;
+}
+
+gsl_odeiv2_driver *
+gsl_odeiv2_driver_init_y_new (void *work, const size_t size,
+                              const gsl_odeiv2_system * sys,
+                              const gsl_odeiv2_step_type * T,
+                              const double hstart, const double epsabs,
+                              const double epsrel)
+{
+  return gsl_odeiv2_driver_init_standard_new (work, size, sys, T, hstart,
+                                              epsabs, epsrel, 1.0, 0.0);
+}
+
+gsl_odeiv2_driver *
+gsl_odeiv2_driver_init_yp_new (void *work, const size_t size,
+                               const gsl_odeiv2_system * sys,
+                               const gsl_odeiv2_step_type * T,
+                               const double hstart, const double epsabs,
+                               const double epsrel)
+{
+  return gsl_odeiv2_driver_init_standard_new (work, size, sys, T, hstart,
+                                              epsabs, epsrel, 0.0, 1.0);
+}
+
+int
+gsl_odeiv2_driver_set_event (gsl_odeiv2_driver * d,
+                             const gsl_odeiv2_event * ev)
+{
+  /* Sets event functions which stop gsl_odeiv2_driver_apply at their
+     first zero crossing. ev = NULL removes the event functions. */
+
+  return gsl_odeiv2_evolve_set_event (d->e, ev);
+}
+
+int
+gsl_odeiv2_driver_set_jacobian_band (gsl_odeiv2_driver * d,
+                                     int (*jacobian) (double t,
+                                                      const double y[],
+                                                      gsl_matrix * dfdy,
+                                                      double dfdt[],
+                                                      void *params),
+                                     const size_t lower, const size_t upper)
+{
+  /* Sets a banded jacobian for the implicit stepper of the driver */
+
+  return gsl_odeiv2_step_set_jacobian_band (d->s, jacobian, lower, upper);
+}
+
+int
+gsl_odeiv2_driver_set_jacobian_sparse (gsl_odeiv2_driver * d,
+                                       int (*jacobian) (double t,
+                                                        const double y[],
+                                                        gsl_spmatrix * dfdy,
+                                                        double dfdt[],
+                                                        void *params))
+{
+  /* Sets a sparse jacobian for the implicit stepper of the driver */
+
+  return gsl_odeiv2_step_set_jacobian_sparse (d->s, jacobian);
+}
+
+int
+gsl_odeiv2_driver_set_jacobian_pattern (gsl_odeiv2_driver * d,
+                                        const gsl_spmatrix * pattern)
+{
+  /* Sets the sparsity pattern of a jacobian approximated by finite
+     differences for the implicit stepper of the driver */
+
+  return gsl_odeiv2_step_set_jacobian_pattern (d->s, pattern);
+}
+
+static int
+driver_evolve (gsl_odeiv2_driver * d, double *t, const double t1,
+               double y[], const double tout[], const size_t nout,
+               double yout[])
+{
+  /* Evolves the system from t to t1, storing the solution at the
+     nout times tout[] in yout[] from the dense output of each
+     accepted step */
+
+  const size_t dim = d->sys->dimension;
+  size_t k = 0;
   int sign = 0;
   d->n = 0;
 
@@ -356,6 +542,34 @@ gsl_odeiv2_driver_apply (gsl_odeiv2_driver * d, double *t,
          GSL_EINVAL);
     }
 
+  /* Check the output times */
+
+  for (k = 0; k < nout; k++)
+    {
+      if (sign * (tout[k] - *t) < 0.0 || sign * (t1 - tout[k]) < 0.0)
+        {
+          GSL_ERROR ("output times must lie between t and t1", GSL_EINVAL);
+        }
+
+      if (k > 0 && sign * (tout[k] - tout[k - 1]) < 0.0)
+        {
+          GSL_ERROR ("output times must be ordered in the direction of "
+                     "integration", GSL_EINVAL);
+        }
+    }
+
+  if (nout > 0 && d->s->type->interp == NULL)
+    {
+      GSL_ERROR ("stepper does not provide dense output", GSL_EUNIMPL);
+    }
+
+  /* Output times equal to the initial time */
+
+  for (k = 0; k < nout && tout[k] == *t; k++)
+    {
+      DBL_MEMCPY (yout + k * dim, y, dim);
+    }
+
   /* Evolution loop */
 
   while (sign * (t1 - *t) > 0.0)
@@ -368,6 +582,26 @@ gsl_odeiv2_driver_apply (gsl_odeiv2_driver * d, double *t,
           return s;
         }
 
+      /* Interpolate at the output times within the accepted step */
+
+      for (; k < nout && sign * (*t - tout[k]) >= 0.0; k++)
+        {
+          if (tout[k] == *t)
+            {
+              DBL_MEMCPY (yout + k * dim, y, dim);
+            }
+          else
+            {
+              s = gsl_odeiv2_step_interp (d->s, tout[k], yout + k * dim,
+                                          d->sys);
+
+              if (s != GSL_SUCCESS)
+                {
+                  return s;
+                }
+            }
+        }
+
       /* Check for maximum allowed steps */
 
       if ((d->nmax > 0) && (d->n > d->nmax))
@@ -390,11 +624,57 @@ gsl_odeiv2_driver_apply (gsl_odeiv2_driver * d, double *t,
         }
 
       d->n++;
+
+      /* Stop at an event */
+
+      if (d->e->event_found)
+        {
+          break;
+        }
     }
 
   return GSL_SUCCESS;
 }
 
+int
+gsl_odeiv2_driver_apply (gsl_odeiv2_driver * d, double *t,
+                         const double t1, double y[])
+{
+  /* Main driver function that evolves the system from t to t1. In
+     beginning vector y contains the values of dependent variables at
+     t. This function returns values at t=t1 in y. In case of
+     unrecoverable error, y and t contains the values after the last
+     successful step.
+   */
+
+  return driver_evolve (d, t, t1, y, NULL, 0, NULL);
+}
+
+int
+gsl_odeiv2_driver_apply_dense (gsl_odeiv2_driver * d, double *t,
+                               const double t1, double y[],
+                               const double tout[], const size_t nout,
+                               double yout[])
+{
+  /* Evolves the system from t to t1 like gsl_odeiv2_driver_apply,
+     and in addition stores the solution at the times tout[i] in
+     yout[i * dim ... i * dim + dim - 1]. The steps are not shortened
+     to hit the output times; the solution there is obtained from the
+     dense output of the stepper. If an event stops the integration
+     before t1, GSL_CONTINUE is returned and only the outputs at times
+     up to the event are stored.
+   */
+
+  int s = driver_evolve (d, t, t1, y, tout, nout, yout);
+
+  if (s == GSL_SUCCESS && d->e->event_found && *t != t1)
+    {
+      return GSL_CONTINUE;
+    }
+
+  return s;
+}
+
 int
 gsl_odeiv2_driver_apply_fixed_step (gsl_odeiv2_driver * d, double *t,
                                     const double h, const unsigned long int n,
@@ -0,0 +1,739 @@
+/* ode-initval2/ensemble.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Ensemble driver for odeiv2. Integrates n independent copies of a
+   system of dimension dim in lock-step with an explicit embedded
+   Runge-Kutta method. The states are stored in structure-of-arrays
+   layout, y[i * n + k] being component i of member k, so that the
+   user function and the stage updates operate on contiguous batches.
+   Each member has its own time, step size and status, and is masked
+   out of the update once it has reached t1 or failed.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_odeiv2.h>
+#include <gsl/gsl_machine.h>
+
+/* Butcher tableau of an explicit embedded Runge-Kutta method. The
+   coefficients a are stored as a packed lower triangle, row s (s =
+   1..stages-1) starting at offset s (s - 1) / 2. The solution is
+   advanced with the weights b and the error estimate is formed with
+   the weights e.
+ */
+
+typedef struct
+{
+  size_t stages;
+  unsigned int order;
+  const double *c;
+  const double *a;
+  const double *b;
+  const double *e;
+}
+ensemble_tableau;
+
+/* Runge-Kutta-Fehlberg 4(5), as in rkf45.c */
+
+static const double rkf45_c[] = {
+  0.0, 1.0 / 4.0, 3.0 / 8.0, 12.0 / 13.0, 1.0, 1.0 / 2.0
+};
+
+static const double rkf45_a[] = {
+  1.0 / 4.0,
+  3.0 / 32.0, 9.0 / 32.0,
+  1932.0 / 2197.0, -7200.0 / 2197.0, 7296.0 / 2197.0,
+  8341.0 / 4104.0, -32832.0 / 4104.0, 29440.0 / 4104.0, -845.0 / 4104.0,
+  -6080.0 / 20520.0, 41040.0 / 20520.0, -28352.0 / 20520.0,
+    9295.0 / 20520.0, -5643.0 / 20520.0
+};
+
+static const double rkf45_b[] = {
+  902880.0 / 7618050.0, 0.0, 3953664.0 / 7618050.0,
+  3855735.0 / 7618050.0, -1371249.0 / 7618050.0, 277020.0 / 7618050.0
+};
+
+static const double rkf45_e[] = {
+  1.0 / 360.0, 0.0, -128.0 / 4275.0, -2197.0 / 75240.0, 1.0 / 50.0,
+  2.0 / 55.0
+};
+
+/* Cash-Karp 4(5), as in rkck.c */
+
+static const double rkck_c[] = {
+  0.0, 1.0 / 5.0, 0.3, 3.0 / 5.0, 1.0, 7.0 / 8.0
+};
+
+static const double rkck_a[] = {
+  1.0 / 5.0,
+  3.0 / 40.0, 9.0 / 40.0,
+  0.3, -0.9, 1.2,
+  -11.0 / 54.0, 2.5, -70.0 / 27.0, 35.0 / 27.0,
+  1631.0 / 55296.0, 175.0 / 512.0, 575.0 / 13824.0, 44275.0 / 110592.0,
+    253.0 / 4096.0
+};
+
+static const double rkck_b[] = {
+  37.0 / 378.0, 0.0, 250.0 / 621.0, 125.0 / 594.0, 0.0, 512.0 / 1771.0
+};
+
+static const double rkck_e[] = {
+  37.0 / 378.0 - 2825.0 / 27648.0, 0.0,
+  250.0 / 621.0 - 18575.0 / 48384.0, 125.0 / 594.0 - 13525.0 / 55296.0,
+  -277.0 / 14336.0, 512.0 / 1771.0 - 0.25
+};
+
+/* Prince-Dormand 8(7), as in rk8pd.c */
+
+static const double rk8pd_c[] = {
+  0.0,
+  1.0 / 18.0,
+  1.0 / 12.0,
+  1.0 / 8.0,
+  5.0 / 16.0,
+  3.0 / 8.0,
+  59.0 / 400.0,
+  93.0 / 200.0,
+  5490023248.0 / 9719169821.0,
+  13.0 / 20.0,
+  1201146811.0 / 1299019798.0,
+  1.0,
+  1.0
+};
+
+static const double rk8pd_a[] = {
+  1.0 / 18.0,
+  1.0 / 48.0, 1.0 / 16.0,
+  1.0 / 32.0, 0.0, 3.0 / 32.0,
+  5.0 / 16.0, 0.0, -75.0 / 64.0, 75.0 / 64.0,
+  3.0 / 80.0, 0.0, 0.0, 3.0 / 16.0, 3.0 / 20.0,
+  29443841.0 / 614563906.0, 0.0, 0.0, 77736538.0 / 692538347.0,
+    -28693883.0 / 1125000000.0, 23124283.0 / 1800000000.0,
+  16016141.0 / 946692911.0, 0.0, 0.0, 61564180.0 / 158732637.0,
+    22789713.0 / 633445777.0, 545815736.0 / 2771057229.0,
+    -180193667.0 / 1043307555.0,
+  39632708.0 / 573591083.0, 0.0, 0.0, -433636366.0 / 683701615.0,
+    -421739975.0 / 2616292301.0, 100302831.0 / 723423059.0,
+    790204164.0 / 839813087.0, 800635310.0 / 3783071287.0,
+  246121993.0 / 1340847787.0, 0.0, 0.0, -37695042795.0 / 15268766246.0,
+    -309121744.0 / 1061227803.0, -12992083.0 / 490766935.0,
+    6005943493.0 / 2108947869.0, 393006217.0 / 1396673457.0,
+    123872331.0 / 1001029789.0,
+  -1028468189.0 / 846180014.0, 0.0, 0.0, 8478235783.0 / 508512852.0,
+    1311729495.0 / 1432422823.0, -10304129995.0 / 1701304382.0,
+    -48777925059.0 / 3047939560.0, 15336726248.0 / 1032824649.0,
+    -45442868181.0 / 3398467696.0, 3065993473.0 / 597172653.0,
+  185892177.0 / 718116043.0, 0.0, 0.0, -3185094517.0 / 667107341.0,
+    -477755414.0 / 1098053517.0, -703635378.0 / 230739211.0,
+    5731566787.0 / 1027545527.0, 5232866602.0 / 850066563.0,
+    -4093664535.0 / 808688257.0, 3962137247.0 / 1805957418.0,
+    65686358.0 / 487910083.0,
+  403863854.0 / 491063109.0, 0.0, 0.0, -5068492393.0 / 434740067.0,
+    -411421997.0 / 543043805.0, 652783627.0 / 914296604.0,
+    11173962825.0 / 925320556.0, -13158990841.0 / 6184727034.0,
+    3936647629.0 / 1978049680.0, -160528059.0 / 685178525.0,
+    248638103.0 / 1413531060.0, 0.0
+};
+
+static const double rk8pd_b[] = {
+  14005451.0 / 335480064.0,
+  0.0,
+  0.0,
+  0.0,
+  0.0,
+  -59238493.0 / 1068277825.0,
+  181606767.0 / 758867731.0,
+  561292985.0 / 797845732.0,
+  -1041891430.0 / 1371343529.0,
+  760417239.0 / 1151165299.0,
+  118820643.0 / 751138087.0,
+  -528747749.0 / 2220607170.0,
+  1.0 / 4.0
+};
+
+static const double rk8pd_e[] = {
+  13451932.0 / 455176623.0 - 14005451.0 / 335480064.0,
+  0.0,
+  0.0,
+  0.0,
+  0.0,
+  -808719846.0 / 976000145.0 + 59238493.0 / 1068277825.0,
+  1757004468.0 / 5645159321.0 - 181606767.0 / 758867731.0,
+  656045339.0 / 265891186.0 - 561292985.0 / 797845732.0,
+  -3867574721.0 / 1518517206.0 + 1041891430.0 / 1371343529.0,
+  465885868.0 / 322736535.0 - 760417239.0 / 1151165299.0,
+  53011238.0 / 667516719.0 - 118820643.0 / 751138087.0,
+  2.0 / 45.0 + 528747749.0 / 2220607170.0,
+  -1.0 / 4.0
+};
+
+static const ensemble_tableau rkf45_tableau = {
+  6, 5, rkf45_c, rkf45_a, rkf45_b, rkf45_e
+};
+
+static const ensemble_tableau rkck_tableau = {
+  6, 5, rkck_c, rkck_a, rkck_b, rkck_e
+};
+
+static const ensemble_tableau rk8pd_tableau = {
+  13, 8, rk8pd_c, rk8pd_a, rk8pd_b, rk8pd_e
+};
+
+typedef struct
+{
+  const ensemble_tableau *tab;
+  double *k;                    /* stage derivatives, stages * dim * n */
+  double *ytmp;                 /* stage state, dim * n */
+  double *yerr;                 /* error estimate, dim * n */
+  double *tstage;               /* stage times, n */
+  double *hs;                   /* step used in this round, n */
+  int *final;                   /* member takes its final step */
+  int *active;                  /* member still integrating */
+  unsigned long int *n;         /* steps taken in current apply */
+}
+ensemble_state_t;
+
+static void
+ensemble_state_free (ensemble_state_t * state)
+{
+  if (state->k)
+    free (state->k);
+  if (state->ytmp)
+    free (state->ytmp);
+  if (state->yerr)
+    free (state->yerr);
+  if (state->tstage)
+    free (state->tstage);
+  if (state->hs)
+    free (state->hs);
+  if (state->final)
+    free (state->final);
+  if (state->active)
+    free (state->active);
+  if (state->n)
+    free (state->n);
+  free (state);
+}
+
+gsl_odeiv2_ensemble *
+gsl_odeiv2_ensemble_alloc (const gsl_odeiv2_ensemble_system * sys,
+                           const gsl_odeiv2_step_type * T, const size_t n,
+                           const double hstart, const double epsabs,
+                           const double epsrel)
+{
+  const ensemble_tableau *tab;
+  gsl_odeiv2_ensemble *e;
+  ensemble_state_t *state;
+  size_t dim;
+
+  if (sys == NULL)
+    {
+      GSL_ERROR_NULL ("gsl_odeiv2_ensemble_system must be defined",
+                      GSL_EINVAL);
+    }
+
+  dim = sys->dimension;
+
+  if (dim == 0)
+    {
+      GSL_ERROR_NULL
+        ("gsl_odeiv2_ensemble_system dimension must be a positive integer",
+         GSL_EINVAL);
+    }
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("ensemble size must be a positive integer",
+                      GSL_EINVAL);
+    }
+
+  if (T == gsl_odeiv2_step_rkf45)
+    tab = &rkf45_tableau;
+  else if (T == gsl_odeiv2_step_rkck)
+    tab = &rkck_tableau;
+  else if (T == gsl_odeiv2_step_rk8pd)
+    tab = &rk8pd_tableau;
+  else
+    {
+      GSL_ERROR_NULL ("ensemble driver requires rkf45, rkck or rk8pd",
+                      GSL_EINVAL);
+    }
+
+  if (epsabs < 0.0)
+    {
+      GSL_ERROR_NULL ("epsabs is negative", GSL_EINVAL);
+    }
+  else if (epsrel < 0.0)
+    {
+      GSL_ERROR_NULL ("epsrel is negative", GSL_EINVAL);
+    }
+  else if (epsabs == 0.0 && epsrel == 0.0)
+    {
+      GSL_ERROR_NULL ("epsabs and epsrel are both zero", GSL_EINVAL);
+    }
+
+  e = (gsl_odeiv2_ensemble *) calloc (1, sizeof (gsl_odeiv2_ensemble));
+
+  if (e == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for ensemble", GSL_ENOMEM);
+    }
+
+  state = (ensemble_state_t *) calloc (1, sizeof (ensemble_state_t));
+
+  if (state == NULL)
+    {
+      free (e);
+      GSL_ERROR_NULL ("failed to allocate space for ensemble state",
+                      GSL_ENOMEM);
+    }
+
+  e->state = state;
+  state->tab = tab;
+
+  state->k = (double *) malloc (tab->stages * dim * n * sizeof (double));
+  state->ytmp = (double *) malloc (dim * n * sizeof (double));
+  state->yerr = (double *) malloc (dim * n * sizeof (double));
+  state->tstage = (double *) malloc (n * sizeof (double));
+  state->hs = (double *) malloc (n * sizeof (double));
+  state->final = (int *) malloc (n * sizeof (int));
+  state->active = (int *) malloc (n * sizeof (int));
+  state->n = (unsigned long int *) malloc (n * sizeof (unsigned long int));
+
+  e->h = (double *) malloc (n * sizeof (double));
+  e->count = (unsigned long int *) malloc (n * sizeof (unsigned long int));
+  e->failed_steps =
+    (unsigned long int *) malloc (n * sizeof (unsigned long int));
+  e->status = (int *) malloc (n * sizeof (int));
+
+  if (state->k == NULL || state->ytmp == NULL || state->yerr == NULL
+      || state->tstage == NULL || state->hs == NULL || state->final == NULL
+      || state->active == NULL || state->n == NULL || e->h == NULL
+      || e->count == NULL || e->failed_steps == NULL || e->status == NULL)
+    {
+      gsl_odeiv2_ensemble_free (e);
+      GSL_ERROR_NULL ("failed to allocate space for ensemble workspace",
+                      GSL_ENOMEM);
+    }
+
+  e->sys = sys;
+  e->type = T;
+  e->n = n;
+  e->hstart = hstart;
+  e->epsabs = epsabs;
+  e->epsrel = epsrel;
+  e->hmin = 0.0;
+  e->hmax = GSL_DBL_MAX;
+  e->nmax = 0;
+
+  gsl_odeiv2_ensemble_reset (e);
+
+  return e;
+}
+
+int
+gsl_odeiv2_ensemble_set_hmin (gsl_odeiv2_ensemble * e, const double hmin)
+{
+  /* Sets minimum allowed step size fabs(hmin) for all members. */
+
+  if ((fabs (hmin) > fabs (e->hstart)) || (fabs (hmin) > e->hmax))
+    {
+      GSL_ERROR ("hmin <= fabs(h) <= hmax required", GSL_EINVAL);
+    }
+
+  e->hmin = fabs (hmin);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_odeiv2_ensemble_set_hmax (gsl_odeiv2_ensemble * e, const double hmax)
+{
+  /* Sets maximum allowed step size fabs(hmax) for all members. */
+
+  if ((fabs (hmax) < fabs (e->hstart)) || (fabs (hmax) < e->hmin))
+    {
+      GSL_ERROR ("hmin <= fabs(h) <= hmax required", GSL_EINVAL);
+    }
+
+  if (hmax > 0.0 || hmax < 0.0)
+    {
+      e->hmax = fabs (hmax);
+    }
+  else
+    {
+      GSL_ERROR ("invalid hmax", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_odeiv2_ensemble_set_nmax (gsl_odeiv2_ensemble * e,
+                              const unsigned long int nmax)
+{
+  /* Sets maximum number of steps per member in one call to
+     gsl_odeiv2_ensemble_apply. nmax = 0 means no limit. */
+
+  e->nmax = nmax;
+
+  return GSL_SUCCESS;
+}
+
+static int
+ensemble_round (gsl_odeiv2_ensemble * e, double t[], const double t1,
+                double y[])
+{
+  /* Takes one trial step with every active member. Inactive members
+     are evaluated at their current state with a zero step, so that
+     the user function always sees a full batch. Returns nonzero only
+     if the user function fails.
+   */
+
+  ensemble_state_t *state = (ensemble_state_t *) e->state;
+  const ensemble_tableau *tab = state->tab;
+  const gsl_odeiv2_ensemble_system *sys = e->sys;
+  const size_t n = e->n;
+  const size_t dim = sys->dimension;
+  const size_t nt = dim * n;
+  double *const hs = state->hs;
+  size_t i, j, k, s;
+  int status;
+
+  for (k = 0; k < n; k++)
+    {
+      hs[k] = 0.0;
+      state->final[k] = 0;
+
+      if (state->active[k])
+        {
+          const double dt = t1 - t[k];
+
+          hs[k] = e->h[k];
+
+          if ((dt >= 0.0 && hs[k] > dt) || (dt < 0.0 && hs[k] < dt))
+            {
+              hs[k] = dt;
+              state->final[k] = 1;
+            }
+        }
+    }
+
+  /* Stage derivatives */
+
+  status = sys->function (n, t, y, state->k, sys->params);
+
+  if (status != GSL_SUCCESS)
+    return status;
+
+  for (s = 1; s < tab->stages; s++)
+    {
+      const double *a = tab->a + s * (s - 1) / 2;
+      double *const ytmp = state->ytmp;
+
+      memcpy (ytmp, y, nt * sizeof (double));
+
+      for (j = 0; j < s; j++)
+        {
+          const double *kj = state->k + j * nt;
+
+          if (a[j] == 0.0)
+            continue;
+
+          for (i = 0; i < dim; i++)
+            for (k = 0; k < n; k++)
+              ytmp[i * n + k] += hs[k] * a[j] * kj[i * n + k];
+        }
+
+      for (k = 0; k < n; k++)
+        state->tstage[k] = t[k] + tab->c[s] * hs[k];
+
+      status = sys->function (n, state->tstage, ytmp, state->k + s * nt,
+                              sys->params);
+
+      if (status != GSL_SUCCESS)
+        return status;
+    }
+
+  /* New state in ytmp and error estimate in yerr */
+
+  memcpy (state->ytmp, y, nt * sizeof (double));
+  memset (state->yerr, 0, nt * sizeof (double));
+
+  for (j = 0; j < tab->stages; j++)
+    {
+      const double *kj = state->k + j * nt;
+      const double b = tab->b[j];
+      const double er = tab->e[j];
+
+      for (i = 0; i < dim; i++)
+        for (k = 0; k < n; k++)
+          {
+            state->ytmp[i * n + k] += hs[k] * b * kj[i * n + k];
+            state->yerr[i * n + k] += hs[k] * er * kj[i * n + k];
+          }
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+ensemble_control (gsl_odeiv2_ensemble * e, double t[], const double t1,
+                  double y[])
+{
+  /* Accepts or rejects the trial step of each active member using the
+     standard error control of gsl_odeiv2_control_y_new, and adjusts
+     its step size as gsl_odeiv2_evolve_apply and
+     gsl_odeiv2_driver_apply would.
+   */
+
+  ensemble_state_t *state = (ensemble_state_t *) e->state;
+  const ensemble_tableau *tab = state->tab;
+  const size_t n = e->n;
+  const size_t dim = e->sys->dimension;
+  size_t i, k;
+
+  for (k = 0; k < n; k++)
+    {
+      const double h0 = state->hs[k];
+      const double sign = (h0 >= 0.0) ? 1.0 : -1.0;
+      double rmax = GSL_DBL_MIN;
+      double hnew = h0;
+
+      if (!state->active[k])
+        continue;
+
+      for (i = 0; i < dim; i++)
+        {
+          const double D0 =
+            e->epsrel * fabs (state->ytmp[i * n + k]) + e->epsabs;
+          const double r = fabs (state->yerr[i * n + k]) / fabs (D0);
+
+          rmax = GSL_MAX_DBL (r, rmax);
+        }
+
+      if (rmax > 1.1)
+        {
+          /* decrease step, no more than factor of 5, but a fraction S
+             more than scaling suggests (for better accuracy) */
+
+          double r = 0.9 / pow (rmax, 1.0 / tab->order);
+
+          if (r < 0.2)
+            r = 0.2;
+
+          hnew = r * h0;
+
+          {
+            double t_curr = GSL_COERCE_DBL (t[k]);
+            double t_next = GSL_COERCE_DBL (t[k] + hnew);
+
+            if (fabs (hnew) < fabs (h0) && t_next != t_curr)
+              {
+                e->h[k] = hnew;
+                e->failed_steps[k]++;
+              }
+            else
+              {
+                e->h[k] = hnew;
+                e->status[k] = GSL_FAILURE;
+                state->active[k] = 0;
+              }
+          }
+
+          continue;
+        }
+      else if (rmax < 0.5)
+        {
+          /* increase step, no more than factor of 5 */
+
+          double r = 0.9 / pow (rmax, 1.0 / (tab->order + 1.0));
+
+          if (r > 5.0)
+            r = 5.0;
+          else if (r < 1.0)
+            r = 1.0;
+
+          hnew = r * h0;
+        }
+
+      /* Accept the step */
+
+      for (i = 0; i < dim; i++)
+        y[i * n + k] = state->ytmp[i * n + k];
+
+      if (state->final[k])
+        {
+          t[k] = t1;
+        }
+      else
+        {
+          t[k] += h0;
+
+          /* Suggest step size for next time-step. Change of step size
+             is not suggested in the final step, because that step can
+             be very small compared to previous step, to reach t1. */
+
+          e->h[k] = hnew;
+        }
+
+      e->count[k]++;
+
+      /* Check for maximum allowed steps */
+
+      if ((e->nmax > 0) && (state->n[k] > e->nmax))
+        {
+          e->status[k] = GSL_EMAXITER;
+          state->active[k] = 0;
+          continue;
+        }
+
+      /* Set step size if maximum size is exceeded */
+
+      if (fabs (e->h[k]) > e->hmax)
+        {
+          e->h[k] = sign * e->hmax;
+        }
+
+      /* Check for too small step size */
+
+      if (fabs (e->h[k]) < e->hmin)
+        {
+          e->status[k] = GSL_ENOPROG;
+          state->active[k] = 0;
+          continue;
+        }
+
+      state->n[k]++;
+
+      if (!(sign * (t1 - t[k]) > 0.0))
+        {
+          state->active[k] = 0;
+        }
+    }
+}
+
+int
+gsl_odeiv2_ensemble_apply (gsl_odeiv2_ensemble * e, double t[],
+                           const double t1, double y[])
+{
+  /* Evolves all members of the ensemble from t[k] to t1. On input
+     y[i * n + k] contains component i of member k at t[k]. On output
+     members which succeeded have t[k] = t1 and y contains their values
+     at t1; members which failed keep the values after their last
+     successful step and their error code in e->status[k]. The return
+     value is the first nonzero member status, or the error code of the
+     user function if it fails.
+   */
+
+  ensemble_state_t *state = (ensemble_state_t *) e->state;
+  const size_t n = e->n;
+  size_t k;
+  int nactive = 0;
+
+  /* Check that t, t1 and step direction are sensible */
+
+  for (k = 0; k < n; k++)
+    {
+      const double sign = (e->h[k] > 0.0) ? 1.0 : -1.0;
+
+      if (sign * (t1 - t[k]) < 0.0)
+        {
+          GSL_ERROR
+            ("integration limits and/or step direction not consistent",
+             GSL_EINVAL);
+        }
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      const double sign = (e->h[k] > 0.0) ? 1.0 : -1.0;
+
+      state->n[k] = 0;
+      e->status[k] = GSL_SUCCESS;
+      state->active[k] = (sign * (t1 - t[k]) > 0.0);
+      nactive += state->active[k];
+    }
+
+  /* Evolution loop */
+
+  while (nactive > 0)
+    {
+      int s = ensemble_round (e, t, t1, y);
+
+      if (s != GSL_SUCCESS)
+        {
+          return s;
+        }
+
+      ensemble_control (e, t, t1, y);
+
+      nactive = 0;
+
+      for (k = 0; k < n; k++)
+        nactive += state->active[k];
+    }
+
+  for (k = 0; k < n; k++)
+    {
+      if (e->status[k] != GSL_SUCCESS)
+        return e->status[k];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_odeiv2_ensemble_reset (gsl_odeiv2_ensemble * e)
+{
+  /* Resets the step size of every member to hstart and clears the
+     step counters and status flags. */
+
+  size_t k;
+
+  for (k = 0; k < e->n; k++)
+    {
+      e->h[k] = e->hstart;
+      e->count[k] = 0;
+      e->failed_steps[k] = 0;
+      e->status[k] = GSL_SUCCESS;
+    }
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_odeiv2_ensemble_free (gsl_odeiv2_ensemble * e)
+{
+  if (e->state)
+    ensemble_state_free ((ensemble_state_t *) e->state);
+  if (e->h)
+    free (e->h);
+  if (e->count)
+    free (e->count);
+  if (e->failed_steps)
+    free (e->failed_steps);
+  if (e->status)
+    free (e->status);
+  free (e);
+}
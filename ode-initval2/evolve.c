@@ -28,71 +28,69 @@
 
 #include "odeiv_util.h"
 
-gsl_odeiv2_evolve *
-gsl_odeiv2_evolve_alloc (size_t dim)
+size_t
+gsl_odeiv2_evolve_workspace_size (size_t dim)
 {
-  gsl_odeiv2_evolve *e =
-    (gsl_odeiv2_evolve *) malloc (sizeof (gsl_odeiv2_evolve));
-
-  if (e == 0)
-    {
-      GSL_ERROR_NULL ("failed to allocate space for evolve struct",
-                      GSL_ENOMEM);
-    }
-
-  e->y0 = (double *) malloc (dim * sizeof (double));
-
-  if (e->y0 == 0)
-    {
-      free (e);
-      GSL_ERROR_NULL ("failed to allocate space for y0", GSL_ENOMEM);
-    }
-
-  e->yerr = (double *) malloc (dim * sizeof (double));
+  return ODEIV_ALIGN (sizeof (gsl_odeiv2_evolve)) + 4 * dim * sizeof (double);
+}
 
-  if (e->yerr == 0)
-    {
-      free (e->y0);
-      free (e);
-      GSL_ERROR_NULL ("failed to allocate space for yerr", GSL_ENOMEM);
-    }
+gsl_odeiv2_evolve *
+gsl_odeiv2_evolve_init (void *work, size_t size, size_t dim)
+{
+  /* Constructs an evolve object and its vectors in the caller
+     buffer work */
 
-  e->dydt_in = (double *) malloc (dim * sizeof (double));
+  gsl_odeiv2_evolve *e = (gsl_odeiv2_evolve *) work;
+  double *w;
 
-  if (e->dydt_in == 0)
+  if (size < gsl_odeiv2_evolve_workspace_size (dim))
     {
-      free (e->yerr);
-      free (e->y0);
-      free (e);
-      GSL_ERROR_NULL ("failed to allocate space for dydt_in", GSL_ENOMEM);
+      GSL_ERROR_NULL ("workspace is too small", GSL_EINVAL);
     }
 
-  e->dydt_out = (double *) malloc (dim * sizeof (double));
+  w = (double *) ((char *) work + ODEIV_ALIGN (sizeof (gsl_odeiv2_evolve)));
 
-  if (e->dydt_out == 0)
-    {
-      free (e->dydt_in);
-      free (e->yerr);
-      free (e->y0);
-      free (e);
-      GSL_ERROR_NULL ("failed to allocate space for dydt_out", GSL_ENOMEM);
-    }
+  e->y0 = w;
+  e->yerr = w + dim;
+  e->dydt_in = w + 2 * dim;
+  e->dydt_out = w + 3 * dim;
 
   e->dimension = dim;
   e->count = 0;
   e->failed_steps = 0;
   e->last_step = 0.0;
   e->driver = NULL;
+  e->event = NULL;
+  e->g = NULL;
+  e->ytmp = NULL;
+  e->event_found = 0;
+  e->event_index = 0;
 
   return e;
 }
 
+gsl_odeiv2_evolve *
+gsl_odeiv2_evolve_alloc (size_t dim)
+{
+  const size_t size = gsl_odeiv2_evolve_workspace_size (dim);
+  void *work = malloc (size);
+
+  if (work == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for evolve struct",
+                      GSL_ENOMEM);
+    }
+
+  return gsl_odeiv2_evolve_init (work, size, dim);
+}
+
 int
 gsl_odeiv2_evolve_reset (gsl_odeiv2_evolve * e)
 {
   e->count = 0;
   e->failed_steps = 0;
   e->last_step = 0.0;
+  e->event_found = 0;
   return GSL_SUCCESS;
 }
 
@@ -100,13 +98,151 @@ void
 gsl_odeiv2_evolve_free (gsl_odeiv2_evolve * e)
 {
   RETURN_IF_NULL (e);
-  free (e->dydt_out);
-  free (e->dydt_in);
-  free (e->yerr);
-  free (e->y0);
+  if (e->g)
+    free (e->g);
+  if (e->ytmp)
+    free (e->ytmp);
   free (e);
 }
 
+/* Returns 1 if one of the event functions changes sign between ga
+   and gb, and the index of the first such function in index. A
+   function which is zero at the start of the interval does not
+   trigger an event. */
+
+static int
+event_crossing (const double ga[], const double gb[], const size_t n,
+                size_t * index)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      if ((ga[i] < 0.0 && gb[i] >= 0.0) || (ga[i] > 0.0 && gb[i] <= 0.0))
+        {
+          *index = i;
+          return 1;
+        }
+    }
+
+  return 0;
+}
+
+/* Checks the event functions at the end of an accepted step from t0
+   to *t, with g(t0) stored in e->g. If any of them changes sign, the
+   earliest crossing is located on the dense output of the stepper by
+   the Illinois variant of regula falsi, and *t and y are set to the
+   point just past the crossing. */
+
+static int
+evolve_locate_event (gsl_odeiv2_evolve * e, gsl_odeiv2_step * step,
+                     const gsl_odeiv2_system * dydt, const double t0,
+                     double *t, double y[])
+{
+  const gsl_odeiv2_event *ev = e->event;
+  const size_t n = ev->nevents;
+  const size_t max_iter = 100;
+  double *const ga = e->g;
+  double *const gb = e->g + n;
+  double *const gm = e->g + 2 * n;
+  double ta = t0, tb = *t;
+  double alpha_a = 1.0, alpha_b = 1.0;
+  int last = 0;                 /* endpoint moved last, -1 = a, 1 = b */
+  size_t index, iter = 0;
+  int status;
+
+  status = ev->function (tb, y, gb, ev->params);
+
+  if (status != GSL_SUCCESS)
+    return status;
+
+  if (!event_crossing (ga, gb, n, &index))
+    return GSL_SUCCESS;
+
+  {
+    const double ttol =
+      100.0 * GSL_DBL_EPSILON * (fabs (tb) + fabs (tb - ta));
+
+    while (fabs (tb - ta) > ttol && iter++ < max_iter)
+      {
+        double tm = tb;
+        size_t i;
+
+        /* Earliest secant estimate over the functions which change
+           sign, with the Illinois weights alpha */
+
+        for (i = 0; i < n; i++)
+          {
+            if ((ga[i] < 0.0 && gb[i] >= 0.0)
+                || (ga[i] > 0.0 && gb[i] <= 0.0))
+              {
+                const double fa = alpha_a * ga[i];
+                const double fb = alpha_b * gb[i];
+                const double ti = ta + (tb - ta) * fa / (fa - fb);
+
+                if (fabs (ti - ta) < fabs (tm - ta))
+                  tm = ti;
+              }
+          }
+
+        /* Keep tm strictly inside the bracket */
+
+        if (fabs (tm - ta) < 0.5 * ttol)
+          tm = ta + 0.5 * ttol * GSL_SIGN (tb - ta);
+        else if (fabs (tb - tm) < 0.5 * ttol)
+          tm = tb - 0.5 * ttol * GSL_SIGN (tb - ta);
+
+        status = gsl_odeiv2_step_interp (step, tm, e->ytmp, dydt);
+
+        if (status != GSL_SUCCESS)
+          return status;
+
+        status = ev->function (tm, e->ytmp, gm, ev->params);
+
+        if (status != GSL_SUCCESS)
+          return status;
+
+        if (event_crossing (ga, gm, n, &index))
+          {
+            /* crossing in [ta,tm], ta is retained */
+
+            tb = tm;
+            DBL_MEMCPY (gb, gm, n);
+            alpha_a = (last == 1) ? 0.5 * alpha_a : 1.0;
+            alpha_b = 1.0;
+            last = 1;
+          }
+        else
+          {
+            /* crossing in [tm,tb], tb is retained */
+
+            ta = tm;
+            DBL_MEMCPY (ga, gm, n);
+            alpha_b = (last == -1) ? 0.5 * alpha_b : 1.0;
+            alpha_a = 1.0;
+            last = -1;
+          }
+      }
+  }
+
+  event_crossing (ga, gb, n, &index);
+
+  if (tb != *t)
+    {
+      status = gsl_odeiv2_step_interp (step, tb, y, dydt);
+
+      if (status != GSL_SUCCESS)
+        return status;
+
+      *t = tb;
+    }
+
+  e->event_found = 1;
+  e->event_index = index;
+
+  return GSL_SUCCESS;
+}
+
 /* Evolution framework method.
  *
  * Uses an adaptive step control object
@@ -134,6 +270,20 @@ gsl_odeiv2_evolve_apply (gsl_odeiv2_evolve * e,
       GSL_ERROR ("step direction must match interval direction", GSL_EINVAL);
     }
 
+  if (e->event != NULL && step->type->interp == NULL)
+    {
+      GSL_ERROR ("event location requires a stepper with dense output",
+                 GSL_EUNIMPL);
+    }
+
+  /* The previous step was cut short at an event, so the stepper
+     history and dydt_out do not describe the current point. */
+
+  if (e->event_found)
+    {
+      gsl_odeiv2_step_reset (step);
+    }
+
   /* Save y in case of failure in a step */
 
   DBL_MEMCPY (e->y0, y, e->dimension);
@@ -143,7 +293,7 @@ gsl_odeiv2_evolve_apply (gsl_odeiv2_evolve * e,
 
   if (step->type->can_use_dydt_in)
     {
-      if (e->count == 0)
+      if (e->count == 0 || e->event_found)
         {
           int status = GSL_ODEIV_FN_EVAL (dydt, t0, y, e->dydt_in);
 
@@ -158,6 +308,20 @@ gsl_odeiv2_evolve_apply (gsl_odeiv2_evolve * e,
         }
     }
 
+  e->event_found = 0;
+
+  /* Values of the event functions at the start of the step */
+
+  if (e->event != NULL)
+    {
+      int status = e->event->function (t0, y, e->g, e->event->params);
+
+      if (status)
+        {
+          return status;
+        }
+    }
+
 try_step:
 
   if ((dt >= 0.0 && h0 > dt) || (dt < 0.0 && h0 < dt))
@@ -296,6 +460,18 @@ try_step:
       *h = h0;
     }
 
+  /* Stop at the first zero crossing of the event functions */
+
+  if (e->event != NULL)
+    {
+      int status = evolve_locate_event (e, step, dydt, t0, t, y);
+
+      if (status)
+        {
+          return status;
+        }
+    }
+
   return step_status;
 }
 
@@ -381,6 +557,55 @@ gsl_odeiv2_evolve_apply_fixed_step (gsl_odeiv2_evolve * e,
   return GSL_SUCCESS;
 }
 
+int
+gsl_odeiv2_evolve_set_event (gsl_odeiv2_evolve * e,
+                             const gsl_odeiv2_event * ev)
+{
+  /* Sets the event functions checked by gsl_odeiv2_evolve_apply, or
+     removes them if ev is NULL. */
+
+  if (e->g)
+    free (e->g);
+  if (e->ytmp)
+    free (e->ytmp);
+
+  e->event = NULL;
+  e->g = NULL;
+  e->ytmp = NULL;
+  e->event_found = 0;
+  e->event_index = 0;
+
+  if (ev == NULL)
+    {
+      return GSL_SUCCESS;
+    }
+
+  if (ev->nevents == 0)
+    {
+      GSL_ERROR ("number of event functions must be positive", GSL_EINVAL);
+    }
+
+  e->g = (double *) malloc (3 * ev->nevents * sizeof (double));
+
+  if (e->g == 0)
+    {
+      GSL_ERROR ("failed to allocate space for g", GSL_ENOMEM);
+    }
+
+  e->ytmp = (double *) malloc (e->dimension * sizeof (double));
+
+  if (e->ytmp == 0)
+    {
+      free (e->g);
+      e->g = NULL;
+      GSL_ERROR ("failed to allocate space for ytmp", GSL_ENOMEM);
+    }
+
+  e->event = ev;
+
+  return GSL_SUCCESS;
+}
+
 int
 gsl_odeiv2_evolve_set_driver (gsl_odeiv2_evolve * e,
                               const gsl_odeiv2_driver * d)
@@ -26,6 +26,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <gsl/gsl_types.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_spmatrix.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -95,6 +97,11 @@ typedef struct
   int (*reset) (void *state, size_t dim);
   unsigned int (*order) (void *state);
   void (*free) (void *state);
+  int (*interp) (void *state, size_t dim, double t, double y[],
+                 const gsl_odeiv2_system * dydt);
+  size_t (*state_size) (size_t dim);
+  void *(*state_init) (void *mem, size_t dim);
+  void *(*jacobian) (void *state);
 }
 gsl_odeiv2_step_type;
 
@@ -123,6 +130,11 @@ GSL_VAR const gsl_odeiv2_step_type *gsl_odeiv2_step_msbdf;
 
 gsl_odeiv2_step *gsl_odeiv2_step_alloc (const gsl_odeiv2_step_type * T,
                                         size_t dim);
+size_t gsl_odeiv2_step_workspace_size (const gsl_odeiv2_step_type * T,
+                                       size_t dim);
+gsl_odeiv2_step *gsl_odeiv2_step_init (void *work, size_t size,
+                                       const gsl_odeiv2_step_type * T,
+                                       size_t dim);
 int gsl_odeiv2_step_reset (gsl_odeiv2_step * s);
 void gsl_odeiv2_step_free (gsl_odeiv2_step * s);
 const char *gsl_odeiv2_step_name (const gsl_odeiv2_step * s);
@@ -130,9 +142,40 @@ unsigned int gsl_odeiv2_step_order (const gsl_odeiv2_step * s);
 int gsl_odeiv2_step_apply (gsl_odeiv2_step * s, double t, double h,
                            double y[], double yerr[], const double dydt_in[],
                            double dydt_out[], const gsl_odeiv2_system * dydt);
+int gsl_odeiv2_step_interp (gsl_odeiv2_step * s, double t, double y[],
+                            const gsl_odeiv2_system * dydt);
 int gsl_odeiv2_step_set_driver (gsl_odeiv2_step * s,
                                 const gsl_odeiv2_driver * d);
 
+/* Jacobians for large systems
+ *
+ * Instead of the dense jacobian function of the system, the implicit
+ * steppers can use a banded jacobian, in the general banded format
+ * of the linalg band routines with the given lower and upper
+ * bandwidths, or a sparse jacobian filled in triplet format. If only
+ * the sparsity pattern of the jacobian is known, the jacobian is
+ * approximated by finite differences, perturbing structurally
+ * orthogonal groups of columns together. Each setter replaces the
+ * jacobian given by the others.
+ */
+
+int gsl_odeiv2_step_set_jacobian_band (gsl_odeiv2_step * s,
+                                       int (*jacobian) (double t,
+                                                        const double y[],
+                                                        gsl_matrix * dfdy,
+                                                        double dfdt[],
+                                                        void *params),
+                                       const size_t lower,
+                                       const size_t upper);
+int gsl_odeiv2_step_set_jacobian_sparse (gsl_odeiv2_step * s,
+                                         int (*jacobian) (double t,
+                                                          const double y[],
+                                                          gsl_spmatrix * dfdy,
+                                                          double dfdt[],
+                                                          void *params));
+int gsl_odeiv2_step_set_jacobian_pattern (gsl_odeiv2_step * s,
+                                          const gsl_spmatrix * pattern);
+
 /* Step size control object. */
 
 typedef struct
@@ -212,6 +255,13 @@ gsl_odeiv2_control *gsl_odeiv2_control_standard_new (double eps_abs,
                                                      double a_y,
                                                      double a_dydt);
 gsl_odeiv2_control *gsl_odeiv2_control_y_new (double eps_abs, double eps_rel);
+size_t gsl_odeiv2_control_standard_workspace_size (void);
+gsl_odeiv2_control *gsl_odeiv2_control_standard_init (void *work,
+                                                      size_t size,
+                                                      double eps_abs,
+                                                      double eps_rel,
+                                                      double a_y,
+                                                      double a_dydt);
 gsl_odeiv2_control *gsl_odeiv2_control_yp_new (double eps_abs,
                                                double eps_rel);
 
@@ -227,6 +277,21 @@ gsl_odeiv2_control *gsl_odeiv2_control_scaled_new (double eps_abs,
                                                    const double scale_abs[],
                                                    size_t dim);
 
+/* Event functions
+ *
+ * The evolution stops at the first zero crossing of any of the
+ * nevents functions g_i(t,y), located on the dense output of the
+ * stepper.
+ */
+
+typedef struct
+{
+  int (*function) (double t, const double y[], double g[], void *params);
+  size_t nevents;
+  void *params;
+}
+gsl_odeiv2_event;
+
 /* Evolution object */
 
 struct gsl_odeiv2_evolve_struct
@@ -240,11 +305,19 @@ struct gsl_odeiv2_evolve_struct
   unsigned long int count;
   unsigned long int failed_steps;
   const gsl_odeiv2_driver *driver;
+  const gsl_odeiv2_event *event;  /* event functions, or NULL */
+  double *g;                    /* event function values, 3 * nevents */
+  double *ytmp;                 /* work space for event location */
+  int event_found;              /* last step ended at an event */
+  size_t event_index;           /* index of the event function */
 };
 
 /* Evolution object methods */
 
 gsl_odeiv2_evolve *gsl_odeiv2_evolve_alloc (size_t dim);
+size_t gsl_odeiv2_evolve_workspace_size (size_t dim);
+gsl_odeiv2_evolve *gsl_odeiv2_evolve_init (void *work, size_t size,
+                                           size_t dim);
 int gsl_odeiv2_evolve_apply (gsl_odeiv2_evolve * e, gsl_odeiv2_control * con,
                              gsl_odeiv2_step * step,
                              const gsl_odeiv2_system * dydt, double *t,
@@ -259,6 +332,8 @@ int gsl_odeiv2_evolve_reset (gsl_odeiv2_evolve * e);
 void gsl_odeiv2_evolve_free (gsl_odeiv2_evolve * e);
 int gsl_odeiv2_evolve_set_driver (gsl_odeiv2_evolve * e,
                                   const gsl_odeiv2_driver * d);
+int gsl_odeiv2_evolve_set_event (gsl_odeiv2_evolve * e,
+                                 const gsl_odeiv2_event * ev);
 
 /* Driver object
  *
@@ -315,12 +390,66 @@ gsl_odeiv2_driver *gsl_odeiv2_driver_alloc_standard_new (const
                                                          const double epsrel,
                                                          const double a_y,
                                                          const double a_dydt);
+size_t gsl_odeiv2_driver_workspace_size (const gsl_odeiv2_step_type * T,
+                                         const size_t dim);
+gsl_odeiv2_driver *gsl_odeiv2_driver_init_y_new (void *work,
+                                                 const size_t size,
+                                                 const gsl_odeiv2_system *
+                                                 sys,
+                                                 const gsl_odeiv2_step_type *
+                                                 T, const double hstart,
+                                                 const double epsabs,
+                                                 const double epsrel);
+gsl_odeiv2_driver *gsl_odeiv2_driver_init_yp_new (void *work,
+                                                  const size_t size,
+                                                  const gsl_odeiv2_system *
+                                                  sys,
+                                                  const gsl_odeiv2_step_type
+                                                  * T, const double hstart,
+                                                  const double epsabs,
+                                                  const double epsrel);
+gsl_odeiv2_driver *gsl_odeiv2_driver_init_standard_new (void *work,
+                                                        const size_t size,
+                                                        const
+                                                        gsl_odeiv2_system *
+                                                        sys,
+                                                        const
+                                                        gsl_odeiv2_step_type
+                                                        * T,
+                                                        const double hstart,
+                                                        const double epsabs,
+                                                        const double epsrel,
+                                                        const double a_y,
+                                                        const double a_dydt);
 int gsl_odeiv2_driver_set_hmin (gsl_odeiv2_driver * d, const double hmin);
 int gsl_odeiv2_driver_set_hmax (gsl_odeiv2_driver * d, const double hmax);
 int gsl_odeiv2_driver_set_nmax (gsl_odeiv2_driver * d,
                                 const unsigned long int nmax);
+int gsl_odeiv2_driver_set_event (gsl_odeiv2_driver * d,
+                                 const gsl_odeiv2_event * ev);
+int gsl_odeiv2_driver_set_jacobian_band (gsl_odeiv2_driver * d,
+                                         int (*jacobian) (double t,
+                                                          const double y[],
+                                                          gsl_matrix * dfdy,
+                                                          double dfdt[],
+                                                          void *params),
+                                         const size_t lower,
+                                         const size_t upper);
+int gsl_odeiv2_driver_set_jacobian_sparse (gsl_odeiv2_driver * d,
+                                           int (*jacobian) (double t,
+                                                            const double y[],
+                                                            gsl_spmatrix *
+                                                            dfdy,
+                                                            double dfdt[],
+                                                            void *params));
+int gsl_odeiv2_driver_set_jacobian_pattern (gsl_odeiv2_driver * d,
+                                            const gsl_spmatrix * pattern);
 int gsl_odeiv2_driver_apply (gsl_odeiv2_driver * d, double *t,
                              const double t1, double y[]);
+int gsl_odeiv2_driver_apply_dense (gsl_odeiv2_driver * d, double *t,
+                                   const double t1, double y[],
+                                   const double tout[], const size_t nout,
+                                   double yout[]);
 int gsl_odeiv2_driver_apply_fixed_step (gsl_odeiv2_driver * d, double *t,
                                         const double h,
                                         const unsigned long int n,
@@ -329,5 +458,58 @@ int gsl_odeiv2_driver_reset (gsl_odeiv2_driver * d);
 int gsl_odeiv2_driver_reset_hstart (gsl_odeiv2_driver * d, const double hstart);
 void gsl_odeiv2_driver_free (gsl_odeiv2_driver * state);
 
+
+/* Ensemble driver object
+ *
+ * Integrates n independent copies of a system in lock-step with an
+ * explicit embedded Runge-Kutta method. States are stored as
+ * structure-of-arrays, y[i * n + k] being component i of member k.
+ */
+
+typedef struct
+{
+  int (*function) (size_t n, const double t[], const double y[],
+                   double dydt[], void *params);
+  size_t dimension;
+  void *params;
+}
+gsl_odeiv2_ensemble_system;
+
+typedef struct
+{
+  const gsl_odeiv2_ensemble_system *sys;  /* ODE system */
+  const gsl_odeiv2_step_type *type;       /* stepper type */
+  size_t n;                     /* number of members */
+  double epsabs;                /* absolute error tolerance */
+  double epsrel;                /* relative error tolerance */
+  double hstart;                /* initial step size */
+  double hmin;                  /* minimum step size allowed */
+  double hmax;                  /* maximum step size allowed */
+  unsigned long int nmax;       /* maximum number of steps per member */
+  double *h;                    /* step size of each member */
+  unsigned long int *count;     /* accepted steps of each member */
+  unsigned long int *failed_steps;  /* rejected steps of each member */
+  int *status;                  /* status of each member */
+  void *state;
+}
+gsl_odeiv2_ensemble;
+
+gsl_odeiv2_ensemble *gsl_odeiv2_ensemble_alloc (const
+                                                gsl_odeiv2_ensemble_system *
+                                                sys,
+                                                const gsl_odeiv2_step_type *
+                                                T, const size_t n,
+                                                const double hstart,
+                                                const double epsabs,
+                                                const double epsrel);
+int gsl_odeiv2_ensemble_set_hmin (gsl_odeiv2_ensemble * e, const double hmin);
+int gsl_odeiv2_ensemble_set_hmax (gsl_odeiv2_ensemble * e, const double hmax);
+int gsl_odeiv2_ensemble_set_nmax (gsl_odeiv2_ensemble * e,
+                                  const unsigned long int nmax);
+int gsl_odeiv2_ensemble_apply (gsl_odeiv2_ensemble * e, double t[],
+                               const double t1, double y[]);
+int gsl_odeiv2_ensemble_reset (gsl_odeiv2_ensemble * e);
+void gsl_odeiv2_ensemble_free (gsl_odeiv2_ensemble * e);
+
 __END_DECLS
 #endif /* __GSL_ODEIV2_H__ */
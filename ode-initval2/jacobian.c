@@ -0,0 +1,743 @@
+/* ode-initval2/jacobian.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Jacobian storage and iteration matrix solver for the implicit
+   steppers. The Jacobian J of the system is stored in banded or
+   sparse form if a banded or sparse Jacobian function has been set
+   with gsl_odeiv2_step_set_jacobian_band or _sparse, and in dense
+   form for the jacobian function of the system otherwise. The
+   iteration matrix
+
+   M = I - h A (*) J
+
+   in which A is the stage x stage Runge-Kutta matrix and (*) is the
+   Kronecker product, is then factored with a dense LU decomposition,
+   a banded LU decomposition or, for sparse Jacobians, solved
+   iteratively with GMRES. If GMRES does not converge, the solve
+   returns GSL_EMAXITER, which the steppers pass on to the caller.
+
+   For banded Jacobians with more than one stage, the unknowns are
+   reordered so that the stages of each component are adjacent. The
+   iteration matrix then has lower and upper bandwidths
+   stage * (lower + 1) - 1 and stage * (upper + 1) - 1.
+
+   If only the sparsity pattern of the Jacobian has been set, with
+   gsl_odeiv2_step_set_jacobian_pattern, the Jacobian is approximated by forward differences. The columns
+   of the pattern are partitioned into structurally orthogonal groups
+   (gsl_spmatrix_color_columns), and all columns of a group are
+   perturbed together, so that one function evaluation per group is
+   needed. The approximation is stored in banded form if the pattern
+   is banded with small enough bandwidths, and in dense form
+   otherwise.
+
+   Storage is allocated at the first Jacobian evaluation after the
+   Jacobian has been set.
+*/
+
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_spmatrix.h>
+#include <gsl/gsl_splinalg.h>
+
+/* Jacobian storage types */
+#define ODEIV2_JAC_NONE   0
+#define ODEIV2_JAC_DENSE  1
+#define ODEIV2_JAC_BAND   2
+#define ODEIV2_JAC_SPARSE 3
+
+/* relative perturbation for finite difference Jacobians */
+#define ODEIV2_JAC_FD_EPS GSL_SQRT_DBL_EPSILON
+
+/* GMRES parameters for sparse iteration matrices */
+#define ODEIV2_JAC_GMRES_KRYLOV  30
+#define ODEIV2_JAC_GMRES_TOL     1.0e-10
+#define ODEIV2_JAC_GMRES_MAXITER 100
+
+typedef struct
+{
+  size_t dim;                   /* system dimension */
+  size_t stage;                 /* number of coupled stages */
+  int type;                     /* storage type of Jacobian */
+  size_t lower;                 /* lower bandwidth of Jacobian */
+  size_t upper;                 /* upper bandwidth of Jacobian */
+  size_t lb;                    /* lower bandwidth of iteration matrix */
+  size_t ub;                    /* upper bandwidth of iteration matrix */
+  gsl_matrix *dfdy;             /* dense or packed banded Jacobian */
+  gsl_spmatrix *dfdy_sp;        /* sparse Jacobian, triplet format */
+  gsl_matrix *M;                /* dense or packed banded LU of M */
+  gsl_permutation *p;           /* permutation of dense LU decomposition */
+  gsl_vector_uint *piv;         /* pivots of banded LU decomposition */
+  gsl_spmatrix *M_coo;          /* sparse M, triplet format */
+  gsl_spmatrix *M_csc;          /* sparse M, compressed column format */
+  gsl_splinalg_itersolve *isol; /* iterative solver for sparse M */
+  gsl_vector *work;             /* reordered right hand side */
+  int fdiff;                    /* Jacobian by finite differences */
+  const gsl_spmatrix *pattern;  /* sparsity pattern of Jacobian */
+  size_t ncolors;               /* number of column groups */
+  size_t *colors;               /* group of each column */
+  size_t *cptr;                 /* group pointers into cols */
+  size_t *cols;                 /* columns sorted by group */
+  size_t *colptr;               /* column pointers of pattern */
+  size_t *rowidx;               /* row indices of pattern */
+  double *fd_work;              /* finite difference workspace, 4 * dim */
+  odeiv2_jac_input in;          /* banded, sparse or pattern Jacobian */
+}
+odeiv2_jac_t;
+
+static void
+odeiv2_jac_clear (odeiv2_jac_t * jac)
+{
+  if (jac->dfdy)
+    gsl_matrix_free (jac->dfdy);
+
+  if (jac->dfdy_sp)
+    gsl_spmatrix_free (jac->dfdy_sp);
+
+  if (jac->M)
+    gsl_matrix_free (jac->M);
+
+  if (jac->p)
+    gsl_permutation_free (jac->p);
+
+  if (jac->piv)
+    gsl_vector_uint_free (jac->piv);
+
+  if (jac->M_coo)
+    gsl_spmatrix_free (jac->M_coo);
+
+  if (jac->M_csc)
+    gsl_spmatrix_free (jac->M_csc);
+
+  if (jac->isol)
+    gsl_splinalg_itersolve_free (jac->isol);
+
+  if (jac->work)
+    gsl_vector_free (jac->work);
+
+  free (jac->colors);
+  free (jac->cptr);
+  free (jac->cols);
+  free (jac->colptr);
+  free (jac->rowidx);
+  free (jac->fd_work);
+
+  jac->dfdy = NULL;
+  jac->dfdy_sp = NULL;
+  jac->M = NULL;
+  jac->p = NULL;
+  jac->piv = NULL;
+  jac->M_coo = NULL;
+  jac->M_csc = NULL;
+  jac->isol = NULL;
+  jac->work = NULL;
+  jac->colors = NULL;
+  jac->cptr = NULL;
+  jac->cols = NULL;
+  jac->colptr = NULL;
+  jac->rowidx = NULL;
+  jac->fd_work = NULL;
+  jac->fdiff = 0;
+  jac->pattern = NULL;
+  jac->ncolors = 0;
+  jac->type = ODEIV2_JAC_NONE;
+}
+
+static odeiv2_jac_t *
+odeiv2_jac_alloc (size_t dim, size_t stage)
+{
+  odeiv2_jac_t *jac = (odeiv2_jac_t *) calloc (1, sizeof (odeiv2_jac_t));
+
+  if (jac == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for jacobian", GSL_ENOMEM);
+    }
+
+  jac->dim = dim;
+  jac->stage = stage;
+  jac->type = ODEIV2_JAC_NONE;
+
+  return jac;
+}
+
+static void
+odeiv2_jac_free (odeiv2_jac_t * jac)
+{
+  odeiv2_jac_clear (jac);
+  free (jac);
+}
+
+static int
+odeiv2_jac_alloc_storage (odeiv2_jac_t * jac, const int type,
+                          const size_t lower, const size_t upper)
+{
+  /* Allocates Jacobian and iteration matrix storage of given type */
+
+  const size_t dim = jac->dim;
+  const size_t N = dim * jac->stage;
+
+  if (type == ODEIV2_JAC_DENSE)
+    {
+      jac->dfdy = gsl_matrix_alloc (dim, dim);
+      jac->M = gsl_matrix_alloc (N, N);
+      jac->p = gsl_permutation_alloc (N);
+
+      if (jac->dfdy == 0 || jac->M == 0 || jac->p == 0)
+        {
+          GSL_ERROR ("failed to allocate space for jacobian", GSL_ENOMEM);
+        }
+    }
+  else if (type == ODEIV2_JAC_BAND)
+    {
+      if (lower >= dim || upper >= dim)
+        {
+          GSL_ERROR ("jacobian bandwidths must be less than dimension",
+                     GSL_EDOM);
+        }
+
+      jac->lower = lower;
+      jac->upper = upper;
+      jac->lb = jac->stage * (lower + 1) - 1;
+      jac->ub = jac->stage * (upper + 1) - 1;
+
+      jac->dfdy = gsl_matrix_alloc (dim, lower + upper + 1);
+      jac->M = gsl_matrix_alloc (N, 2 * jac->lb + jac->ub + 1);
+      jac->piv = gsl_vector_uint_alloc (N);
+      jac->work = gsl_vector_alloc (N);
+
+      if (jac->dfdy == 0 || jac->M == 0 || jac->piv == 0 || jac->work == 0)
+        {
+          GSL_ERROR ("failed to allocate space for jacobian", GSL_ENOMEM);
+        }
+    }
+  else
+    {
+      jac->dfdy_sp = gsl_spmatrix_alloc (dim, dim);
+      jac->M_coo = gsl_spmatrix_alloc (N, N);
+      jac->M_csc = gsl_spmatrix_alloc_nzmax (N, N, N, GSL_SPMATRIX_CSC);
+      jac->isol = gsl_splinalg_itersolve_alloc (gsl_splinalg_itersolve_gmres,
+                                                N,
+                                                GSL_MIN (N,
+                                                         ODEIV2_JAC_GMRES_KRYLOV));
+
+      if (jac->dfdy_sp == 0 || jac->M_coo == 0 || jac->M_csc == 0 ||
+          jac->isol == 0)
+        {
+          GSL_ERROR ("failed to allocate space for jacobian", GSL_ENOMEM);
+        }
+    }
+
+  jac->type = type;
+
+  return GSL_SUCCESS;
+}
+
+static int
+odeiv2_jac_setup_fdiff (odeiv2_jac_t * jac, const gsl_spmatrix * pattern)
+{
+  /* Analyzes the sparsity pattern for finite difference Jacobians:
+     stores the pattern in compressed column form, groups the columns
+     and chooses banded or dense storage */
+
+  const size_t dim = jac->dim;
+  const size_t nz = pattern->nz;
+  size_t lower = 0, upper = 0;
+  size_t *Ti, *Tj;
+  size_t i, j, n, c;
+  int s;
+
+  if (pattern->size1 != dim || pattern->size2 != dim)
+    {
+      GSL_ERROR ("jacobian pattern must be dimension-by-dimension",
+                 GSL_EBADLEN);
+    }
+
+  jac->colors = (size_t *) malloc (dim * sizeof (size_t));
+  jac->cols = (size_t *) malloc (dim * sizeof (size_t));
+  jac->colptr = (size_t *) malloc ((dim + 1) * sizeof (size_t));
+  jac->rowidx = (size_t *) malloc ((nz + 1) * sizeof (size_t));
+  jac->fd_work = (double *) malloc (4 * dim * sizeof (double));
+
+  if (jac->colors == 0 || jac->cols == 0 || jac->colptr == 0 ||
+      jac->rowidx == 0 || jac->fd_work == 0)
+    {
+      GSL_ERROR ("failed to allocate space for jacobian", GSL_ENOMEM);
+    }
+
+  s = gsl_spmatrix_color_columns (pattern, jac->colors, &(jac->ncolors));
+
+  if (s != GSL_SUCCESS)
+    {
+      return s;
+    }
+
+  jac->cptr = (size_t *) malloc ((jac->ncolors + 1) * sizeof (size_t));
+  Ti = (size_t *) malloc ((2 * nz + 1) * sizeof (size_t));
+
+  if (jac->cptr == 0 || Ti == 0)
+    {
+      free (Ti);
+      GSL_ERROR ("failed to allocate space for jacobian", GSL_ENOMEM);
+    }
+
+  Tj = Ti + nz;
+
+  /* extract (row, column) pairs of the pattern */
+
+  if (GSL_SPMATRIX_ISCOO (pattern))
+    {
+      for (n = 0; n < nz; n++)
+        {
+          Ti[n] = (size_t) pattern->i[n];
+          Tj[n] = (size_t) pattern->p[n];
+        }
+    }
+  else if (GSL_SPMATRIX_ISCSC (pattern))
+    {
+      for (j = 0; j < dim; j++)
+        for (n = (size_t) pattern->p[j]; n < (size_t) pattern->p[j + 1]; n++)
+          {
+            Ti[n] = (size_t) pattern->i[n];
+            Tj[n] = j;
+          }
+    }
+  else
+    {
+      for (i = 0; i < dim; i++)
+        for (n = (size_t) pattern->p[i]; n < (size_t) pattern->p[i + 1]; n++)
+          {
+            Ti[n] = i;
+            Tj[n] = (size_t) pattern->i[n];
+          }
+    }
+
+  /* compressed column form of the pattern and its bandwidths */
+
+  for (j = 0; j <= dim; j++)
+    jac->colptr[j] = 0;
+
+  for (n = 0; n < nz; n++)
+    {
+      jac->colptr[Tj[n] + 1]++;
+
+      if (Ti[n] > Tj[n])
+        lower = GSL_MAX (lower, Ti[n] - Tj[n]);
+      else
+        upper = GSL_MAX (upper, Tj[n] - Ti[n]);
+    }
+
+  for (j = 0; j < dim; j++)
+    jac->colptr[j + 1] += jac->colptr[j];
+
+  for (n = 0; n < nz; n++)
+    jac->rowidx[jac->colptr[Tj[n]]++] = Ti[n];
+
+  for (j = dim; j > 0; j--)
+    jac->colptr[j] = jac->colptr[j - 1];
+
+  jac->colptr[0] = 0;
+
+  free (Ti);
+
+  /* columns sorted by group */
+
+  for (c = 0; c <= jac->ncolors; c++)
+    jac->cptr[c] = 0;
+
+  for (j = 0; j < dim; j++)
+    jac->cptr[jac->colors[j] + 1]++;
+
+  for (c = 0; c < jac->ncolors; c++)
+    jac->cptr[c + 1] += jac->cptr[c];
+
+  for (j = 0; j < dim; j++)
+    jac->cols[jac->cptr[jac->colors[j]]++] = j;
+
+  for (c = jac->ncolors; c > 0; c--)
+    jac->cptr[c] = jac->cptr[c - 1];
+
+  jac->cptr[0] = 0;
+
+  /* use banded storage if the banded LU needs less storage than the
+     dense one */
+
+  if (2 * lower + upper + 1 < dim)
+    return odeiv2_jac_alloc_storage (jac, ODEIV2_JAC_BAND, lower, upper);
+  else
+    return odeiv2_jac_alloc_storage (jac, ODEIV2_JAC_DENSE, 0, 0);
+}
+
+static int
+odeiv2_jac_setup (odeiv2_jac_t * jac, const gsl_odeiv2_system * sys)
+{
+  /* Allocates storage according to the Jacobian set for the
+     stepper, or the jacobian function of sys if none is set, if not
+     already done for the same type and bandwidths */
+
+  const odeiv2_jac_input *in = &jac->in;
+  int type, s;
+
+  if (in->sparse != NULL)
+    type = ODEIV2_JAC_SPARSE;
+  else if (in->band != NULL)
+    type = ODEIV2_JAC_BAND;
+  else if (in->pattern != NULL)
+    {
+      /* finite differences, pattern is analyzed only once */
+
+      if (jac->fdiff && jac->pattern == in->pattern)
+        {
+          return GSL_SUCCESS;
+        }
+
+      odeiv2_jac_clear (jac);
+
+      s = odeiv2_jac_setup_fdiff (jac, in->pattern);
+
+      if (s != GSL_SUCCESS)
+        {
+          odeiv2_jac_clear (jac);
+          return s;
+        }
+
+      jac->fdiff = 1;
+      jac->pattern = in->pattern;
+
+      return GSL_SUCCESS;
+    }
+  else if (sys->jacobian != NULL)
+    type = ODEIV2_JAC_DENSE;
+  else
+    {
+      GSL_ERROR ("system does not provide a jacobian function", GSL_EFAULT);
+    }
+
+  if (!jac->fdiff && type == jac->type &&
+      (type != ODEIV2_JAC_BAND ||
+       (in->lower == jac->lower && in->upper == jac->upper)))
+    {
+      return GSL_SUCCESS;
+    }
+
+  odeiv2_jac_clear (jac);
+
+  s = odeiv2_jac_alloc_storage (jac, type, in->lower, in->upper);
+
+  if (s != GSL_SUCCESS)
+    {
+      odeiv2_jac_clear (jac);
+      return s;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+odeiv2_jac_fdiff (odeiv2_jac_t * jac, const gsl_odeiv2_system * sys,
+                  const double t, const double y[], double dfdt[])
+{
+  /* Approximates the Jacobian by forward differences, one function
+     evaluation per group of structurally orthogonal columns */
+
+  const size_t dim = jac->dim;
+  double *const f0 = jac->fd_work;
+  double *const f1 = f0 + dim;
+  double *const ytmp = f1 + dim;
+  double *const dy = ytmp + dim;
+  size_t i, c, n, r;
+  double dt;
+  int s;
+
+  s = GSL_ODEIV_FN_EVAL (sys, t, y, f0);
+
+  if (s != GSL_SUCCESS)
+    {
+      return s;
+    }
+
+  gsl_matrix_set_zero (jac->dfdy);
+  DBL_MEMCPY (ytmp, y, dim);
+
+  for (c = 0; c < jac->ncolors; c++)
+    {
+      for (n = jac->cptr[c]; n < jac->cptr[c + 1]; n++)
+        {
+          const size_t j = jac->cols[n];
+          double h = ODEIV2_JAC_FD_EPS * fabs (y[j]);
+
+          if (h == 0.0)
+            h = ODEIV2_JAC_FD_EPS;
+
+          ytmp[j] = y[j] + h;
+          dy[j] = ytmp[j] - y[j];
+        }
+
+      s = GSL_ODEIV_FN_EVAL (sys, t, ytmp, f1);
+
+      if (s != GSL_SUCCESS)
+        {
+          return s;
+        }
+
+      for (n = jac->cptr[c]; n < jac->cptr[c + 1]; n++)
+        {
+          const size_t j = jac->cols[n];
+
+          ytmp[j] = y[j];
+
+          for (r = jac->colptr[j]; r < jac->colptr[j + 1]; r++)
+            {
+              const size_t k = jac->rowidx[r];
+              const double Jkj = (f1[k] - f0[k]) / dy[j];
+
+              if (jac->type == ODEIV2_JAC_BAND)
+                gsl_matrix_set (jac->dfdy, j, jac->upper + k - j, Jkj);
+              else
+                gsl_matrix_set (jac->dfdy, k, j, Jkj);
+            }
+        }
+    }
+
+  /* time derivative */
+
+  dt = ODEIV2_JAC_FD_EPS * fabs (t);
+
+  if (dt == 0.0)
+    dt = ODEIV2_JAC_FD_EPS;
+
+  dt = (t + dt) - t;
+
+  s = GSL_ODEIV_FN_EVAL (sys, t + dt, y, f1);
+
+  if (s != GSL_SUCCESS)
+    {
+      return s;
+    }
+
+  for (i = 0; i < dim; i++)
+    dfdt[i] = (f1[i] - f0[i]) / dt;
+
+  return GSL_SUCCESS;
+}
+
+static int
+odeiv2_jac_eval (odeiv2_jac_t * jac, const gsl_odeiv2_system * sys,
+                 const double t, const double y[], double dfdt[])
+{
+  /* Evaluates the Jacobian of sys at (t, y) */
+
+  int s = odeiv2_jac_setup (jac, sys);
+
+  if (s != GSL_SUCCESS)
+    {
+      return s;
+    }
+
+  if (jac->fdiff)
+    {
+      return odeiv2_jac_fdiff (jac, sys, t, y, dfdt);
+    }
+
+  switch (jac->type)
+    {
+    case ODEIV2_JAC_BAND:
+      gsl_matrix_set_zero (jac->dfdy);
+      return (*(jac->in.band)) (t, y, jac->dfdy, dfdt, sys->params);
+
+    case ODEIV2_JAC_SPARSE:
+      gsl_spmatrix_set_zero (jac->dfdy_sp);
+      return (*(jac->in.sparse)) (t, y, jac->dfdy_sp, dfdt, sys->params);
+
+    default:
+      return GSL_ODEIV_JA_EVAL (sys, t, y, jac->dfdy->data, dfdt);
+    }
+}
+
+static int
+odeiv2_jac_decomp (odeiv2_jac_t * jac, const gsl_matrix * A, const double h)
+{
+  /* Forms the iteration matrix M = I - h A (*) J from the last
+     evaluated Jacobian and factors it. If A is NULL, a single stage
+     with coefficient 1 is assumed.
+   */
+
+  const size_t dim = jac->dim;
+  const size_t stage = jac->stage;
+  size_t i, j, k, m;
+
+  if (jac->type == ODEIV2_JAC_DENSE)
+    {
+      gsl_matrix *const M = jac->M;
+      int signum;
+
+      for (i = 0; i < dim; i++)
+        for (j = 0; j < dim; j++)
+          for (k = 0; k < stage; k++)
+            for (m = 0; m < stage; m++)
+              {
+                const double a = (A != NULL) ? gsl_matrix_get (A, k, m) : 1.0;
+                const size_t x = dim * k + i;
+                const size_t y = dim * m + j;
+
+                if (x != y)
+                  gsl_matrix_set (M, x, y,
+                                  -h * a * gsl_matrix_get (jac->dfdy, i, j));
+                else
+                  gsl_matrix_set (M, x, y,
+                                  1.0 - h * a * gsl_matrix_get (jac->dfdy, i,
+                                                                j));
+              }
+
+      return gsl_linalg_LU_decomp (M, jac->p, &signum);
+    }
+  else if (jac->type == ODEIV2_JAC_BAND)
+    {
+      /* J(i,j) is stored in dfdy(j, upper + i - j); M(r,c) is stored in
+         M(c, lb + ub + r - c) with r = stage * i + k, c = stage * j + m */
+
+      gsl_matrix *const M = jac->M;
+      const size_t N = dim * stage;
+      const size_t offset = jac->lb + jac->ub;
+
+      gsl_matrix_set_zero (M);
+
+      for (j = 0; j < dim; j++)
+        {
+          const size_t i0 = (j > jac->upper) ? j - jac->upper : 0;
+          const size_t i1 = GSL_MIN (dim - 1, j + jac->lower);
+
+          for (i = i0; i <= i1; i++)
+            {
+              const double Jij =
+                gsl_matrix_get (jac->dfdy, j, jac->upper + i - j);
+
+              for (k = 0; k < stage; k++)
+                for (m = 0; m < stage; m++)
+                  {
+                    const double a =
+                      (A != NULL) ? gsl_matrix_get (A, k, m) : 1.0;
+                    const size_t r = stage * i + k;
+                    const size_t c = stage * j + m;
+
+                    if (r != c)
+                      gsl_matrix_set (M, c, offset + r - c, -h * a * Jij);
+                    else
+                      gsl_matrix_set (M, c, offset, 1.0 - h * a * Jij);
+                  }
+            }
+        }
+
+      return gsl_linalg_LU_band_decomp (N, jac->lb, jac->ub, M, jac->piv);
+    }
+  else if (jac->type == ODEIV2_JAC_SPARSE)
+    {
+      const gsl_spmatrix *J = jac->dfdy_sp;
+      gsl_spmatrix *const M = jac->M_coo;
+      const size_t N = dim * stage;
+      size_t n;
+
+      gsl_spmatrix_set_zero (M);
+
+      for (i = 0; i < N; i++)
+        gsl_spmatrix_set (M, i, i, 1.0);
+
+      for (n = 0; n < J->nz; n++)
+        {
+          const size_t Ji = (size_t) J->i[n];
+          const size_t Jj = (size_t) J->p[n];
+          const double Jij = J->data[n];
+
+          for (k = 0; k < stage; k++)
+            for (m = 0; m < stage; m++)
+              {
+                const double a = (A != NULL) ? gsl_matrix_get (A, k, m) : 1.0;
+                const size_t x = dim * k + Ji;
+                const size_t y = dim * m + Jj;
+
+                if (x != y)
+                  gsl_spmatrix_set (M, x, y, -h * a * Jij);
+                else
+                  gsl_spmatrix_set (M, x, y, 1.0 - h * a * Jij);
+              }
+        }
+
+      return gsl_spmatrix_csc (jac->M_csc, M);
+    }
+
+  GSL_ERROR ("jacobian has not been evaluated", GSL_EFAULT);
+}
+
+static int
+odeiv2_jac_solve (odeiv2_jac_t * jac, const gsl_vector * b, gsl_vector * x)
+{
+  /* Solves M x = b using the factorization from odeiv2_jac_decomp */
+
+  if (jac->type == ODEIV2_JAC_DENSE)
+    {
+      return gsl_linalg_LU_solve (jac->M, jac->p, b, x);
+    }
+  else if (jac->type == ODEIV2_JAC_BAND)
+    {
+      const size_t dim = jac->dim;
+      const size_t stage = jac->stage;
+      gsl_vector *const w = jac->work;
+      size_t i, k;
+      int s;
+
+      if (stage == 1)
+        {
+          return gsl_linalg_LU_band_solve (jac->lb, jac->ub, jac->M, jac->piv,
+                                           b, x);
+        }
+
+      for (k = 0; k < stage; k++)
+        for (i = 0; i < dim; i++)
+          gsl_vector_set (w, stage * i + k, gsl_vector_get (b, dim * k + i));
+
+      s = gsl_linalg_LU_band_svx (jac->lb, jac->ub, jac->M, jac->piv, w);
+
+      if (s != GSL_SUCCESS)
+        {
+          return s;
+        }
+
+      for (k = 0; k < stage; k++)
+        for (i = 0; i < dim; i++)
+          gsl_vector_set (x, dim * k + i, gsl_vector_get (w, stage * i + k));
+
+      return GSL_SUCCESS;
+    }
+  else if (jac->type == ODEIV2_JAC_SPARSE)
+    {
+      size_t iter = 0;
+      int s;
+
+      gsl_vector_set_zero (x);
+
+      do
+        {
+          s = gsl_splinalg_itersolve_iterate (jac->M_csc, b,
+                                              ODEIV2_JAC_GMRES_TOL, x,
+                                              jac->isol);
+        }
+      while (s == GSL_CONTINUE && ++iter < ODEIV2_JAC_GMRES_MAXITER);
+
+      return (s == GSL_SUCCESS) ? GSL_SUCCESS : GSL_EMAXITER;
+    }
+
+  GSL_ERROR ("iteration matrix has not been factored", GSL_EFAULT);
+}
@@ -42,15 +42,10 @@
 #include <gsl/gsl_blas.h>
 
 #include "odeiv_util.h"
+#include "jacobian.c"
 
 typedef struct
 {
-  /* iteration matrix I - h A (*) J */
-  gsl_matrix *IhAJ;
-
-  /* permutation for LU-decomposition */
-  gsl_permutation *p;
-
   /* difference vector for kth Newton iteration */
   gsl_vector *dYk;
 
@@ -83,29 +78,10 @@ modnewton1_alloc (size_t dim, size_t stage)
                       GSL_ENOMEM);
     }
 
-  state->IhAJ = gsl_matrix_alloc (dim * stage, dim * stage);
-
-  if (state->IhAJ == 0)
-    {
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for IhAJ", GSL_ENOMEM);
-    }
-
-  state->p = gsl_permutation_alloc (dim * stage);
-
-  if (state->p == 0)
-    {
-      gsl_matrix_free (state->IhAJ);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for p", GSL_ENOMEM);
-    }
-
   state->dYk = gsl_vector_alloc (dim * stage);
 
   if (state->dYk == 0)
     {
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->IhAJ);
       free (state);
       GSL_ERROR_NULL ("failed to allocate space for dYk", GSL_ENOMEM);
     }
@@ -115,8 +91,6 @@ modnewton1_alloc (size_t dim, size_t stage)
   if (state->dScal == 0)
     {
       gsl_vector_free (state->dYk);
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->IhAJ);
       free (state);
       GSL_ERROR_NULL ("failed to allocate space for dScal", GSL_ENOMEM);
     }
@@ -127,8 +101,6 @@ modnewton1_alloc (size_t dim, size_t stage)
     {
       gsl_vector_free (state->dScal);
       gsl_vector_free (state->dYk);
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->IhAJ);
       free (state);
       GSL_ERROR_NULL ("failed to allocate space for Yk", GSL_ENOMEM);
     }
@@ -140,8 +112,6 @@ modnewton1_alloc (size_t dim, size_t stage)
       free (state->Yk);
       gsl_vector_free (state->dScal);
       gsl_vector_free (state->dYk);
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->IhAJ);
       free (state);
       GSL_ERROR_NULL ("failed to allocate space for Yk", GSL_ENOMEM);
     }
@@ -154,8 +124,6 @@ modnewton1_alloc (size_t dim, size_t stage)
       free (state->Yk);
       gsl_vector_free (state->dScal);
       gsl_vector_free (state->dYk);
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->IhAJ);
       free (state);
       GSL_ERROR_NULL ("failed to allocate space for rhs", GSL_ENOMEM);
     }
@@ -167,7 +135,7 @@ modnewton1_alloc (size_t dim, size_t stage)
 
 static int
 modnewton1_init (void *vstate, const gsl_matrix * A,
-                 const double h, const gsl_matrix * dfdy,
+                 const double h, odeiv2_jac_t * jac,
                  const gsl_odeiv2_system * sys)
 {
   /* Initializes the method by forming the iteration matrix IhAJ
@@ -176,43 +144,12 @@ modnewton1_init (void *vstate, const gsl_matrix * A,
 
   modnewton1_state_t *state = (modnewton1_state_t *) vstate;
 
-  gsl_matrix *const IhAJ = state->IhAJ;
-  gsl_permutation *const p = state->p;
-
-  const size_t dim = sys->dimension;
-  const size_t stage = A->size1;
-
   state->eeta_prev = GSL_DBL_MAX;
 
-  /* Generate IhAJ */
-
-  {
-    size_t i, j, k, m;
-
-    for (i = 0; i < dim; i++)
-      for (j = 0; j < dim; j++)
-        for (k = 0; k < stage; k++)
-          for (m = 0; m < stage; m++)
-            {
-              size_t x = dim * k + i;
-              size_t y = dim * m + j;
-
-              if (x != y)
-                gsl_matrix_set (IhAJ, x, y,
-                                -h * gsl_matrix_get (A, k, m) *
-                                gsl_matrix_get (dfdy, i, j));
-              else
-                gsl_matrix_set (IhAJ, x, y,
-                                1.0 - h * gsl_matrix_get (A, k, m) *
-                                gsl_matrix_get (dfdy, i, j));
-            }
-  }
-
-  /* decompose */
+  /* Generate IhAJ and decompose */
 
   {
-    int signum;
-    int s = gsl_linalg_LU_decomp (IhAJ, p, &signum);
+    int s = odeiv2_jac_decomp (jac, A, h);
 
     if (s != GSL_SUCCESS)
       return s;
@@ -224,7 +161,8 @@ modnewton1_init (void *vstate, const gsl_matrix * A,
 static int
 modnewton1_solve (void *vstate, const gsl_matrix * A,
                   const double c[], const double t, const double h,
-                  const double y0[], const gsl_odeiv2_system * sys,
+                  const double y0[], odeiv2_jac_t * jac,
+                  const gsl_odeiv2_system * sys,
                   double YZ[], const double errlev[])
 {
   /* Solves the non-linear equation system resulting from implicit
@@ -240,14 +178,13 @@ modnewton1_solve (void *vstate, const gsl_matrix * A,
      difference vector for kth Newton iteration: dYk = Y(k+1) - Y(k),
      and rhs = Y(k) - y0 - h * sum j=1..stage (a_j * f(Y(k)))
 
-     This function solves dYk by LU-decomposition of IhAJ with partial
-     pivoting.
+     This function solves dYk with the decomposition of IhAJ in jac:
+     dense or banded LU-decomposition with partial pivoting, or GMRES
+     for sparse Jacobians.
    */
 
   modnewton1_state_t *state = (modnewton1_state_t *) vstate;
 
-  gsl_matrix *const IhAJ = state->IhAJ;
-  gsl_permutation *const p = state->p;
   gsl_vector *const dYk = state->dYk;
   double *const Yk = state->Yk;
   double *const fYk = state->fYk;
@@ -327,7 +264,7 @@ modnewton1_solve (void *vstate, const gsl_matrix * A,
         /* Solve dYk */
 
         {
-          int s = gsl_linalg_LU_solve (IhAJ, p, rhs, dYk);
+          int s = odeiv2_jac_solve (jac, rhs, dYk);
 
           if (s != GSL_SUCCESS)
             {
@@ -420,7 +357,5 @@ modnewton1_free (void *vstate)
   free (state->Yk);
   gsl_vector_free (state->dScal);
   gsl_vector_free (state->dYk);
-  gsl_permutation_free (state->p);
-  gsl_matrix_free (state->IhAJ);
   free (state);
 }
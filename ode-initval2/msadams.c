@@ -1312,6 +1312,57 @@ msadams_free (void *vstate)
   free (state);
 }
 
+static int
+msadams_interp (void *vstate, size_t dim, double t, double y[],
+                const gsl_odeiv2_system * sys)
+{
+  /* Evaluates the Nordsieck history of the last step at t. With
+     tn = tprev + h the end of the step and theta = (t - tn) / h,
+     y(t) = sum_{j=0..ord} z_j theta^j, where ord is the order used
+     on the step.
+   */
+
+  msadams_state_t *state = (msadams_state_t *) vstate;
+  const double *z = state->z;
+  const double h = state->hprev[0];
+  const double t0 = state->tprev;
+  const double t1 = t0 + h;
+  const size_t ord = state->ordprev;
+  double theta;
+  size_t i, j;
+
+  if (state->ni == 0)
+    {
+      GSL_ERROR ("no step available for interpolation", GSL_EINVAL);
+    }
+
+  /* Allow for rounding of t0 + h at the end of the step */
+
+  {
+    const double tol =
+      4.0 * GSL_DBL_EPSILON * GSL_MAX_DBL (fabs (t0), fabs (t1));
+
+    if (t < GSL_MIN_DBL (t0, t1) - tol || t > GSL_MAX_DBL (t0, t1) + tol)
+      {
+        GSL_ERROR ("t is outside of the last step", GSL_EDOM);
+      }
+  }
+
+  theta = (t - t1) / h;
+
+  for (i = 0; i < dim; i++)
+    {
+      double yi = z[ord * dim + i];
+
+      for (j = ord; j-- > 0;)
+        yi = yi * theta + z[j * dim + i];
+
+      y[i] = yi;
+    }
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_odeiv2_step_type msadams_type = {
   "msadams",                    /* name */
   1,                            /* can use dydt_in? */
@@ -1321,7 +1372,11 @@ static const gsl_odeiv2_step_type msadams_type = {
   &msadams_set_driver,
   &msadams_reset,
   &msadams_order,
-  &msadams_free
+  &msadams_free,
+  &msadams_interp,
+  NULL,                         /* no caller-provided workspace */
+  NULL,
+  NULL                          /* no jacobian */
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_msadams = &msadams_type;
@@ -53,6 +53,7 @@
 #include <gsl/gsl_linalg.h>
 
 #include "odeiv_util.h"
+#include "jacobian.c"
 
 /* Maximum order of BDF methods */
 #define MSBDF_MAX_ORD 5
@@ -87,10 +88,8 @@ typedef struct
   gsl_vector *svec;             /* saved abscor & work area */
   gsl_vector *tempvec;          /* work area */
   const gsl_odeiv2_driver *driver;      /* pointer to gsl_odeiv2_driver object */
-  gsl_matrix *dfdy;             /* Jacobian */
+  odeiv2_jac_t *jac;            /* Jacobian and Newton iteration matrix */
   double *dfdt;                 /* storage for time derivative of f */
-  gsl_matrix *M;                /* Newton iteration matrix */
-  gsl_permutation *p;           /* permutation for LU decomposition of M */
   gsl_vector *rhs;              /* right hand side equations (-G) */
   long int ni;                  /* stepper call counter */
   size_t ord;                   /* current order of method */
@@ -326,9 +325,9 @@ msbdf_alloc (size_t dim)
       GSL_ERROR_NULL ("failed to allocate space for tempvec", GSL_ENOMEM);
     }
 
-  state->dfdy = gsl_matrix_alloc (dim, dim);
+  state->jac = odeiv2_jac_alloc (dim, 1);
 
-  if (state->dfdy == 0)
+  if (state->jac == 0)
     {
       gsl_vector_free (state->tempvec);
       gsl_vector_free (state->svec);
@@ -345,14 +344,14 @@ msbdf_alloc (size_t dim)
       free (state->zbackup);
       free (state->z);
       free (state);
-      GSL_ERROR_NULL ("failed to allocate space for dfdy", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for jac", GSL_ENOMEM);
     }
 
   state->dfdt = (double *) malloc (dim * sizeof (double));
 
   if (state->dfdt == 0)
     {
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       gsl_vector_free (state->tempvec);
       gsl_vector_free (state->svec);
       gsl_vector_free (state->relcor);
@@ -371,63 +370,12 @@ msbdf_alloc (size_t dim)
       GSL_ERROR_NULL ("failed to allocate space for dfdt", GSL_ENOMEM);
     }
 
-  state->M = gsl_matrix_alloc (dim, dim);
-
-  if (state->M == 0)
-    {
-      free (state->dfdt);
-      gsl_matrix_free (state->dfdy);
-      gsl_vector_free (state->tempvec);
-      gsl_vector_free (state->svec);
-      gsl_vector_free (state->relcor);
-      gsl_vector_free (state->abscor);
-      free (state->errlev);
-      free (state->ordprevbackup);
-      free (state->ordprev);
-      free (state->hprevbackup);
-      free (state->hprev);
-      free (state->l);
-      free (state->ytmp2);
-      free (state->ytmp);
-      free (state->zbackup);
-      free (state->z);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for M", GSL_ENOMEM);
-    }
-
-  state->p = gsl_permutation_alloc (dim);
-
-  if (state->p == 0)
-    {
-      gsl_matrix_free (state->M);
-      free (state->dfdt);
-      gsl_matrix_free (state->dfdy);
-      gsl_vector_free (state->tempvec);
-      gsl_vector_free (state->svec);
-      gsl_vector_free (state->relcor);
-      gsl_vector_free (state->abscor);
-      free (state->errlev);
-      free (state->ordprevbackup);
-      free (state->ordprev);
-      free (state->hprevbackup);
-      free (state->hprev);
-      free (state->l);
-      free (state->ytmp2);
-      free (state->ytmp);
-      free (state->zbackup);
-      free (state->z);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for p", GSL_ENOMEM);
-    }
-
   state->rhs = gsl_vector_alloc (dim);
 
   if (state->rhs == 0)
     {
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->M);
       free (state->dfdt);
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       gsl_vector_free (state->tempvec);
       gsl_vector_free (state->svec);
       gsl_vector_free (state->relcor);
@@ -451,10 +399,8 @@ msbdf_alloc (size_t dim)
   if (state->abscorscaled == 0)
     {
       gsl_vector_free (state->rhs); 
-      gsl_permutation_free (state->p);
-      gsl_matrix_free (state->M);
       free (state->dfdt);
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       gsl_vector_free (state->tempvec);
       gsl_vector_free (state->svec);
       gsl_vector_free (state->relcor);
@@ -642,10 +588,9 @@ msbdf_calccoeffs (const size_t ord, const size_t ordwait,
 }
 
 static int
-msbdf_update (void *vstate, const size_t dim, gsl_matrix * dfdy, double *dfdt,
-              const double t, const double *y, const gsl_odeiv2_system * sys,
-              gsl_matrix * M, gsl_permutation * p,
-              const size_t iter, size_t * nJ, size_t * nM,
+msbdf_update (void *vstate, const size_t dim, odeiv2_jac_t * jac,
+              double *dfdt, const double t, const double *y,
+              const gsl_odeiv2_system * sys, const size_t iter, size_t * nJ, size_t * nM,
               const double tprev, const double failt,
               const double gamma, const double gammaprev, const double hratio)
 {
@@ -670,7 +615,7 @@ msbdf_update (void *vstate, const size_t dim, gsl_matrix * dfdy, double *dfdt,
 #ifdef DEBUG
       printf ("-- evaluate jacobian\n");
 #endif
-      int s = GSL_ODEIV_JA_EVAL (sys, t, y, dfdy->data, dfdt);
+      int s = odeiv2_jac_eval (jac, sys, t, y, dfdt);
 
       if (s == GSL_EBADFUNC)
         {
@@ -704,18 +649,8 @@ msbdf_update (void *vstate, const size_t dim, gsl_matrix * dfdy, double *dfdt,
 #ifdef DEBUG
       printf ("-- update M, gamma=%.5e\n", gamma);
 #endif
-      size_t i;
-      gsl_matrix_memcpy (M, dfdy);
-      gsl_matrix_scale (M, -gamma);
-
-      for (i = 0; i < dim; i++)
-        {
-          gsl_matrix_set (M, i, i, gsl_matrix_get (M, i, i) + 1.0);
-        }
-
       {
-        int signum;
-        int s = gsl_linalg_LU_decomp (M, p, &signum);
+        int s = odeiv2_jac_decomp (jac, NULL, gamma);
         
         if (s != GSL_SUCCESS)
           {
@@ -738,8 +673,7 @@ msbdf_corrector (void *vstate, const gsl_odeiv2_system * sys,
                  const double l[], const double errcoeff,
                  gsl_vector * abscor, gsl_vector * relcor,
                  double ytmp[], double ytmp2[],
-                 gsl_matrix * dfdy, double dfdt[], gsl_matrix * M,
-                 gsl_permutation * p, gsl_vector * rhs,
+                 odeiv2_jac_t * jac, double dfdt[], gsl_vector * rhs,
                  size_t * nJ, size_t * nM,
                  const double tprev, const double failt,
                  const double gamma, const double gammaprev,
@@ -789,8 +723,8 @@ msbdf_corrector (void *vstate, const gsl_odeiv2_system * sys,
 
       if (mi == 0)
         {
-          int s = msbdf_update (vstate, dim, dfdy, dfdt, t + h, z,
-                                sys, M, p, mi,
+          int s = msbdf_update (vstate, dim, jac, dfdt, t + h, z,
+                                sys, mi,
                                 nJ, nM, tprev, failt,
                                 gamma, gammaprev,
                                 h / hprev0);
@@ -814,7 +748,7 @@ msbdf_corrector (void *vstate, const gsl_odeiv2_system * sys,
       /* Solve system of equations */
 
       {
-        int s = gsl_linalg_LU_solve (M, p, rhs, relcor);
+        int s = odeiv2_jac_solve (jac, rhs, relcor);
         
         if (s != GSL_SUCCESS)
           {
@@ -823,7 +757,7 @@ msbdf_corrector (void *vstate, const gsl_odeiv2_system * sys,
 #ifdef DEBUG
             printf ("-- FAIL at LU_solve\n");
 #endif
-            return GSL_FAILURE;
+            return s;
           }
       }
 
@@ -1526,8 +1460,7 @@ msbdf_apply (void *vstate, size_t dim, double t, double h,
     int s;
     s = msbdf_corrector (vstate, sys, t, h, dim, z, errlev, l, errcoeff,
                          abscor, relcor, ytmp, ytmp2,
-                         state->dfdy, state->dfdt, state->M,
-                         state->p, state->rhs,
+                         state->jac, state->dfdt, state->rhs,
                          &(state->nJ), &(state->nM),
                          state->tprev, state->failt, gamma,
                          state->gammaprev, hprev[0]);
@@ -1771,10 +1704,8 @@ msbdf_free (void *vstate)
   msbdf_state_t *state = (msbdf_state_t *) vstate;
 
   gsl_vector_free (state->rhs);
-  gsl_permutation_free (state->p);
-  gsl_matrix_free (state->M);
   free (state->dfdt);
-  gsl_matrix_free (state->dfdy);
+  odeiv2_jac_free (state->jac);
   gsl_vector_free (state->tempvec);
   gsl_vector_free (state->svec);
   gsl_vector_free (state->relcor);
@@ -1793,6 +1724,65 @@ msbdf_free (void *vstate)
   free (state);
 }
 
+static int
+msbdf_interp (void *vstate, size_t dim, double t, double y[],
+              const gsl_odeiv2_system * sys)
+{
+  /* Evaluates the Nordsieck history of the last step at t. With
+     tn = tprev + h the end of the step and theta = (t - tn) / h,
+     y(t) = sum_{j=0..ord} z_j theta^j, where ord is the order used
+     on the step.
+   */
+
+  msbdf_state_t *state = (msbdf_state_t *) vstate;
+  const double *z = state->z;
+  const double h = state->hprev[0];
+  const double t0 = state->tprev;
+  const double t1 = t0 + h;
+  const size_t ord = state->ordprev[0];
+  double theta;
+  size_t i, j;
+
+  if (state->ni == 0)
+    {
+      GSL_ERROR ("no step available for interpolation", GSL_EINVAL);
+    }
+
+  /* Allow for rounding of t0 + h at the end of the step */
+
+  {
+    const double tol =
+      4.0 * GSL_DBL_EPSILON * GSL_MAX_DBL (fabs (t0), fabs (t1));
+
+    if (t < GSL_MIN_DBL (t0, t1) - tol || t > GSL_MAX_DBL (t0, t1) + tol)
+      {
+        GSL_ERROR ("t is outside of the last step", GSL_EDOM);
+      }
+  }
+
+  theta = (t - t1) / h;
+
+  for (i = 0; i < dim; i++)
+    {
+      double yi = z[ord * dim + i];
+
+      for (j = ord; j-- > 0;)
+        yi = yi * theta + z[j * dim + i];
+
+      y[i] = yi;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void *
+msbdf_jacobian (void *vstate)
+{
+  msbdf_state_t *state = (msbdf_state_t *) vstate;
+
+  return &state->jac->in;
+}
+
 static const gsl_odeiv2_step_type msbdf_type = {
   "msbdf",                      /* name */
   1,                            /* can use dydt_in? */
@@ -1802,7 +1792,11 @@ static const gsl_odeiv2_step_type msbdf_type = {
   &msbdf_set_driver,
   &msbdf_reset,
   &msbdf_order,
-  &msbdf_free
+  &msbdf_free,
+  &msbdf_interp,
+  NULL,                         /* no caller-provided workspace */
+  NULL,
+  &msbdf_jacobian
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_msbdf = &msbdf_type;
@@ -1,3 +1,6 @@
+#ifndef __ODEIV_UTIL_H__
+#define __ODEIV_UTIL_H__
+
 #define DBL_MEMCPY(dest,src,n) memcpy((dest),(src),(n)*sizeof(double))
 #define DBL_ZERO_MEMSET(dest,n) memset((dest),0,(n)*sizeof(double))
 
@@ -15,3 +18,30 @@
  */
 
 #define ODEIV_ERR_SAFETY 8.0
+
+/* Rounds a size in bytes up to a multiple of 16, so that the parts of
+ * a workspace laid out in one block stay aligned for the pointers,
+ * sizes and doubles stored in them.
+ */
+
+#define ODEIV_ALIGN(n) (((n) + 15) & ~((size_t) 15))
+
+/* Jacobian of a large system, as given to the implicit steppers by
+ * the gsl_odeiv2_step_set_jacobian functions. Members which are not
+ * set are zero. The steppers return a pointer to their copy from the
+ * jacobian method of their type.
+ */
+
+typedef struct
+{
+  int (*band) (double t, const double y[], gsl_matrix * dfdy,
+               double dfdt[], void *params);
+  size_t lower;                 /* lower bandwidth of banded jacobian */
+  size_t upper;                 /* upper bandwidth of banded jacobian */
+  int (*sparse) (double t, const double y[], gsl_spmatrix * dfdy,
+                 double dfdt[], void *params);
+  const gsl_spmatrix *pattern;  /* sparsity pattern of jacobian */
+}
+odeiv2_jac_input;
+
+#endif /* __ODEIV_UTIL_H__ */
@@ -43,55 +43,40 @@ typedef struct
 }
 rk2_state_t;
 
-static void *
-rk2_alloc (size_t dim)
+static size_t
+rk2_size (size_t dim)
 {
-  rk2_state_t *state = (rk2_state_t *) malloc (sizeof (rk2_state_t));
-
-  if (state == 0)
-    {
-      GSL_ERROR_NULL ("failed to allocate space for rk2_state", GSL_ENOMEM);
-    }
+  return ODEIV_ALIGN (sizeof (rk2_state_t)) + 4 * dim * sizeof (double);
+}
 
-  state->k1 = (double *) malloc (dim * sizeof (double));
+static void *
+rk2_init (void *mem, size_t dim)
+{
+  /* Lays out the state in the block mem of rk2_size (dim) bytes */
 
-  if (state->k1 == 0)
-    {
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k1", GSL_ENOMEM);
-    }
+  rk2_state_t *state = (rk2_state_t *) mem;
+  double *w =
+    (double *) ((char *) mem + ODEIV_ALIGN (sizeof (rk2_state_t)));
 
-  state->k2 = (double *) malloc (dim * sizeof (double));
+  state->k1 = w;
+  state->k2 = w + dim;
+  state->k3 = w + 2 * dim;
+  state->ytmp = w + 3 * dim;
 
-  if (state->k2 == 0)
-    {
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k2", GSL_ENOMEM);
-    }
-
-  state->k3 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k3 == 0)
-    {
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k3", GSL_ENOMEM);
-    }
+  return state;
+}
 
-  state->ytmp = (double *) malloc (dim * sizeof (double));
+static void *
+rk2_alloc (size_t dim)
+{
+  void *mem = malloc (rk2_size (dim));
 
-  if (state->ytmp == 0)
+  if (mem == 0)
     {
-      free (state->k3);
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for ytmp", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for rk2_state", GSL_ENOMEM);
     }
 
-  return state;
+  return rk2_init (mem, dim);
 }
 
 
@@ -229,12 +214,7 @@ rk2_order (void *vstate)
 static void
 rk2_free (void *vstate)
 {
-  rk2_state_t *state = (rk2_state_t *) vstate;
-  free (state->k1);
-  free (state->k2);
-  free (state->k3);
-  free (state->ytmp);
-  free (state);
+  free (vstate);
 }
 
 static const gsl_odeiv2_step_type rk2_type = { "rk2",   /* name */
@@ -245,7 +225,11 @@ static const gsl_odeiv2_step_type rk2_type = { "rk2",   /* name */
   &stepper_set_driver_null,
   &rk2_reset,
   &rk2_order,
-  &rk2_free
+  &rk2_free,
+  NULL,                         /* no dense output */
+  &rk2_size,
+  &rk2_init,
+  NULL                          /* no jacobian */
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_rk2 = &rk2_type;
@@ -52,7 +52,7 @@ typedef struct
   double *y_save;               /* Backup space */
   double *YZ;                   /* Runge-Kutta points */
   double *fYZ;                  /* Derivatives at YZ */
-  gsl_matrix *dfdy;             /* Jacobian matrix */
+  odeiv2_jac_t *jac;            /* Jacobian and iteration matrix */
   double *dfdt;                 /* time derivative of f */
   modnewton1_state_t *esol;     /* nonlinear equation solver */
   double *errlev;               /* desired error level of y */
@@ -163,9 +163,9 @@ rk2imp_alloc (size_t dim)
       GSL_ERROR_NULL ("failed to allocate space for dfdt", GSL_ENOMEM);
     }
 
-  state->dfdy = gsl_matrix_alloc (dim, dim);
+  state->jac = odeiv2_jac_alloc (dim, RK2IMP_STAGE);
 
-  if (state->dfdy == 0)
+  if (state->jac == 0)
     {
       free (state->dfdt);
       free (state->fYZ);
@@ -176,14 +176,14 @@ rk2imp_alloc (size_t dim)
       free (state->y_onestep);
       gsl_matrix_free (state->A);
       free (state);
-      GSL_ERROR_NULL ("failed to allocate space for dfdy", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for jac", GSL_ENOMEM);
     }
 
   state->esol = modnewton1_alloc (dim, RK2IMP_STAGE);
 
   if (state->esol == 0)
     {
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       free (state->dfdt);
       free (state->fYZ);
       free (state->YZ);
@@ -201,7 +201,7 @@ rk2imp_alloc (size_t dim)
   if (state->errlev == 0)
     {
       modnewton1_free (state->esol);
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       free (state->dfdt);
       free (state->fYZ);
       free (state->YZ);
@@ -237,7 +237,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
   double *const y_save = state->y_save;
   double *const YZ = state->YZ;
   double *const fYZ = state->fYZ;
-  gsl_matrix *const dfdy = state->dfdy;
+  odeiv2_jac_t *const jac = state->jac;
   double *const dfdt = state->dfdt;
   double *const errlev = state->errlev;
 
@@ -301,7 +301,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
 #ifdef DEBUG
     printf ("-- evaluate jacobian\n");
 #endif
-    int s = GSL_ODEIV_JA_EVAL (sys, t, y, dfdy->data, dfdt);
+    int s = odeiv2_jac_eval (jac, sys, t, y, dfdt);
 
     if (s != GSL_SUCCESS)
       {
@@ -316,14 +316,14 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
     size_t i;
     size_t j;
 
-    M = dfdy->size1;
-    N = dfdy->size2;
+    M = jac->dfdy->size1;
+    N = jac->dfdy->size2;
 
     for (i = 0; i < M; i++)
       {
         for (j = 0; j < N; j++)
           {
-            double aij = gsl_matrix_get (dfdy, i, j);
+            double aij = gsl_matrix_get (jac->dfdy, i, j);
             printf ("(%3lu,%3lu)[%lu,%lu]: %22.18g\n", M, N, i, j, aij);
           }
       }
@@ -333,7 +333,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
   /* Calculate a single step with size h */
 
   {
-    int s = modnewton1_init ((void *) esol, A, h, dfdy, sys);
+    int s = modnewton1_init ((void *) esol, A, h, jac, sys);
 
     if (s != GSL_SUCCESS)
       {
@@ -348,25 +348,25 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
 
     printf ("-- modnewton1_init IhAJ:\n");
 
-    M = esol->IhAJ->size1;
-    N = esol->IhAJ->size2;
+    M = jac->M->size1;
+    N = jac->M->size2;
 
     for (i = 0; i < M; i++)
       {
         for (j = 0; j < N; j++)
           {
-            double aij = gsl_matrix_get (esol->IhAJ, i, j);
+            double aij = gsl_matrix_get (jac->M, i, j);
             printf ("(%3lu,%3lu)[%lu,%lu]: %22.18g\n", M, N, i, j, aij);
           }
       }
 
     printf ("-- modnewton1_init p:\n");
 
-    M = esol->p->size;
+    M = jac->p->size;
 
     for (i = 0; i < M; i++)
       {
-        double pi = gsl_permutation_get (esol->p, i);
+        double pi = gsl_permutation_get (jac->p, i);
         printf ("(%3lu)[%lu]: %22.18g\n", M, i, pi);
       }
 #endif
@@ -374,7 +374,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
 
   {
     int s = modnewton1_solve ((void *) esol, A, c, t, h, y,
-                              sys, YZ, errlev);
+                              jac, sys, YZ, errlev);
 #ifdef DEBUG
     printf ("-- modnewton1_solve s=%d\n", s);
 #endif
@@ -434,7 +434,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
   /* Error estimation by step doubling */
 
   {
-    int s = modnewton1_init ((void *) esol, A, h / 2.0, dfdy, sys);
+    int s = modnewton1_init ((void *) esol, A, h / 2.0, jac, sys);
 
     if (s != GSL_SUCCESS)
       {
@@ -446,7 +446,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
 
   {
     int s = modnewton1_solve ((void *) esol, A, c, t, h / 2.0, y,
-                              sys, YZ, errlev);
+                              jac, sys, YZ, errlev);
 
     if (s != GSL_SUCCESS)
       return s;
@@ -478,7 +478,7 @@ rk2imp_apply (void *vstate, size_t dim, double t, double h,
 
   {
     int s = modnewton1_solve ((void *) esol, A, c, t + h / 2.0, h / 2.0,
-                              ytmp, sys, YZ, errlev);
+                              ytmp, jac, sys, YZ, errlev);
 
     if (s != GSL_SUCCESS)
       {
@@ -592,7 +592,7 @@ rk2imp_free (void *vstate)
 
   free (state->errlev);
   modnewton1_free (state->esol);
-  gsl_matrix_free (state->dfdy);
+  odeiv2_jac_free (state->jac);
   free (state->dfdt);
   free (state->fYZ);
   free (state->YZ);
@@ -604,6 +604,14 @@ rk2imp_free (void *vstate)
   free (state);
 }
 
+static void *
+rk2imp_jacobian (void *vstate)
+{
+  rk2imp_state_t *state = (rk2imp_state_t *) vstate;
+
+  return &state->jac->in;
+}
+
 static const gsl_odeiv2_step_type rk2imp_type = {
   "rk2imp",                     /* name */
   1,                            /* can use dydt_in? */
@@ -613,7 +621,11 @@ static const gsl_odeiv2_step_type rk2imp_type = {
   &rk2imp_set_driver,
   &rk2imp_reset,
   &rk2imp_order,
-  &rk2imp_free
+  &rk2imp_free,
+  NULL,                         /* no dense output */
+  NULL,                         /* no caller-provided workspace */
+  NULL,
+  &rk2imp_jacobian
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_rk2imp = &rk2imp_type;
@@ -48,67 +48,41 @@ typedef struct
 }
 rk4_state_t;
 
-static void *
-rk4_alloc (size_t dim)
+static size_t
+rk4_size (size_t dim)
 {
-  rk4_state_t *state = (rk4_state_t *) malloc (sizeof (rk4_state_t));
-
-  if (state == 0)
-    {
-      GSL_ERROR_NULL ("failed to allocate space for rk4_state", GSL_ENOMEM);
-    }
-
-  state->k = (double *) malloc (dim * sizeof (double));
-
-  if (state->k == 0)
-    {
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k", GSL_ENOMEM);
-    }
-
-  state->k1 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k1 == 0)
-    {
-      free (state->k);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k1", GSL_ENOMEM);
-    }
+  return ODEIV_ALIGN (sizeof (rk4_state_t)) + 5 * dim * sizeof (double);
+}
 
-  state->y0 = (double *) malloc (dim * sizeof (double));
+static void *
+rk4_init (void *mem, size_t dim)
+{
+  /* Lays out the state in the block mem of rk4_size (dim) bytes */
 
-  if (state->y0 == 0)
-    {
-      free (state->k);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for y0", GSL_ENOMEM);
-    }
+  rk4_state_t *state = (rk4_state_t *) mem;
+  double *w =
+    (double *) ((char *) mem + ODEIV_ALIGN (sizeof (rk4_state_t)));
 
-  state->ytmp = (double *) malloc (dim * sizeof (double));
+  state->k = w;
+  state->k1 = w + dim;
+  state->y0 = w + 2 * dim;
+  state->ytmp = w + 3 * dim;
+  state->y_onestep = w + 4 * dim;
 
-  if (state->ytmp == 0)
-    {
-      free (state->y0);
-      free (state->k);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for ytmp", GSL_ENOMEM);
-    }
+  return state;
+}
 
-  state->y_onestep = (double *) malloc (dim * sizeof (double));
+static void *
+rk4_alloc (size_t dim)
+{
+  void *mem = malloc (rk4_size (dim));
 
-  if (state->y_onestep == 0)
+  if (mem == 0)
     {
-      free (state->ytmp);
-      free (state->y0);
-      free (state->k);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for ytmp", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for rk4_state", GSL_ENOMEM);
     }
 
-  return state;
+  return rk4_init (mem, dim);
 }
 
 static int
@@ -337,13 +311,7 @@ rk4_order (void *vstate)
 static void
 rk4_free (void *vstate)
 {
-  rk4_state_t *state = (rk4_state_t *) vstate;
-  free (state->k);
-  free (state->k1);
-  free (state->y0);
-  free (state->ytmp);
-  free (state->y_onestep);
-  free (state);
+  free (vstate);
 }
 
 static const gsl_odeiv2_step_type rk4_type = { "rk4",   /* name */
@@ -354,7 +322,11 @@ static const gsl_odeiv2_step_type rk4_type = { "rk4",   /* name */
   &stepper_set_driver_null,
   &rk4_reset,
   &rk4_order,
-  &rk4_free
+  &rk4_free,
+  NULL,                         /* no dense output */
+  &rk4_size,
+  &rk4_init,
+  NULL                          /* no jacobian */
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_rk4 = &rk4_type;
@@ -53,7 +53,7 @@ typedef struct
   double *y_save;               /* Backup space */
   double *YZ;                   /* Runge-Kutta points */
   double *fYZ;                  /* Derivatives at YZ */
-  gsl_matrix *dfdy;             /* Jacobian matrix */
+  odeiv2_jac_t *jac;            /* Jacobian and iteration matrix */
   double *dfdt;                 /* time derivative of f */
   modnewton1_state_t *esol;     /* nonlinear equation solver */
   double *errlev;               /* desired error level of y */
@@ -164,9 +164,9 @@ rk4imp_alloc (size_t dim)
       GSL_ERROR_NULL ("failed to allocate space for dfdt", GSL_ENOMEM);
     }
 
-  state->dfdy = gsl_matrix_alloc (dim, dim);
+  state->jac = odeiv2_jac_alloc (dim, RK4IMP_STAGE);
 
-  if (state->dfdy == 0)
+  if (state->jac == 0)
     {
       free (state->dfdt);
       free (state->fYZ);
@@ -177,14 +177,14 @@ rk4imp_alloc (size_t dim)
       free (state->y_onestep);
       gsl_matrix_free (state->A);
       free (state);
-      GSL_ERROR_NULL ("failed to allocate space for dfdy", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for jac", GSL_ENOMEM);
     }
 
   state->esol = modnewton1_alloc (dim, RK4IMP_STAGE);
 
   if (state->esol == 0)
     {
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       free (state->dfdt);
       free (state->fYZ);
       free (state->YZ);
@@ -202,7 +202,7 @@ rk4imp_alloc (size_t dim)
   if (state->errlev == 0)
     {
       modnewton1_free (state->esol);
-      gsl_matrix_free (state->dfdy);
+      odeiv2_jac_free (state->jac);
       free (state->dfdt);
       free (state->fYZ);
       free (state->YZ);
@@ -238,7 +238,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
   double *const y_save = state->y_save;
   double *const YZ = state->YZ; /* Runge-Kutta points */
   double *const fYZ = state->fYZ;
-  gsl_matrix *const dfdy = state->dfdy;
+  odeiv2_jac_t *const jac = state->jac;
   double *const dfdt = state->dfdt;
   double *const errlev = state->errlev;
 
@@ -291,7 +291,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
   /* Evaluate Jacobian for modnewton1 */
 
   {
-    int s = GSL_ODEIV_JA_EVAL (sys, t, y, dfdy->data, dfdt);
+    int s = odeiv2_jac_eval (jac, sys, t, y, dfdt);
 
     if (s != GSL_SUCCESS)
       {
@@ -302,7 +302,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
   /* Calculate a single step with size h */
 
   {
-    int s = modnewton1_init ((void *) esol, A, h, dfdy, sys);
+    int s = modnewton1_init ((void *) esol, A, h, jac, sys);
 
     if (s != GSL_SUCCESS)
       {
@@ -312,7 +312,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
 
   {
     int s = modnewton1_solve ((void *) esol, A, c, t, h, y,
-                              sys, YZ, errlev);
+                              jac, sys, YZ, errlev);
 
     if (s != GSL_SUCCESS)
       {
@@ -347,7 +347,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
   /* Error estimation by step doubling */
 
   {
-    int s = modnewton1_init ((void *) esol, A, h / 2.0, dfdy, sys);
+    int s = modnewton1_init ((void *) esol, A, h / 2.0, jac, sys);
 
     if (s != GSL_SUCCESS)
       {
@@ -359,7 +359,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
 
   {
     int s = modnewton1_solve ((void *) esol, A, c, t, h / 2.0, y,
-                              sys, YZ, errlev);
+                              jac, sys, YZ, errlev);
 
     if (s != GSL_SUCCESS)
       {
@@ -396,7 +396,7 @@ rk4imp_apply (void *vstate, size_t dim, double t, double h,
 
   {
     int s = modnewton1_solve ((void *) esol, A, c, t + h / 2.0, h / 2.0,
-                              ytmp, sys, YZ, errlev);
+                              ytmp, jac, sys, YZ, errlev);
 
     if (s != GSL_SUCCESS)
       {
@@ -505,7 +505,7 @@ rk4imp_free (void *vstate)
 
   free (state->errlev);
   modnewton1_free (state->esol);
-  gsl_matrix_free (state->dfdy);
+  odeiv2_jac_free (state->jac);
   free (state->dfdt);
   free (state->fYZ);
   free (state->YZ);
@@ -517,6 +517,14 @@ rk4imp_free (void *vstate)
   free (state);
 }
 
+static void *
+rk4imp_jacobian (void *vstate)
+{
+  rk4imp_state_t *state = (rk4imp_state_t *) vstate;
+
+  return &state->jac->in;
+}
+
 static const gsl_odeiv2_step_type rk4imp_type = {
   "rk4imp",                     /* name */
   1,                            /* can use dydt_in? */
@@ -526,7 +534,11 @@ static const gsl_odeiv2_step_type rk4imp_type = {
   &rk4imp_set_driver,
   &rk4imp_reset,
   &rk4imp_order,
-  &rk4imp_free
+  &rk4imp_free,
+  NULL,                         /* no dense output */
+  NULL,                         /* no caller-provided workspace */
+  NULL,
+  &rk4imp_jacobian
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_rk4imp = &rk4imp_type;
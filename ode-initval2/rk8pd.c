@@ -34,6 +34,7 @@
 
 #include "odeiv_util.h"
 #include "step_utils.c"
+#include "dense.c"
 
 /* Prince-Dormand constants */
 
@@ -176,52 +177,61 @@ typedef struct
   double *k[13];
   double *ytmp;
   double *y0;
+  odeiv2_dense_t *dense;
 }
 rk8pd_state_t;
 
+static size_t
+rk8pd_size (size_t dim)
+{
+  return ODEIV_ALIGN (sizeof (rk8pd_state_t))
+    + ODEIV_ALIGN (15 * dim * sizeof (double))
+    + odeiv2_dense_size (dim, 4);
+}
+
 static void *
-rk8pd_alloc (size_t dim)
+rk8pd_init (void *mem, size_t dim)
 {
-  rk8pd_state_t *state = (rk8pd_state_t *) malloc (sizeof (rk8pd_state_t));
-  int i, j;
+  /* Lays out the state in the block mem of rk8pd_size (dim) bytes */
 
-  if (state == 0)
-    {
-      GSL_ERROR_NULL ("failed to allocate space for rk8pd_state", GSL_ENOMEM);
-    }
+  rk8pd_state_t *state = (rk8pd_state_t *) mem;
+  size_t i;
+  double *w =
+    (double *) ((char *) mem + ODEIV_ALIGN (sizeof (rk8pd_state_t)));
 
-  state->ytmp = (double *) malloc (dim * sizeof (double));
+  for (i = 0; i < 13; i++)
+    state->k[i] = w + i * dim;
+
+  state->ytmp = w + 13 * dim;
+  state->y0 = w + 14 * dim;
+  state->dense =
+    odeiv2_dense_init ((char *) w + ODEIV_ALIGN (15 * dim * sizeof (double)),
+                       dim, 4);
 
-  if (state->ytmp == 0)
+  if (state->dense == 0)
     {
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for ytmp", GSL_ENOMEM);
+      return NULL;
     }
 
-  state->y0 = (double *) malloc (dim * sizeof (double));
+  return state;
+}
+
+static void *
+rk8pd_alloc (size_t dim)
+{
+  void *mem = malloc (rk8pd_size (dim));
+  void *state;
 
-  if (state->y0 == 0)
+  if (mem == 0)
     {
-      free (state->ytmp);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for y0", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for rk8pd_state", GSL_ENOMEM);
     }
 
-  for (i = 0; i < 13; i++)
-    {
-      state->k[i] = (double *) malloc (dim * sizeof (double));
+  state = rk8pd_init (mem, dim);
 
-      if (state->k[i] == 0)
-        {
-          for (j = 0; j < i; j++)
-            {
-              free (state->k[j]);
-            }
-          free (state->y0);
-          free (state->ytmp);
-          free (state);
-          GSL_ERROR_NULL ("failed to allocate space for k's", GSL_ENOMEM);
-        }
+  if (state == 0)
+    {
+      free (mem);
     }
 
   return state;
@@ -488,6 +498,8 @@ rk8pd_apply (void *vstate,
       yerr[i] = h * (ksum7 - ksum8);
     }
 
+  odeiv2_dense_set (state->dense, t, h, y0, y, k1, dydt_out);
+
   return GSL_SUCCESS;
 }
 
@@ -506,6 +518,8 @@ rk8pd_reset (void *vstate, size_t dim)
   DBL_ZERO_MEMSET (state->y0, dim);
   DBL_ZERO_MEMSET (state->ytmp, dim);
 
+  odeiv2_dense_reset (state->dense);
+
   return GSL_SUCCESS;
 }
 
@@ -519,17 +533,17 @@ rk8pd_order (void *vstate)
 
 static void
 rk8pd_free (void *vstate)
+{
+  free (vstate);
+}
+
+static int
+rk8pd_interp (void *vstate, size_t dim, double t, double y[],
+              const gsl_odeiv2_system * sys)
 {
   rk8pd_state_t *state = (rk8pd_state_t *) vstate;
-  int i;
 
-  for (i = 0; i < 13; i++)
-    {
-      free (state->k[i]);
-    }
-  free (state->y0);
-  free (state->ytmp);
-  free (state);
+  return odeiv2_dense_eval (state->dense, t, y, sys);
 }
 
 static const gsl_odeiv2_step_type rk8pd_type = { "rk8pd",       /* name */
@@ -540,7 +554,11 @@ static const gsl_odeiv2_step_type rk8pd_type = { "rk8pd",       /* name */
   &stepper_set_driver_null,
   &rk8pd_reset,
   &rk8pd_order,
-  &rk8pd_free
+  &rk8pd_free,
+  &rk8pd_interp,
+  &rk8pd_size,
+  &rk8pd_init,
+  NULL                          /* no jacobian */
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_rk8pd = &rk8pd_type;
@@ -32,6 +32,7 @@
 
 #include "odeiv_util.h"
 #include "step_utils.c"
+#include "dense.c"
 
 /* Cash-Karp constants */
 static const double ah[] = { 1.0 / 5.0, 0.3, 3.0 / 5.0, 1.0, 7.0 / 8.0 };
@@ -73,109 +74,63 @@ typedef struct
   double *k6;
   double *y0;
   double *ytmp;
+  odeiv2_dense_t *dense;
 }
 rkck_state_t;
 
-static void *
-rkck_alloc (size_t dim)
+static size_t
+rkck_size (size_t dim)
 {
-  rkck_state_t *state = (rkck_state_t *) malloc (sizeof (rkck_state_t));
-
-  if (state == 0)
-    {
-      GSL_ERROR_NULL ("failed to allocate space for rkck_state", GSL_ENOMEM);
-    }
-
-  state->k1 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k1 == 0)
-    {
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k1", GSL_ENOMEM);
-    }
-
-  state->k2 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k2 == 0)
-    {
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k2", GSL_ENOMEM);
-    }
-
-  state->k3 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k3 == 0)
-    {
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k3", GSL_ENOMEM);
-    }
-
-  state->k4 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k4 == 0)
-    {
-      free (state->k3);
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k4", GSL_ENOMEM);
-    }
-
-  state->k5 = (double *) malloc (dim * sizeof (double));
+  return ODEIV_ALIGN (sizeof (rkck_state_t))
+    + ODEIV_ALIGN (8 * dim * sizeof (double))
+    + odeiv2_dense_size (dim, 1);
+}
 
-  if (state->k5 == 0)
+static void *
+rkck_init (void *mem, size_t dim)
+{
+  /* Lays out the state in the block mem of rkck_size (dim) bytes */
+
+  rkck_state_t *state = (rkck_state_t *) mem;
+  double *w =
+    (double *) ((char *) mem + ODEIV_ALIGN (sizeof (rkck_state_t)));
+
+  state->k1 = w;
+  state->k2 = w + dim;
+  state->k3 = w + 2 * dim;
+  state->k4 = w + 3 * dim;
+  state->k5 = w + 4 * dim;
+  state->k6 = w + 5 * dim;
+  state->y0 = w + 6 * dim;
+  state->ytmp = w + 7 * dim;
+  state->dense =
+    odeiv2_dense_init ((char *) w + ODEIV_ALIGN (8 * dim * sizeof (double)),
+                       dim, 1);
+
+  if (state->dense == 0)
     {
-      free (state->k4);
-      free (state->k3);
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k5", GSL_ENOMEM);
+      return NULL;
     }
 
-  state->k6 = (double *) malloc (dim * sizeof (double));
-
-  if (state->k6 == 0)
-    {
-      free (state->k5);
-      free (state->k4);
-      free (state->k3);
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for k6", GSL_ENOMEM);
-    }
+  return state;
+}
 
-  state->y0 = (double *) malloc (dim * sizeof (double));
+static void *
+rkck_alloc (size_t dim)
+{
+  void *mem = malloc (rkck_size (dim));
+  void *state;
 
-  if (state->y0 == 0)
+  if (mem == 0)
     {
-      free (state->k6);
-      free (state->k5);
-      free (state->k4);
-      free (state->k3);
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for y0", GSL_ENOMEM);
+      GSL_ERROR_NULL ("failed to allocate space for rkck_state", GSL_ENOMEM);
     }
 
-  state->ytmp = (double *) malloc (dim * sizeof (double));
+  state = rkck_init (mem, dim);
 
-  if (state->ytmp == 0)
+  if (state == 0)
     {
-      free (state->y0);
-      free (state->k6);
-      free (state->k5);
-      free (state->k4);
-      free (state->k3);
-      free (state->k2);
-      free (state->k1);
-      free (state);
-      GSL_ERROR_NULL ("failed to allocate space for ytmp", GSL_ENOMEM);
+      free (mem);
     }
 
   return state;
@@ -318,6 +273,8 @@ rkck_apply (void *vstate,
                      + ec[5] * k5[i] + ec[6] * k6[i]);
     }
 
+  odeiv2_dense_set (state->dense, t, h, y0, y, k1, dydt_out);
+
   return GSL_SUCCESS;
 }
 
@@ -336,6 +293,8 @@ rkck_reset (void *vstate, size_t dim)
   DBL_ZERO_MEMSET (state->ytmp, dim);
   DBL_ZERO_MEMSET (state->y0, dim);
 
+  odeiv2_dense_reset (state->dense);
+
   return GSL_SUCCESS;
 }
 
@@ -349,18 +308,17 @@ rkck_order (void *vstate)
 
 static void
 rkck_free (void *vstate)
+{
+  free (vstate);
+}
+
+static int
+rkck_interp (void *vstate, size_t dim, double t, double y[],
+             const gsl_odeiv2_system * sys)
 {
   rkck_state_t *state = (rkck_state_t *) vstate;
 
-  free (state->ytmp);
-  free (state->y0);
-  free (state->k6);
-  free (state->k5);
-  free (state->k4);
-  free (state->k3);
-  free (state->k2);
-  free (state->k1);
-  free (state);
+  return odeiv2_dense_eval (state->dense, t, y, sys);
 }
 
 static const gsl_odeiv2_step_type rkck_type = { "rkck", /* name */
@@ -371,7 +329,11 @@ static const gsl_odeiv2_step_type rkck_type = { "rkck", /* name */
   &stepper_set_driver_null,
   &rkck_reset,
   &rkck_order,
-  &rkck_free
+  &rkck_free,
+  &rkck_interp,
+  &rkck_size,
+  &rkck_init,
+  NULL                          /* no jacobian */
 };
 
 const gsl_odeiv2_step_type *gsl_odeiv2_step_rkck = &rkck_type;
@@ -24,6 +24,8 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_odeiv2.h>
 
+#include "odeiv_util.h"
+
 gsl_odeiv2_step *
 gsl_odeiv2_step_alloc (const gsl_odeiv2_step_type * T, size_t dim)
 {
@@ -49,6 +51,50 @@ gsl_odeiv2_step_alloc (const gsl_odeiv2_step_type * T, size_t dim)
   return s;
 }
 
+size_t
+gsl_odeiv2_step_workspace_size (const gsl_odeiv2_step_type * T, size_t dim)
+{
+  /* Returns the number of bytes needed by gsl_odeiv2_step_init, or
+     zero if the stepper cannot be constructed in a caller buffer */
+
+  if (T->state_size == NULL)
+    {
+      return 0;
+    }
+
+  return ODEIV_ALIGN (sizeof (gsl_odeiv2_step)) + T->state_size (dim);
+}
+
+gsl_odeiv2_step *
+gsl_odeiv2_step_init (void *work, size_t size,
+                      const gsl_odeiv2_step_type * T, size_t dim)
+{
+  gsl_odeiv2_step *s = (gsl_odeiv2_step *) work;
+
+  if (T->state_init == NULL)
+    {
+      GSL_ERROR_NULL ("stepper does not support caller-provided workspace",
+                      GSL_EUNIMPL);
+    }
+
+  if (size < gsl_odeiv2_step_workspace_size (T, dim))
+    {
+      GSL_ERROR_NULL ("workspace is too small", GSL_EINVAL);
+    }
+
+  s->type = T;
+  s->dimension = dim;
+  s->state = T->state_init ((char *) work
+                            + ODEIV_ALIGN (sizeof (gsl_odeiv2_step)), dim);
+
+  if (s->state == 0)
+    {
+      GSL_ERROR_NULL ("failed to initialize ode state", GSL_EFAILED);
+    }
+
+  return s;
+}
+
 const char *
 gsl_odeiv2_step_name (const gsl_odeiv2_step * s)
 {
@@ -74,6 +120,18 @@ gsl_odeiv2_step_apply (gsl_odeiv2_step * s,
                          dydt_out, dydt);
 }
 
+int
+gsl_odeiv2_step_interp (gsl_odeiv2_step * s, double t, double y[],
+                        const gsl_odeiv2_system * dydt)
+{
+  if (s->type->interp == NULL)
+    {
+      GSL_ERROR ("stepper does not provide dense output", GSL_EUNIMPL);
+    }
+
+  return s->type->interp (s->state, s->dimension, t, y, dydt);
+}
+
 int
 gsl_odeiv2_step_reset (gsl_odeiv2_step * s)
 {
@@ -102,3 +160,99 @@ gsl_odeiv2_step_set_driver (gsl_odeiv2_step * s, const gsl_odeiv2_driver * d)
 
   return GSL_SUCCESS;
 }
+
+static odeiv2_jac_input *
+step_jacobian (gsl_odeiv2_step * s)
+{
+  /* Returns the jacobian input of the stepper, or NULL if the
+     stepper does not use a jacobian */
+
+  if (s->type->jacobian == NULL)
+    {
+      return NULL;
+    }
+
+  return (odeiv2_jac_input *) s->type->jacobian (s->state);
+}
+
+int
+gsl_odeiv2_step_set_jacobian_band (gsl_odeiv2_step * s,
+                                   int (*jacobian) (double t,
+                                                    const double y[],
+                                                    gsl_matrix * dfdy,
+                                                    double dfdt[],
+                                                    void *params),
+                                   const size_t lower, const size_t upper)
+{
+  odeiv2_jac_input *in = step_jacobian (s);
+
+  if (in == NULL)
+    {
+      GSL_ERROR ("stepper does not use a jacobian", GSL_EUNIMPL);
+    }
+
+  if (jacobian != NULL &&
+      (lower >= s->dimension || upper >= s->dimension))
+    {
+      GSL_ERROR ("bandwidths must be smaller than dimension", GSL_EDOM);
+    }
+
+  in->band = jacobian;
+  in->lower = jacobian != NULL ? lower : 0;
+  in->upper = jacobian != NULL ? upper : 0;
+  in->sparse = NULL;
+  in->pattern = NULL;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_odeiv2_step_set_jacobian_sparse (gsl_odeiv2_step * s,
+                                     int (*jacobian) (double t,
+                                                      const double y[],
+                                                      gsl_spmatrix * dfdy,
+                                                      double dfdt[],
+                                                      void *params))
+{
+  odeiv2_jac_input *in = step_jacobian (s);
+
+  if (in == NULL)
+    {
+      GSL_ERROR ("stepper does not use a jacobian", GSL_EUNIMPL);
+    }
+
+  in->band = NULL;
+  in->lower = 0;
+  in->upper = 0;
+  in->sparse = jacobian;
+  in->pattern = NULL;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_odeiv2_step_set_jacobian_pattern (gsl_odeiv2_step * s,
+                                      const gsl_spmatrix * pattern)
+{
+  odeiv2_jac_input *in = step_jacobian (s);
+
+  if (in == NULL)
+    {
+      GSL_ERROR ("stepper does not use a jacobian", GSL_EUNIMPL);
+    }
+
+  if (pattern != NULL &&
+      (pattern->size1 != s->dimension || pattern->size2 != s->dimension))
+    {
+      GSL_ERROR ("jacobian pattern must be dimension-by-dimension",
+                 GSL_EBADLEN);
+    }
+
+  in->band = NULL;
+  in->lower = 0;
+  in->upper = 0;
+  in->sparse = NULL;
+  in->pattern = pattern;
+
+  return GSL_SUCCESS;
+}
@@ -1039,6 +1039,192 @@ gsl_odeiv2_system rhs_func_ringmod = {
   NULL
 };
 
+/* Reaction-diffusion problem: discretized heat equation with a
+   quadratic sink term. The Jacobian is tridiagonal, and is provided
+   in dense, banded and sparse form for testing the Jacobian storage
+   of the implicit steppers. */
+
+#define NDIFF 40
+#define DDIFF 500.0
+
+int
+rhs_diff (double t, const double y[], double f[], void *params)
+{
+  size_t i;
+
+  for (i = 0; i < NDIFF; i++)
+    {
+      const double yl = (i > 0) ? y[i - 1] : 0.0;
+      const double yr = (i < NDIFF - 1) ? y[i + 1] : 0.0;
+
+      f[i] = DDIFF * (yl - 2.0 * y[i] + yr) - y[i] * y[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_diff (double t, const double y[], double *dfdy, double dfdt[],
+          void *params)
+{
+  size_t i;
+
+  for (i = 0; i < NDIFF * NDIFF; i++)
+    {
+      dfdy[i] = 0.0;
+    }
+
+  for (i = 0; i < NDIFF; i++)
+    {
+      dfdy[i * NDIFF + i] = -2.0 * DDIFF - 2.0 * y[i];
+
+      if (i > 0)
+        dfdy[i * NDIFF + i - 1] = DDIFF;
+
+      if (i < NDIFF - 1)
+        dfdy[i * NDIFF + i + 1] = DDIFF;
+
+      dfdt[i] = 0.0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_diff_band (double t, const double y[], gsl_matrix * dfdy, double dfdt[],
+               void *params)
+{
+  /* J(i,j) is stored in dfdy(j, upper + i - j) with upper = 1 */
+
+  size_t i;
+
+  for (i = 0; i < NDIFF; i++)
+    {
+      gsl_matrix_set (dfdy, i, 1, -2.0 * DDIFF - 2.0 * y[i]);
+
+      if (i > 0)
+        gsl_matrix_set (dfdy, i - 1, 2, DDIFF);
+
+      if (i < NDIFF - 1)
+        gsl_matrix_set (dfdy, i + 1, 0, DDIFF);
+
+      dfdt[i] = 0.0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_diff_sparse (double t, const double y[], gsl_spmatrix * dfdy,
+                 double dfdt[], void *params)
+{
+  size_t i;
+
+  for (i = 0; i < NDIFF; i++)
+    {
+      gsl_spmatrix_set (dfdy, i, i, -2.0 * DDIFF - 2.0 * y[i]);
+
+      if (i > 0)
+        gsl_spmatrix_set (dfdy, i, i - 1, DDIFF);
+
+      if (i < NDIFF - 1)
+        gsl_spmatrix_set (dfdy, i, i + 1, DDIFF);
+
+      dfdt[i] = 0.0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_diff_fail (double t, const double y[], gsl_spmatrix * dfdy,
+               double dfdt[], void *params)
+{
+  return GSL_EBADFUNC;
+}
+
+gsl_odeiv2_system rhs_func_diff = {
+  rhs_diff,
+  jac_diff,
+  NDIFF,
+  NULL
+};
+
+
+/* Heat equation on n points with diffusion constant D (in params).
+   The iteration matrix I - h gamma J has condition number of about
+   1 + 4 h gamma D, so that for large steps the sparse form needs many
+   restarted GMRES iterations. */
+
+typedef struct
+{
+  size_t n;
+  double D;
+}
+heat_params;
+
+int
+rhs_heat (double t, const double y[], double f[], void *params)
+{
+  const heat_params *p = (const heat_params *) params;
+  size_t i;
+
+  for (i = 0; i < p->n; i++)
+    {
+      const double yl = (i > 0) ? y[i - 1] : 0.0;
+      const double yr = (i < p->n - 1) ? y[i + 1] : 0.0;
+
+      f[i] = p->D * (yl - 2.0 * y[i] + yr);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_heat_band (double t, const double y[], gsl_matrix * dfdy, double dfdt[],
+               void *params)
+{
+  const heat_params *p = (const heat_params *) params;
+  size_t i;
+
+  for (i = 0; i < p->n; i++)
+    {
+      gsl_matrix_set (dfdy, i, 1, -2.0 * p->D);
+
+      if (i > 0)
+        gsl_matrix_set (dfdy, i - 1, 2, p->D);
+
+      if (i < p->n - 1)
+        gsl_matrix_set (dfdy, i + 1, 0, p->D);
+
+      dfdt[i] = 0.0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_heat_sparse (double t, const double y[], gsl_spmatrix * dfdy,
+                 double dfdt[], void *params)
+{
+  const heat_params *p = (const heat_params *) params;
+  size_t i;
+
+  for (i = 0; i < p->n; i++)
+    {
+      gsl_spmatrix_set (dfdy, i, i, -2.0 * p->D);
+
+      if (i > 0)
+        gsl_spmatrix_set (dfdy, i, i - 1, p->D);
+
+      if (i < p->n - 1)
+        gsl_spmatrix_set (dfdy, i, i + 1, p->D);
+
+      dfdt[i] = 0.0;
+    }
+
+  return GSL_SUCCESS;
+}
 
 /**********************************************************/
 /* Functions for carrying out tests                       */
@@ -2223,6 +2409,690 @@ test_driver (const gsl_odeiv2_step_type * T)
   gsl_odeiv2_driver_free (d);
 }
 
+void
+test_jacobian_storage (const gsl_odeiv2_step_type * T)
+{
+  /* Tests that banded, sparse and finite difference Jacobians give
+     the same solution as a dense Jacobian */
+
+  const double tol = 1e-8;
+  const double t1 = 0.5;
+  const char *desc[5] =
+    { "dense", "band", "sparse", "fdiff band", "fdiff dense" };
+  gsl_spmatrix *P1 = gsl_spmatrix_alloc (NDIFF, NDIFF);
+  gsl_spmatrix *P2;
+  double y[5][NDIFF];
+  size_t i, k;
+
+  /* tridiagonal pattern, and a periodic one which is not banded */
+
+  for (i = 0; i < NDIFF; i++)
+    {
+      gsl_spmatrix_set (P1, i, i, 1.0);
+
+      if (i > 0)
+        gsl_spmatrix_set (P1, i, i - 1, 1.0);
+
+      if (i < NDIFF - 1)
+        gsl_spmatrix_set (P1, i, i + 1, 1.0);
+    }
+
+  P2 = gsl_spmatrix_compress (P1, GSL_SPMATRIX_CSR);
+  gsl_spmatrix_set (P1, 0, NDIFF - 1, 1.0);
+  gsl_spmatrix_set (P1, NDIFF - 1, 0, 1.0);
+
+  for (k = 0; k < 5; k++)
+    {
+      gsl_odeiv2_driver *d =
+        gsl_odeiv2_driver_alloc_y_new (&rhs_func_diff, T, 1e-4, tol, tol);
+      double t = 0.0;
+      int s = GSL_SUCCESS;
+
+      /* the Jacobian set for the stepper takes precedence over the
+         dense jacobian of the system */
+
+      if (k == 1)
+        s = gsl_odeiv2_driver_set_jacobian_band (d, jac_diff_band, 1, 1);
+      else if (k == 2)
+        s = gsl_odeiv2_driver_set_jacobian_sparse (d, jac_diff_sparse);
+      else if (k == 3)
+        s = gsl_odeiv2_driver_set_jacobian_pattern (d, P2);
+      else if (k == 4)
+        s = gsl_odeiv2_driver_set_jacobian_pattern (d, P1);
+
+      gsl_test (s, "%s test_jacobian_storage %s set",
+                gsl_odeiv2_step_name (d->s), desc[k]);
+
+      for (i = 0; i < NDIFF; i++)
+        {
+          y[k][i] = sin (M_PI * (i + 1.0) / (NDIFF + 1.0));
+        }
+
+      s = gsl_odeiv2_driver_apply (d, &t, t1, y[k]);
+
+      gsl_test (s, "%s test_jacobian_storage %s apply",
+                gsl_odeiv2_step_name (d->s), desc[k]);
+
+      gsl_odeiv2_driver_free (d);
+    }
+
+  for (k = 1; k < 5; k++)
+    {
+      for (i = 0; i < NDIFF; i++)
+        {
+          gsl_test_rel (y[k][i], y[0][i], 1e-6,
+                        "%s test_jacobian_storage %s y[%d]",
+                        T->name, desc[k], (int) i);
+        }
+    }
+
+  gsl_spmatrix_free (P1);
+  gsl_spmatrix_free (P2);
+
+  /* a Jacobian set for the stepper is used instead of the dense
+     one, and clearing it restores the dense Jacobian */
+  {
+    gsl_odeiv2_driver *d =
+      gsl_odeiv2_driver_alloc_y_new (&rhs_func_diff, T, 1e-4, tol, tol);
+    gsl_error_handler_t *old;
+    double t = 0.0;
+    int s;
+
+    for (i = 0; i < NDIFF; i++)
+      {
+        y[1][i] = sin (M_PI * (i + 1.0) / (NDIFF + 1.0));
+      }
+
+    gsl_odeiv2_driver_set_jacobian_sparse (d, jac_diff_fail);
+
+    old = gsl_set_error_handler_off ();
+    s = gsl_odeiv2_driver_apply (d, &t, t1, y[1]);
+    gsl_set_error_handler (old);
+
+    gsl_test (s == GSL_SUCCESS,
+              "%s test_jacobian_storage set jacobian precedence",
+              gsl_odeiv2_step_name (d->s));
+
+    gsl_odeiv2_driver_set_jacobian_sparse (d, NULL);
+    gsl_odeiv2_driver_reset_hstart (d, 1e-4);
+    t = 0.0;
+
+    for (i = 0; i < NDIFF; i++)
+      {
+        y[1][i] = sin (M_PI * (i + 1.0) / (NDIFF + 1.0));
+      }
+
+    s = gsl_odeiv2_driver_apply (d, &t, t1, y[1]);
+    gsl_test (s, "%s test_jacobian_storage cleared jacobian apply",
+              gsl_odeiv2_step_name (d->s));
+
+    for (i = 0; i < NDIFF; i++)
+      {
+        gsl_test_rel (y[1][i], y[0][i], 1e-10,
+                      "%s test_jacobian_storage cleared jacobian y[%d]",
+                      T->name, (int) i);
+      }
+
+    gsl_odeiv2_driver_free (d);
+  }
+}
+
+void
+test_jacobian_setters (void)
+{
+  /* Tests the errors of the Jacobian setters */
+
+  gsl_error_handler_t *old = gsl_set_error_handler_off ();
+  gsl_odeiv2_driver *d;
+  int s;
+
+  d = gsl_odeiv2_driver_alloc_y_new (&rhs_func_diff, gsl_odeiv2_step_rk4,
+                                     1e-4, 1e-8, 1e-8);
+  s = gsl_odeiv2_driver_set_jacobian_sparse (d, jac_diff_sparse);
+  gsl_test (s != GSL_EUNIMPL, "test_jacobian_setters explicit stepper");
+  gsl_odeiv2_driver_free (d);
+
+  d = gsl_odeiv2_driver_alloc_y_new (&rhs_func_diff, gsl_odeiv2_step_bsimp,
+                                     1e-4, 1e-8, 1e-8);
+  s = gsl_odeiv2_driver_set_jacobian_band (d, jac_diff_band, NDIFF, 1);
+  gsl_test (s != GSL_EDOM, "test_jacobian_setters lower bandwidth");
+  s = gsl_odeiv2_driver_set_jacobian_band (d, jac_diff_band, 1, NDIFF);
+  gsl_test (s != GSL_EDOM, "test_jacobian_setters upper bandwidth");
+
+  {
+    gsl_spmatrix *P = gsl_spmatrix_alloc (NDIFF, NDIFF + 1);
+
+    s = gsl_odeiv2_driver_set_jacobian_pattern (d, P);
+    gsl_test (s != GSL_EBADLEN, "test_jacobian_setters pattern size");
+    gsl_spmatrix_free (P);
+  }
+
+  gsl_odeiv2_driver_free (d);
+
+  gsl_set_error_handler (old);
+}
+
+void
+test_jacobian_gmres (const gsl_odeiv2_step_type * T)
+{
+  /* Tests a sparse Jacobian on a stiff problem for which GMRES needs
+     several restarts, against the banded LU solution */
+
+  const size_t n = 200;
+  const double tol = 1e-8;
+  heat_params params;
+  gsl_odeiv2_system sys = { rhs_heat, NULL, 0, NULL };
+  double *y_band = malloc (n * sizeof (double));
+  double *y_sparse = malloc (n * sizeof (double));
+  gsl_odeiv2_driver *d;
+  double t;
+  size_t i;
+  int s;
+
+  params.n = n;
+  params.D = 1.0e4;
+
+  sys.dimension = n;
+  sys.params = &params;
+
+  for (i = 0; i < n; i++)
+    {
+      const double x = (i + 1.0) / (n + 1.0);
+
+      y_band[i] = sin (M_PI * x) + 0.1 * sin (7.0 * M_PI * x);
+      y_sparse[i] = y_band[i];
+    }
+
+  d = gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-4, tol, tol);
+  gsl_odeiv2_driver_set_jacobian_band (d, jac_heat_band, 1, 1);
+  t = 0.0;
+  s = gsl_odeiv2_driver_apply (d, &t, 1.0e-2, y_band);
+  gsl_test (s, "%s test_jacobian_gmres band apply", T->name);
+  gsl_odeiv2_driver_free (d);
+
+  d = gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-4, tol, tol);
+  gsl_odeiv2_driver_set_jacobian_sparse (d, jac_heat_sparse);
+  t = 0.0;
+  s = gsl_odeiv2_driver_apply (d, &t, 1.0e-2, y_sparse);
+  gsl_test (s, "%s test_jacobian_gmres sparse apply", T->name);
+  gsl_odeiv2_driver_free (d);
+
+  for (i = 0; i < n; i++)
+    {
+      gsl_test_abs (y_sparse[i], y_band[i], 1e-6,
+                    "%s test_jacobian_gmres y[%d]", T->name, (int) i);
+    }
+
+  free (y_band);
+  free (y_sparse);
+}
+
+/* Harmonic oscillator y'' = -y with y(0) = 1, y'(0) = 0, and event
+   functions y_0 and t - 4 for the dense output tests */
+
+int
+rhs_osc1 (double t, const double y[], double f[], void *params)
+{
+  (void) t;
+  (void) params;
+
+  f[0] = y[1];
+  f[1] = -y[0];
+
+  return GSL_SUCCESS;
+}
+
+int
+jac_osc1 (double t, const double y[], double *dfdy, double dfdt[],
+          void *params)
+{
+  (void) t;
+  (void) y;
+  (void) params;
+
+  dfdy[0] = 0.0;
+  dfdy[1] = 1.0;
+  dfdy[2] = -1.0;
+  dfdy[3] = 0.0;
+  dfdt[0] = 0.0;
+  dfdt[1] = 0.0;
+
+  return GSL_SUCCESS;
+}
+
+int
+event_osc1 (double t, const double y[], double g[], void *params)
+{
+  (void) params;
+
+  g[0] = y[0];
+  g[1] = t - 4.0;
+
+  return GSL_SUCCESS;
+}
+
+void
+test_dense_output (const gsl_odeiv2_step_type * T, const double err)
+{
+  /* Tests the interpolant of each step against the exact solution */
+
+  const double t1 = 10.0;
+  gsl_odeiv2_system sys = { rhs_osc1, jac_osc1, 2, NULL };
+  gsl_odeiv2_driver *d =
+    gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-3, 1e-10, 1e-10);
+  double t = 0.0, h = 1e-3;
+  double y[2] = { 1.0, 0.0 };
+  double emax = 0.0;
+  int status = GSL_SUCCESS;
+
+  while (t < t1 && status == GSL_SUCCESS)
+    {
+      const double t0 = t;
+      size_t j;
+
+      status = gsl_odeiv2_evolve_apply (d->e, d->c, d->s, &sys, &t, t1,
+                                        &h, y);
+
+      for (j = 0; j <= 8 && status == GSL_SUCCESS; j++)
+        {
+          const double ti = t0 + (t - t0) * j / 8.0;
+          double yi[2];
+
+          status = gsl_odeiv2_step_interp (d->s, ti, yi, &sys);
+
+          emax = GSL_MAX_DBL (emax, fabs (yi[0] - cos (ti)));
+          emax = GSL_MAX_DBL (emax, fabs (yi[1] + sin (ti)));
+        }
+    }
+
+  gsl_test (status, "%s test_dense_output status", T->name);
+  gsl_test (emax > err, "%s test_dense_output error %e", T->name, emax);
+
+  gsl_odeiv2_driver_free (d);
+}
+
+void
+test_events (const gsl_odeiv2_step_type * T, const double err)
+{
+  /* Tests that the driver stops at the zero crossings of cos(t) and
+     of t - 4 in order */
+
+  const double t1 = 10.0;
+  const double tev[] = { M_PI_2, 4.0, 3.0 * M_PI_2, 5.0 * M_PI_2 };
+  const size_t iev[] = { 0, 1, 0, 0 };
+  gsl_odeiv2_system sys = { rhs_osc1, jac_osc1, 2, NULL };
+  gsl_odeiv2_event ev = { event_osc1, 2, NULL };
+  gsl_odeiv2_driver *d =
+    gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-3, 1e-10, 1e-10);
+  double t = 0.0;
+  double y[2] = { 1.0, 0.0 };
+  size_t k;
+  int s;
+
+  gsl_odeiv2_driver_set_event (d, &ev);
+
+  for (k = 0; k < 4; k++)
+    {
+      s = gsl_odeiv2_driver_apply (d, &t, t1, y);
+
+      gsl_test (s, "%s test_events apply %d", T->name, (int) k);
+      gsl_test (!d->e->event_found || d->e->event_index != iev[k],
+                "%s test_events event %d found", T->name, (int) k);
+      gsl_test_abs (t, tev[k], err, "%s test_events t[%d]", T->name,
+                    (int) k);
+      gsl_test_abs (y[0], cos (t), err, "%s test_events y[%d]", T->name,
+                    (int) k);
+    }
+
+  s = gsl_odeiv2_driver_apply (d, &t, t1, y);
+
+  gsl_test (s || d->e->event_found || t != t1, "%s test_events end",
+            T->name);
+  gsl_test_abs (y[0], cos (t1), err, "%s test_events y end", T->name);
+
+  gsl_odeiv2_driver_free (d);
+}
+
+void
+test_driver_dense (const gsl_odeiv2_step_type * T, const double err)
+{
+  /* Tests gsl_odeiv2_driver_apply_dense at output times which do not
+     coincide with the steps, without and with events */
+
+  const size_t nout = 41;
+  const double t1 = 10.0;
+  gsl_odeiv2_system sys = { rhs_osc1, jac_osc1, 2, NULL };
+  gsl_odeiv2_event ev = { event_osc1, 2, NULL };
+  gsl_odeiv2_driver *d =
+    gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-3, 1e-10, 1e-10);
+  gsl_error_handler_t *old;
+  double tout[41], yout[2 * 41];
+  double t = 0.0;
+  double y[2] = { 1.0, 0.0 };
+  double emax = 0.0;
+  size_t k, n;
+  int s;
+
+  for (k = 0; k < nout; k++)
+    {
+      tout[k] = t1 * k / (nout - 1.0);
+    }
+
+  s = gsl_odeiv2_driver_apply_dense (d, &t, t1, y, tout, nout, yout);
+
+  gsl_test (s || t != t1, "%s test_driver_dense apply", T->name);
+  gsl_test_abs (y[0], cos (t1), err, "%s test_driver_dense y end", T->name);
+
+  for (k = 0; k < nout; k++)
+    {
+      emax = GSL_MAX_DBL (emax, fabs (yout[2 * k] - cos (tout[k])));
+      emax = GSL_MAX_DBL (emax, fabs (yout[2 * k + 1] + sin (tout[k])));
+    }
+
+  gsl_test (emax > err, "%s test_driver_dense error %e", T->name, emax);
+
+  /* with events, each call returns GSL_CONTINUE at the event and
+     fills only the outputs up to it */
+
+  gsl_odeiv2_driver_reset (d);
+  gsl_odeiv2_driver_set_event (d, &ev);
+
+  t = 0.0;
+  y[0] = 1.0;
+  y[1] = 0.0;
+  emax = 0.0;
+
+  for (k = 0; k < 2 * nout; k++)
+    {
+      yout[k] = GSL_NAN;
+    }
+
+  for (k = 0, n = 0; n < 10 && t < t1; n++)
+    {
+      size_t j;
+
+      s = gsl_odeiv2_driver_apply_dense (d, &t, t1, y, tout + k, nout - k,
+                                         yout + 2 * k);
+
+      if (s != GSL_CONTINUE)
+        break;
+
+      for (j = k; j < nout; j++)
+        {
+          if (tout[j] > t && !gsl_isnan (yout[2 * j]))
+            break;
+        }
+
+      gsl_test (t >= t1 || j != nout,
+                "%s test_driver_dense event %d rows after event", T->name,
+                (int) n);
+
+      while (k < nout && tout[k] <= t)
+        {
+          emax = GSL_MAX_DBL (emax, fabs (yout[2 * k] - cos (tout[k])));
+          k++;
+        }
+    }
+
+  while (k < nout)
+    {
+      emax = GSL_MAX_DBL (emax, fabs (yout[2 * k] - cos (tout[k])));
+      k++;
+    }
+
+  gsl_test (s || t != t1 || n != 4, "%s test_driver_dense events",
+            T->name);
+  gsl_test (emax > err, "%s test_driver_dense events error %e", T->name,
+            emax);
+
+  /* output times out of order or outside the interval */
+
+  old = gsl_set_error_handler_off ();
+
+  gsl_odeiv2_driver_reset (d);
+  t = 0.0;
+  tout[1] = 5.0;
+  s = gsl_odeiv2_driver_apply_dense (d, &t, t1, y, tout, nout, yout);
+  gsl_test (s != GSL_EINVAL, "%s test_driver_dense unordered", T->name);
+
+  t = 1.0;
+  s = gsl_odeiv2_driver_apply_dense (d, &t, t1, y, tout + 2, 3, yout);
+  gsl_test (s != GSL_EINVAL, "%s test_driver_dense outside", T->name);
+
+  gsl_set_error_handler (old);
+
+  gsl_odeiv2_driver_free (d);
+}
+
+void
+test_dense_unsupported (void)
+{
+  /* Steppers without dense output return GSL_EUNIMPL */
+
+  gsl_odeiv2_system sys = { rhs_osc1, jac_osc1, 2, NULL };
+  gsl_odeiv2_step *s = gsl_odeiv2_step_alloc (gsl_odeiv2_step_rk4, 2);
+  gsl_error_handler_t *old = gsl_set_error_handler_off ();
+  double y[2] = { 1.0, 0.0 }, yerr[2];
+  int status;
+
+  gsl_odeiv2_step_apply (s, 0.0, 0.1, y, yerr, NULL, NULL, &sys);
+  status = gsl_odeiv2_step_interp (s, 0.05, y, &sys);
+
+  gsl_test (status != GSL_EUNIMPL, "rk4 test_dense_unsupported");
+
+  {
+    gsl_odeiv2_driver *d =
+      gsl_odeiv2_driver_alloc_y_new (&sys, gsl_odeiv2_step_rk4, 1e-3,
+                                     1e-8, 1e-8);
+    double t = 0.0, tout = 0.5, yout[2];
+
+    y[0] = 1.0;
+    y[1] = 0.0;
+    status = gsl_odeiv2_driver_apply_dense (d, &t, 1.0, y, &tout, 1, yout);
+
+    gsl_test (status != GSL_EUNIMPL, "rk4 test_dense_unsupported driver");
+
+    gsl_odeiv2_driver_free (d);
+  }
+
+  gsl_set_error_handler (old);
+  gsl_odeiv2_step_free (s);
+}
+
+void
+test_workspace (const gsl_odeiv2_step_type * T)
+{
+  /* Tests that a driver constructed in a caller buffer lies inside
+     it and gives the same results as an allocated driver */
+
+  const double t1 = 10.0;
+  gsl_odeiv2_system sys = { rhs_osc1, jac_osc1, 2, NULL };
+  const size_t size = gsl_odeiv2_driver_workspace_size (T, 2);
+  char *work = (char *) malloc (size);
+  gsl_odeiv2_driver *d =
+    gsl_odeiv2_driver_init_y_new (work, size, &sys, T, 1e-3, 1e-8, 1e-8);
+  gsl_odeiv2_driver *dref =
+    gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-3, 1e-8, 1e-8);
+  double t = 0.0, tref = 0.0;
+  double y[2] = { 1.0, 0.0 }, yref[2] = { 1.0, 0.0 };
+  int s, sref;
+
+  gsl_test (d == NULL || (char *) d != work, "%s test_workspace init",
+            T->name);
+  gsl_test ((char *) d->e->dydt_out + 2 * sizeof (double) > work + size,
+            "%s test_workspace layout", T->name);
+
+  s = gsl_odeiv2_driver_apply (d, &t, t1, y);
+  sref = gsl_odeiv2_driver_apply (dref, &tref, t1, yref);
+
+  gsl_test (s != sref, "%s test_workspace status", T->name);
+  gsl_test (d->n != dref->n, "%s test_workspace steps", T->name);
+  gsl_test_rel (y[0], yref[0], GSL_DBL_EPSILON, "%s test_workspace y0",
+                T->name);
+  gsl_test_rel (y[1], yref[1], GSL_DBL_EPSILON, "%s test_workspace y1",
+                T->name);
+  gsl_test_abs (y[0], cos (t1), 1e-6, "%s test_workspace solution",
+                T->name);
+
+  gsl_odeiv2_driver_free (dref);
+  free (work);
+}
+
+void
+test_workspace_errors (void)
+{
+  /* Steppers which need allocated state are rejected, as are buffers
+     that are too small */
+
+  gsl_odeiv2_system sys = { rhs_osc1, jac_osc1, 2, NULL };
+  const gsl_odeiv2_step_type *T = gsl_odeiv2_step_rkf45;
+  const size_t size = gsl_odeiv2_driver_workspace_size (T, 2);
+  char *work = (char *) malloc (size);
+  gsl_error_handler_t *old = gsl_set_error_handler_off ();
+  gsl_odeiv2_driver *d;
+
+  gsl_test (gsl_odeiv2_driver_workspace_size (gsl_odeiv2_step_msbdf, 2) != 0,
+            "msbdf test_workspace_errors size");
+
+  d = gsl_odeiv2_driver_init_y_new (work, size, &sys, gsl_odeiv2_step_msbdf,
+                                    1e-3, 1e-8, 1e-8);
+  gsl_test (d != NULL, "msbdf test_workspace_errors init");
+
+  d = gsl_odeiv2_driver_init_y_new (work, size - 1, &sys, T, 1e-3, 1e-8,
+                                    1e-8);
+  gsl_test (d != NULL, "%s test_workspace_errors too small", T->name);
+
+  gsl_test (gsl_odeiv2_step_init (work, 8, T, 2) != NULL,
+            "%s test_workspace_errors step too small", T->name);
+
+  gsl_set_error_handler (old);
+  free (work);
+}
+
+/* Harmonic oscillators y'' = -w^2 y for the ensemble driver, member k
+   having frequency w_k = 1 + 0.1 k */
+
+#define NENS 17
+
+int
+rhs_ensemble (size_t n, const double t[], const double y[], double f[],
+              void *params)
+{
+  size_t k;
+
+  (void) t;
+  (void) params;
+
+  for (k = 0; k < n; k++)
+    {
+      const double w = 1.0 + 0.1 * k;
+
+      f[k] = y[n + k];
+      f[n + k] = -w * w * y[k];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+rhs_oscillator (double t, const double y[], double f[], void *params)
+{
+  const double w = *(double *) params;
+
+  (void) t;
+
+  f[0] = y[1];
+  f[1] = -w * w * y[0];
+
+  return GSL_SUCCESS;
+}
+
+void
+test_ensemble (const gsl_odeiv2_step_type * T)
+{
+  /* Tests the ensemble driver against the exact solution and against
+     the driver applied to each member separately */
+
+  const double tol = 1e-10;
+  const double t1 = 3.0;
+  gsl_odeiv2_ensemble_system esys = { rhs_ensemble, 2, NULL };
+  gsl_odeiv2_ensemble *e =
+    gsl_odeiv2_ensemble_alloc (&esys, T, NENS, 1e-3, tol, tol);
+  double t[NENS], y[2 * NENS];
+  size_t k;
+  int s;
+
+  /* members start at different times with cos (w t0), -w sin (w t0) */
+
+  for (k = 0; k < NENS; k++)
+    {
+      const double w = 1.0 + 0.1 * k;
+
+      t[k] = 0.05 * k;
+      y[k] = cos (w * t[k]);
+      y[NENS + k] = -w * sin (w * t[k]);
+    }
+
+  s = gsl_odeiv2_ensemble_apply (e, t, t1, y);
+
+  gsl_test (s, "%s test_ensemble apply", T->name);
+
+  for (k = 0; k < NENS; k++)
+    {
+      double w = 1.0 + 0.1 * k;
+      gsl_odeiv2_system sys = { rhs_oscillator, NULL, 2, NULL };
+      gsl_odeiv2_driver *d;
+      double td = 0.05 * k;
+      double yd[2];
+
+      sys.params = &w;
+      d = gsl_odeiv2_driver_alloc_y_new (&sys, T, 1e-3, tol, tol);
+
+      yd[0] = cos (w * td);
+      yd[1] = -w * sin (w * td);
+
+      gsl_odeiv2_driver_apply (d, &td, t1, yd);
+
+      gsl_test (t[k] != t1, "%s test_ensemble t[%d]", T->name, (int) k);
+      gsl_test (e->status[k], "%s test_ensemble status[%d]", T->name,
+                (int) k);
+      gsl_test_abs (y[k], cos (w * t1), 1e-7,
+                    "%s test_ensemble exact y0[%d]", T->name, (int) k);
+      gsl_test_abs (y[NENS + k], -w * sin (w * t1), 1e-6,
+                    "%s test_ensemble exact y1[%d]", T->name, (int) k);
+      gsl_test_abs (y[k], yd[0], 1e-8,
+                    "%s test_ensemble driver y0[%d]", T->name, (int) k);
+      gsl_test_abs (y[NENS + k], yd[1], 1e-8,
+                    "%s test_ensemble driver y1[%d]", T->name, (int) k);
+
+      gsl_odeiv2_driver_free (d);
+    }
+
+  /* step limit is reported per member */
+
+  gsl_odeiv2_ensemble_reset (e);
+  gsl_odeiv2_ensemble_set_nmax (e, 2);
+
+  for (k = 0; k < NENS; k++)
+    {
+      t[k] = 0.0;
+      y[k] = 1.0;
+      y[NENS + k] = 0.0;
+    }
+
+  s = gsl_odeiv2_ensemble_apply (e, t, t1, y);
+
+  gsl_test (s != GSL_EMAXITER, "%s test_ensemble nmax", T->name);
+
+  for (k = 0; k < NENS; k++)
+    {
+      gsl_test (e->status[k] != GSL_EMAXITER || t[k] >= t1,
+                "%s test_ensemble nmax status[%d]", T->name, (int) k);
+    }
+
+  gsl_odeiv2_ensemble_free (e);
+}
+
 void
 benchmark_precision (void)
 {
@@ -2526,6 +3396,54 @@ main (void)
       test_stepfn2 (explicit_stepper[i].type);
     }
 
+  /* Banded and sparse Jacobians for implicit steppers */
+
+  test_jacobian_storage (gsl_odeiv2_step_rk1imp);
+  test_jacobian_storage (gsl_odeiv2_step_rk2imp);
+  test_jacobian_storage (gsl_odeiv2_step_rk4imp);
+  test_jacobian_storage (gsl_odeiv2_step_bsimp);
+  test_jacobian_storage (gsl_odeiv2_step_msbdf);
+  test_jacobian_setters ();
+
+  test_jacobian_gmres (gsl_odeiv2_step_rk2imp);
+  test_jacobian_gmres (gsl_odeiv2_step_bsimp);
+  test_jacobian_gmres (gsl_odeiv2_step_msbdf);
+
+  /* Ensemble driver */
+
+  test_ensemble (gsl_odeiv2_step_rkf45);
+  test_ensemble (gsl_odeiv2_step_rkck);
+  test_ensemble (gsl_odeiv2_step_rk8pd);
+
+  /* Dense output and events */
+
+  test_dense_output (gsl_odeiv2_step_rkf45, 1e-8);
+  test_dense_output (gsl_odeiv2_step_rkck, 1e-8);
+  test_dense_output (gsl_odeiv2_step_rk8pd, 1e-7);
+  test_dense_output (gsl_odeiv2_step_msadams, 1e-7);
+  test_dense_output (gsl_odeiv2_step_msbdf, 1e-6);
+
+  test_events (gsl_odeiv2_step_rkf45, 1e-8);
+  test_events (gsl_odeiv2_step_rkck, 1e-8);
+  test_events (gsl_odeiv2_step_rk8pd, 1e-7);
+  test_events (gsl_odeiv2_step_msadams, 1e-7);
+  test_events (gsl_odeiv2_step_msbdf, 1e-6);
+
+  test_driver_dense (gsl_odeiv2_step_rkf45, 1e-8);
+  test_driver_dense (gsl_odeiv2_step_rk8pd, 1e-7);
+  test_driver_dense (gsl_odeiv2_step_msadams, 1e-7);
+  test_driver_dense (gsl_odeiv2_step_msbdf, 1e-6);
+
+  test_dense_unsupported ();
+
+  test_workspace (gsl_odeiv2_step_rk2);
+  test_workspace (gsl_odeiv2_step_rk4);
+  test_workspace (gsl_odeiv2_step_rkf45);
+  test_workspace (gsl_odeiv2_step_rkck);
+  test_workspace (gsl_odeiv2_step_rk8pd);
+
+  test_workspace_errors ();
+
   /* Special tests */
 
   test_nonstiff_problems ();
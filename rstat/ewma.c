@@ -0,0 +1,331 @@
+/* rstat/ewma.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_nan.h>
+#include <gsl/gsl_rstat.h>
+
+/*
+ * Exponentially weighted running statistics. An observation of age t
+ * carries weight exp(-t/tau). The total weight W of the data is kept,
+ * so that when a point arrives dt after the previous one
+ *
+ *   W <- W exp(-dt/tau) + 1
+ *
+ * and the new point receives the normalized weight alpha = 1/W. Points
+ * with equal time stamps therefore receive equal weight, and for unit
+ * spacing alpha tends to 1 - exp(-1/tau) as W reaches its steady state.
+ *
+ * The mean and variance use the incremental formulas of
+ *
+ * [1] T. Finch, "Incremental calculation of weighted mean and
+ *     variance", University of Cambridge Computing Service, 2009
+ *
+ * and the quantile is tracked by the stochastic approximation of
+ *
+ * [2] L. Tierney, "A space-efficient recursive procedure for estimating
+ *     a quantile of an unknown distribution", SIAM J. Sci. Stat. Comput.,
+ *     4(4), 706-711, 1983
+ *
+ * with the decreasing gain 1/n replaced by the gain alpha.
+ */
+
+/* lower bound on the density estimate, relative to 1/h, limiting a
+   single quantile step to alpha * h / EWMA_MIN_DENSITY */
+#define EWMA_MIN_DENSITY         0.05
+
+static int ewma_check_time(const double t, const double t_last, const size_t n);
+static double ewma_weight(const double dt, const double tau, double *W);
+static void ewma_update(const double x, const double alpha,
+                        double *mean, double *var);
+
+gsl_rstat_ewma_workspace *
+gsl_rstat_ewma_alloc(const double tau)
+{
+  gsl_rstat_ewma_workspace *w;
+
+  if (tau <= 0.0)
+    {
+      GSL_ERROR_NULL ("tau must be positive", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_ewma_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->tau = tau;
+
+  gsl_rstat_ewma_reset(w);
+
+  return w;
+} /* gsl_rstat_ewma_alloc() */
+
+void
+gsl_rstat_ewma_free(gsl_rstat_ewma_workspace *w)
+{
+  free(w);
+} /* gsl_rstat_ewma_free() */
+
+int
+gsl_rstat_ewma_reset(gsl_rstat_ewma_workspace *w)
+{
+  w->t = 0.0;
+  w->W = 0.0;
+  w->mean = 0.0;
+  w->var = 0.0;
+  w->n = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_ewma_reset() */
+
+size_t
+gsl_rstat_ewma_n(const gsl_rstat_ewma_workspace *w)
+{
+  return w->n;
+} /* gsl_rstat_ewma_n() */
+
+/* add a point one unit of time after the previous one */
+int
+gsl_rstat_ewma_add(const double x, gsl_rstat_ewma_workspace *w)
+{
+  return gsl_rstat_ewma_add_t(w->t + 1.0, x, w);
+} /* gsl_rstat_ewma_add() */
+
+/* add a point observed at time t */
+int
+gsl_rstat_ewma_add_t(const double t, const double x, gsl_rstat_ewma_workspace *w)
+{
+  int status = ewma_check_time(t, w->t, w->n);
+
+  if (status)
+    return status;
+
+  if (gsl_isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  if (w->n == 0)
+    {
+      w->W = 1.0;
+      w->mean = x;
+      w->var = 0.0;
+    }
+  else
+    {
+      const double alpha = ewma_weight(t - w->t, w->tau, &(w->W));
+      ewma_update(x, alpha, &(w->mean), &(w->var));
+    }
+
+  w->t = t;
+  ++(w->n);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_ewma_add_t() */
+
+double
+gsl_rstat_ewma_mean(const gsl_rstat_ewma_workspace *w)
+{
+  if (w->n == 0)
+    return GSL_NAN;
+
+  return w->mean;
+} /* gsl_rstat_ewma_mean() */
+
+double
+gsl_rstat_ewma_variance(const gsl_rstat_ewma_workspace *w)
+{
+  if (w->n == 0)
+    return GSL_NAN;
+
+  return w->var;
+} /* gsl_rstat_ewma_variance() */
+
+double
+gsl_rstat_ewma_sd(const gsl_rstat_ewma_workspace *w)
+{
+  return sqrt(gsl_rstat_ewma_variance(w));
+} /* gsl_rstat_ewma_sd() */
+
+gsl_rstat_ewma_quantile_workspace *
+gsl_rstat_ewma_quantile_alloc(const double p, const double tau)
+{
+  gsl_rstat_ewma_quantile_workspace *w;
+
+  if (p < 0.0 || p > 1.0)
+    {
+      GSL_ERROR_NULL ("p must be in [0,1]", GSL_EDOM);
+    }
+  else if (tau <= 0.0)
+    {
+      GSL_ERROR_NULL ("tau must be positive", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_ewma_quantile_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->p = p;
+  w->tau = tau;
+
+  gsl_rstat_ewma_quantile_reset(w);
+
+  return w;
+} /* gsl_rstat_ewma_quantile_alloc() */
+
+void
+gsl_rstat_ewma_quantile_free(gsl_rstat_ewma_quantile_workspace *w)
+{
+  free(w);
+} /* gsl_rstat_ewma_quantile_free() */
+
+int
+gsl_rstat_ewma_quantile_reset(gsl_rstat_ewma_quantile_workspace *w)
+{
+  w->t = 0.0;
+  w->W = 0.0;
+  w->q = 0.0;
+  w->f = 0.0;
+  w->mean = 0.0;
+  w->var = 0.0;
+  w->n = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_ewma_quantile_reset() */
+
+int
+gsl_rstat_ewma_quantile_add(const double x, gsl_rstat_ewma_quantile_workspace *w)
+{
+  return gsl_rstat_ewma_quantile_add_t(w->t + 1.0, x, w);
+} /* gsl_rstat_ewma_quantile_add() */
+
+/*
+gsl_rstat_ewma_quantile_add_t()
+  Update the quantile estimate q with the point x observed at time t,
+
+q <- q + alpha * (p - I(x <= q)) / f
+
+where f is an exponentially weighted estimate of the density at q,
+computed with a box kernel of half-width h equal to the current
+exponentially weighted standard deviation. The density estimate only
+controls the rate of convergence; the fixed point of the iteration is
+the p-quantile of the weighted data regardless of the kernel width.
+*/
+
+int
+gsl_rstat_ewma_quantile_add_t(const double t, const double x,
+                              gsl_rstat_ewma_quantile_workspace *w)
+{
+  int status = ewma_check_time(t, w->t, w->n);
+
+  if (status)
+    return status;
+
+  if (gsl_isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  if (w->n == 0)
+    {
+      w->W = 1.0;
+      w->q = x;
+      w->f = 0.0;
+      w->mean = x;
+      w->var = 0.0;
+    }
+  else
+    {
+      const double alpha = ewma_weight(t - w->t, w->tau, &(w->W));
+      double h;
+
+      ewma_update(x, alpha, &(w->mean), &(w->var));
+
+      h = sqrt(w->var);
+      if (h == 0.0)
+        h = fabs(x - w->q);
+
+      if (h > 0.0)
+        {
+          const double fmin = EWMA_MIN_DENSITY / h;
+          double I = (x <= w->q) ? 1.0 : 0.0;
+          double f;
+
+          w->f = (1.0 - alpha) * w->f + alpha * (fabs(x - w->q) <= h) / (2.0 * h);
+          f = GSL_MAX(w->f, fmin);
+
+          w->q += alpha * (w->p - I) / f;
+        }
+    }
+
+  w->t = t;
+  ++(w->n);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_ewma_quantile_add_t() */
+
+double
+gsl_rstat_ewma_quantile_get(const gsl_rstat_ewma_quantile_workspace *w)
+{
+  if (w->n == 0)
+    return GSL_NAN;
+
+  return w->q;
+} /* gsl_rstat_ewma_quantile_get() */
+
+static int
+ewma_check_time(const double t, const double t_last, const size_t n)
+{
+  if (n > 0 && !(t >= t_last))
+    {
+      GSL_ERROR ("time stamps must be non-decreasing", GSL_EDOM);
+    }
+
+  return GSL_SUCCESS;
+} /* ewma_check_time() */
+
+/* decay the total weight W over the interval dt, add a unit weight for
+   the new point and return its normalized weight */
+static double
+ewma_weight(const double dt, const double tau, double *W)
+{
+  *W = *W * exp(-dt / tau) + 1.0;
+
+  return 1.0 / *W;
+} /* ewma_weight() */
+
+/* update exponentially weighted mean and variance with new point x of
+   weight alpha */
+static void
+ewma_update(const double x, const double alpha, double *mean, double *var)
+{
+  const double delta = x - *mean;
+  const double incr = alpha * delta;
+
+  *mean += incr;
+  *var = (1.0 - alpha) * (*var + delta * incr);
+} /* ewma_update() */
@@ -21,6 +21,7 @@
 #define __GSL_RSTAT_H__
 
 #include <stdlib.h>
+#include <stdio.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -48,7 +49,43 @@ gsl_rstat_quantile_workspace *gsl_rstat_quantile_alloc(const double p);
 void gsl_rstat_quantile_free(gsl_rstat_quantile_workspace *w);
 int gsl_rstat_quantile_reset(gsl_rstat_quantile_workspace *w);
 int gsl_rstat_quantile_add(const double x, gsl_rstat_quantile_workspace *w);
+int gsl_rstat_quantile_add_array(const double x[], const size_t stride,
+                                 const size_t n, gsl_rstat_quantile_workspace *w);
 double gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w);
+int gsl_rstat_quantile_merge(gsl_rstat_quantile_workspace *dest,
+                             const gsl_rstat_quantile_workspace *src);
+int gsl_rstat_quantile_fwrite(FILE *stream, const gsl_rstat_quantile_workspace *w);
+int gsl_rstat_quantile_fread(FILE *stream, gsl_rstat_quantile_workspace *w);
+
+typedef struct
+{
+  double compression;   /* compression parameter delta */
+  size_t size;          /* maximum number of centroids */
+  size_t ncentroids;    /* current number of centroids */
+  double *mean;         /* centroid means, size size */
+  double *weight;       /* centroid weights, size size */
+  size_t bufsize;       /* size of input buffer */
+  size_t nbuf;          /* number of buffered points */
+  double *buf_mean;     /* buffered points, size bufsize */
+  double *buf_weight;   /* buffered weights, size bufsize */
+  double *work_mean;    /* workspace, size size + bufsize */
+  double *work_weight;  /* workspace, size size + bufsize */
+  double total_weight;  /* total weight of centroids and buffer */
+  double min;           /* minimum value added */
+  double max;           /* maximum value added */
+  size_t n;             /* number of data added */
+} gsl_rstat_tdigest_workspace;
+
+gsl_rstat_tdigest_workspace *gsl_rstat_tdigest_alloc(const double compression);
+void gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w);
+size_t gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                            const gsl_rstat_tdigest_workspace *src);
+double gsl_rstat_tdigest_quantile(gsl_rstat_tdigest_workspace *w, const double p);
+int gsl_rstat_tdigest_fwrite(FILE *stream, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w);
 
 typedef struct
 {
@@ -66,6 +103,11 @@ gsl_rstat_workspace *gsl_rstat_alloc(void);
 void gsl_rstat_free(gsl_rstat_workspace *w);
 size_t gsl_rstat_n(const gsl_rstat_workspace *w);
 int gsl_rstat_add(const double x, gsl_rstat_workspace *w);
+int gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                        gsl_rstat_workspace *w);
+int gsl_rstat_merge(gsl_rstat_workspace *dest, const gsl_rstat_workspace *src);
+int gsl_rstat_fwrite(FILE *stream, const gsl_rstat_workspace *w);
+int gsl_rstat_fread(FILE *stream, gsl_rstat_workspace *w);
 double gsl_rstat_min(const gsl_rstat_workspace *w);
 double gsl_rstat_max(const gsl_rstat_workspace *w);
 double gsl_rstat_mean(const gsl_rstat_workspace *w);
@@ -78,6 +120,47 @@ double gsl_rstat_skew(const gsl_rstat_workspace *w);
 double gsl_rstat_kurtosis(const gsl_rstat_workspace *w);
 int gsl_rstat_reset(gsl_rstat_workspace *w);
 
+typedef struct
+{
+  double tau;      /* decay time constant */
+  double t;        /* time of last data point */
+  double W;        /* total decayed weight of data */
+  double mean;     /* exponentially weighted mean */
+  double var;      /* exponentially weighted variance */
+  size_t n;        /* number of data points added */
+} gsl_rstat_ewma_workspace;
+
+gsl_rstat_ewma_workspace *gsl_rstat_ewma_alloc(const double tau);
+void gsl_rstat_ewma_free(gsl_rstat_ewma_workspace *w);
+int gsl_rstat_ewma_reset(gsl_rstat_ewma_workspace *w);
+size_t gsl_rstat_ewma_n(const gsl_rstat_ewma_workspace *w);
+int gsl_rstat_ewma_add(const double x, gsl_rstat_ewma_workspace *w);
+int gsl_rstat_ewma_add_t(const double t, const double x, gsl_rstat_ewma_workspace *w);
+double gsl_rstat_ewma_mean(const gsl_rstat_ewma_workspace *w);
+double gsl_rstat_ewma_variance(const gsl_rstat_ewma_workspace *w);
+double gsl_rstat_ewma_sd(const gsl_rstat_ewma_workspace *w);
+
+typedef struct
+{
+  double p;        /* p-quantile */
+  double tau;      /* decay time constant */
+  double t;        /* time of last data point */
+  double W;        /* total decayed weight of data */
+  double q;        /* current quantile estimate */
+  double f;        /* density estimate at q */
+  double mean;     /* exponentially weighted mean */
+  double var;      /* exponentially weighted variance */
+  size_t n;        /* number of data points added */
+} gsl_rstat_ewma_quantile_workspace;
+
+gsl_rstat_ewma_quantile_workspace *gsl_rstat_ewma_quantile_alloc(const double p, const double tau);
+void gsl_rstat_ewma_quantile_free(gsl_rstat_ewma_quantile_workspace *w);
+int gsl_rstat_ewma_quantile_reset(gsl_rstat_ewma_quantile_workspace *w);
+int gsl_rstat_ewma_quantile_add(const double x, gsl_rstat_ewma_quantile_workspace *w);
+int gsl_rstat_ewma_quantile_add_t(const double t, const double x,
+                                  gsl_rstat_ewma_quantile_workspace *w);
+double gsl_rstat_ewma_quantile_get(const gsl_rstat_ewma_quantile_workspace *w);
+
 __END_DECLS
 
 #endif /* __GSL_RSTAT_H__ */
@@ -19,6 +19,7 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_sort.h>
@@ -33,6 +34,7 @@
  *     observations", Communications of the ACM, October 1985
  */
 
+static int adjust_marker(const int i, gsl_rstat_quantile_workspace *w);
 static double calc_psq(const double qp1, const double q, const double qm1,
                        const double d, const double np1, const double n, const double nm1);
 
@@ -146,39 +148,96 @@ gsl_rstat_quantile_add(const double x, gsl_rstat_quantile_workspace *w)
 
       /* step B3: update heights */
       for (i = 1; i <= 3; ++i)
+        adjust_marker(i, w);
+    }
+
+  ++(w->n);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_quantile_add() */
+
+/*
+gsl_rstat_quantile_add_array()
+  Add n points to the estimator. Once the markers are initialized, the
+marker positions are advanced by the number of points below each inner
+marker height, counted against the heights at the start of the call,
+and the desired positions by n increments (steps B1 and B2 for all
+points at once). Step B3 is then repeated until no marker can move
+closer to its desired position. Since the marker positions follow the
+data, the markers only move by the random fluctuation of the counts,
+so the cost is dominated by the counting loop. The estimate differs
+slightly from that of n calls to gsl_rstat_quantile_add().
+*/
+
+int
+gsl_rstat_quantile_add_array(const double x[], const size_t stride,
+                             const size_t n, gsl_rstat_quantile_workspace *w)
+{
+  size_t j = 0;
+
+  /* the first points initialize the markers */
+  while (j < n && w->n <= 5)
+    {
+      int status = gsl_rstat_quantile_add(x[j * stride], w);
+      if (status)
+        return status;
+
+      ++j;
+    }
+
+  if (j < n)
+    {
+      const size_t nb = n - j;
+      const double q1 = w->q[1], q2 = w->q[2], q3 = w->q[3];
+      double qmin = w->q[0], qmax = w->q[4];
+      size_t c1 = 0, c2 = 0, c3 = 0;
+      int i, moved;
+
+      /* steps B1 and B2(a) */
+      for (; j < n; ++j)
         {
-          double ni = (double) w->npos[i];
-          double d = w->np[i] - ni;
+          const double xj = x[j * stride];
 
-          if ((d >= 1.0 && (w->npos[i + 1] - w->npos[i] > 1)) ||
-              (d <= -1.0 && (w->npos[i - 1] - w->npos[i] < -1)))
+          if (gsl_isnan(xj))
             {
-              int dsign = (d > 0.0) ? 1 : -1;
-              double qp1 = w->q[i + 1];
-              double qi = w->q[i];
-              double qm1 = w->q[i - 1];
-              double np1 = (double) w->npos[i + 1];
-              double nm1 = (double) w->npos[i - 1];
-              double qp = calc_psq(qp1, qi, qm1, (double) dsign,
-                                   np1, ni, nm1);
-
-              if (qm1 < qp && qp < qp1)
-                w->q[i] = qp;
-              else
-                {
-                  /* use linear formula */
-                  w->q[i] += dsign * (w->q[i + dsign] - qi) / ((double) w->npos[i + dsign] - ni);
-                }
-
-              w->npos[i] += dsign;
+              GSL_ERROR ("invalid input argument x", GSL_EINVAL);
             }
+
+          c1 += (xj < q1);
+          c2 += (xj < q2);
+          c3 += (xj < q3);
+
+          if (xj < qmin)
+            qmin = xj;
+          if (xj > qmax)
+            qmax = xj;
         }
-    }
 
-  ++(w->n);
+      w->q[0] = qmin;
+      w->q[4] = qmax;
+      w->npos[1] += (int) c1;
+      w->npos[2] += (int) c2;
+      w->npos[3] += (int) c3;
+      w->npos[4] += (int) nb;
+
+      /* step B2(b) */
+      for (i = 0; i < 5; ++i)
+        w->np[i] += (double) nb * w->dnp[i];
+
+      /* step B3 */
+      do
+        {
+          moved = 0;
+          for (i = 1; i <= 3; ++i)
+            moved |= adjust_marker(i, w);
+        }
+      while (moved);
+
+      w->n += nb;
+    }
 
   return GSL_SUCCESS;
-} /* gsl_rstat_quantile_add() */
+} /* gsl_rstat_quantile_add_array() */
 
 double
 gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w)
@@ -195,6 +254,162 @@ gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w)
     }
 } /* gsl_rstat_quantile_get() */
 
+/*
+gsl_rstat_quantile_merge()
+  Merge the quantile estimate of src into dest. While either workspace
+holds five or fewer points, those points are stored exactly and are
+simply added to the other estimator, so the result is the same as if
+all data had been added to a single workspace. Otherwise the P^2
+markers are combined: the outer markers take the overall minimum and
+maximum, the marker positions are summed, and the inner heights are
+averaged with weights given by the number of points in each set. This
+is an approximation, which is accurate when both sets come from the
+same distribution.
+*/
+
+int
+gsl_rstat_quantile_merge(gsl_rstat_quantile_workspace *dest,
+                         const gsl_rstat_quantile_workspace *src)
+{
+  if (dest->p != src->p)
+    {
+      GSL_ERROR ("workspaces estimate different quantiles", GSL_EINVAL);
+    }
+  else if (src->n <= 5)
+    {
+      size_t i;
+
+      for (i = 0; i < src->n; ++i)
+        {
+          int status = gsl_rstat_quantile_add(src->q[i], dest);
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+  else if (dest->n <= 5)
+    {
+      const size_t n = dest->n;
+      double q[5];
+      size_t i;
+
+      for (i = 0; i < n; ++i)
+        q[i] = dest->q[i];
+
+      *dest = *src;
+
+      for (i = 0; i < n; ++i)
+        {
+          int status = gsl_rstat_quantile_add(q[i], dest);
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const double na = (double) dest->n;
+      const double nb = (double) src->n;
+      const size_t n = dest->n + src->n;
+      gsl_rstat_quantile_workspace init;
+      size_t i;
+
+      for (i = 1; i <= 3; ++i)
+        {
+          dest->q[i] = (na * dest->q[i] + nb * src->q[i]) / (na + nb);
+          dest->npos[i] += src->npos[i];
+        }
+
+      dest->q[0] = GSL_MIN(dest->q[0], src->q[0]);
+      dest->q[4] = GSL_MAX(dest->q[4], src->q[4]);
+      dest->npos[0] = 1;
+      dest->npos[4] = (int) n;
+
+      /* desired positions after n points, as computed by n - 5
+         applications of step B2(b) to the initial values */
+      init.p = dest->p;
+      gsl_rstat_quantile_reset(&init);
+
+      for (i = 0; i < 5; ++i)
+        dest->np[i] = init.np[i] + (double) (n - 5) * dest->dnp[i];
+
+      dest->n = n;
+
+      return GSL_SUCCESS;
+    }
+} /* gsl_rstat_quantile_merge() */
+
+int
+gsl_rstat_quantile_fwrite(FILE *stream, const gsl_rstat_quantile_workspace *w)
+{
+  if (fwrite(&(w->p), sizeof(double), 1, stream) != 1 ||
+      fwrite(w->q, sizeof(double), 5, stream) != 5 ||
+      fwrite(w->npos, sizeof(int), 5, stream) != 5 ||
+      fwrite(w->np, sizeof(double), 5, stream) != 5 ||
+      fwrite(w->dnp, sizeof(double), 5, stream) != 5 ||
+      fwrite(&(w->n), sizeof(size_t), 1, stream) != 1)
+    {
+      GSL_ERROR ("fwrite failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_quantile_fwrite() */
+
+int
+gsl_rstat_quantile_fread(FILE *stream, gsl_rstat_quantile_workspace *w)
+{
+  if (fread(&(w->p), sizeof(double), 1, stream) != 1 ||
+      fread(w->q, sizeof(double), 5, stream) != 5 ||
+      fread(w->npos, sizeof(int), 5, stream) != 5 ||
+      fread(w->np, sizeof(double), 5, stream) != 5 ||
+      fread(w->dnp, sizeof(double), 5, stream) != 5 ||
+      fread(&(w->n), sizeof(size_t), 1, stream) != 1)
+    {
+      GSL_ERROR ("fread failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_quantile_fread() */
+
+/* step B3 for inner marker i: move it by one position towards its
+desired position if it is at least one away and the neighbouring
+marker leaves room, and return 1 if it was moved */
+static int
+adjust_marker(const int i, gsl_rstat_quantile_workspace *w)
+{
+  double ni = (double) w->npos[i];
+  double d = w->np[i] - ni;
+
+  if ((d >= 1.0 && (w->npos[i + 1] - w->npos[i] > 1)) ||
+      (d <= -1.0 && (w->npos[i - 1] - w->npos[i] < -1)))
+    {
+      int dsign = (d > 0.0) ? 1 : -1;
+      double qp1 = w->q[i + 1];
+      double qi = w->q[i];
+      double qm1 = w->q[i - 1];
+      double np1 = (double) w->npos[i + 1];
+      double nm1 = (double) w->npos[i - 1];
+      double qp = calc_psq(qp1, qi, qm1, (double) dsign,
+                           np1, ni, nm1);
+
+      if (qm1 < qp && qp < qp1)
+        w->q[i] = qp;
+      else
+        {
+          /* use linear formula */
+          w->q[i] += dsign * (w->q[i + dsign] - qi) / ((double) w->npos[i + dsign] - ni);
+        }
+
+      w->npos[i] += dsign;
+
+      return 1;
+    }
+
+  return 0;
+} /* adjust_marker() */
+
 static double
 calc_psq(const double qp1, const double q, const double qm1,
          const double d, const double np1, const double n, const double nm1)
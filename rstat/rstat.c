@@ -19,10 +19,17 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <stdio.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_rstat.h>
+#include "moments.h"
+
+/* number of samples processed per block in gsl_rstat_add_array() */
+#define RSTAT_BLOCK_SIZE     256
+
+static void rstat_combine(const moment_accum *b, gsl_rstat_workspace *w);
 
 gsl_rstat_workspace *
 gsl_rstat_alloc(void)
@@ -102,6 +109,153 @@ gsl_rstat_add(const double x, gsl_rstat_workspace *w)
   return GSL_SUCCESS;
 } /* gsl_rstat_add() */
 
+/* add an array of data points to the running totals. The moments of
+each block are computed directly and then combined with the running
+totals, which avoids a division per sample and allows the inner loops
+to be vectorized. The P^2 median markers are advanced once per block
+as well (see gsl_rstat_quantile_add_array()), so the median estimate
+differs slightly from that of repeated gsl_rstat_add() calls */
+int
+gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                    gsl_rstat_workspace *w)
+{
+  double buf[RSTAT_BLOCK_SIZE];
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const size_t nb = GSL_MIN(RSTAT_BLOCK_SIZE, n - i);
+      const double *xb = x + i * stride;
+      double sum = 0.0;
+      double minb = xb[0], maxb = xb[0];
+      moment_accum b;
+      size_t j;
+
+      for (j = 0; j < nb; ++j)
+        {
+          double xj = xb[j * stride];
+
+          if (gsl_isnan(xj))
+            {
+              GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+            }
+
+          buf[j] = xj;
+          sum += xj;
+
+          if (xj < minb)
+            minb = xj;
+          if (xj > maxb)
+            maxb = xj;
+        }
+
+      moments_init(&b);
+      b.W = (double) nb;
+      b.mean = sum / (double) nb;
+
+      for (j = 0; j < nb; ++j)
+        {
+          double d = buf[j] - b.mean;
+          double d2 = d * d;
+
+          b.M2 += d2;
+          b.M3 += d2 * d;
+          b.M4 += d2 * d2;
+        }
+
+      /* update min and max */
+      if (w->n == 0)
+        {
+          w->min = minb;
+          w->max = maxb;
+        }
+      else
+        {
+          if (minb < w->min)
+            w->min = minb;
+          if (maxb > w->max)
+            w->max = maxb;
+        }
+
+      rstat_combine(&b, w);
+
+      /* update median */
+      gsl_rstat_quantile_add_array(buf, 1, nb, w->median_workspace_p);
+
+      i += nb;
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_add_array() */
+
+/* merge the statistics of src into dest, so that dest describes the
+union of both datasets */
+int
+gsl_rstat_merge(gsl_rstat_workspace *dest, const gsl_rstat_workspace *src)
+{
+  moment_accum b;
+
+  if (src->n == 0)
+    return GSL_SUCCESS;
+
+  if (dest->n == 0)
+    {
+      dest->min = src->min;
+      dest->max = src->max;
+    }
+  else
+    {
+      if (src->min < dest->min)
+        dest->min = src->min;
+      if (src->max > dest->max)
+        dest->max = src->max;
+    }
+
+  b.W = (double) src->n;
+  b.mean = src->mean;
+  b.M2 = src->M2;
+  b.M3 = src->M3;
+  b.M4 = src->M4;
+  rstat_combine(&b, dest);
+
+  return gsl_rstat_quantile_merge(dest->median_workspace_p, src->median_workspace_p);
+} /* gsl_rstat_merge() */
+
+int
+gsl_rstat_fwrite(FILE *stream, const gsl_rstat_workspace *w)
+{
+  const double state[6] = { w->min, w->max, w->mean, w->M2, w->M3, w->M4 };
+
+  if (fwrite(state, sizeof(double), 6, stream) != 6 ||
+      fwrite(&(w->n), sizeof(size_t), 1, stream) != 1)
+    {
+      GSL_ERROR ("fwrite failed", GSL_EFAILED);
+    }
+
+  return gsl_rstat_quantile_fwrite(stream, w->median_workspace_p);
+} /* gsl_rstat_fwrite() */
+
+int
+gsl_rstat_fread(FILE *stream, gsl_rstat_workspace *w)
+{
+  double state[6];
+
+  if (fread(state, sizeof(double), 6, stream) != 6 ||
+      fread(&(w->n), sizeof(size_t), 1, stream) != 1)
+    {
+      GSL_ERROR ("fread failed", GSL_EFAILED);
+    }
+
+  w->min = state[0];
+  w->max = state[1];
+  w->mean = state[2];
+  w->M2 = state[3];
+  w->M3 = state[4];
+  w->M4 = state[5];
+
+  return gsl_rstat_quantile_fread(stream, w->median_workspace_p);
+} /* gsl_rstat_fread() */
+
 double
 gsl_rstat_min(const gsl_rstat_workspace *w)
 {
@@ -219,3 +373,25 @@ gsl_rstat_reset(gsl_rstat_workspace *w)
 
   return status;
 } /* gsl_rstat_reset() */
+
+/* combine the moments b of a second set of samples with the running
+totals in w */
+static void
+rstat_combine(const moment_accum *b, gsl_rstat_workspace *w)
+{
+  moment_accum a;
+
+  a.W = (double) w->n;
+  a.mean = w->mean;
+  a.M2 = w->M2;
+  a.M3 = w->M3;
+  a.M4 = w->M4;
+
+  moments_combine(&a, b);
+
+  w->mean = a.mean;
+  w->M2 = a.M2;
+  w->M3 = a.M3;
+  w->M4 = a.M4;
+  w->n += (size_t) b->W;
+} /* rstat_combine() */
@@ -0,0 +1,433 @@
+/* rstat/tdigest.c
+ *
+ * Copyright (C) 2026 agent
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_nan.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rstat.h>
+
+/*
+ * Streaming quantile estimation with the merging t-digest of
+ *
+ * [1] T. Dunning and O. Ertl, "Computing extremely accurate quantiles
+ *     using t-digests", arXiv:1902.04023, 2019
+ *
+ * The data are summarized by a sorted list of centroids (mean, weight).
+ * New points are collected in a buffer; when the buffer is full it is
+ * sorted and merged with the centroids in a single pass, combining
+ * neighbors as long as each centroid spans at most one unit of the
+ * scale function
+ *
+ *   k(q) = delta / (2 pi) * asin(2q - 1)
+ *
+ * which keeps centroids small near q = 0 and q = 1, so that tail
+ * quantiles are estimated accurately. Since any two neighboring
+ * centroids together span more than one unit of k, and k ranges over
+ * an interval of length delta/2, the number of centroids is bounded
+ * by delta + 3.
+ */
+
+/* size of the input buffer relative to the maximum number of centroids */
+#define TDIGEST_BUFFER_FACTOR    5
+
+static int tdigest_flush(gsl_rstat_tdigest_workspace *w);
+static int tdigest_insert(const double x, const double weight,
+                          gsl_rstat_tdigest_workspace *w);
+static double tdigest_qlimit(const double q, const double delta);
+
+gsl_rstat_tdigest_workspace *
+gsl_rstat_tdigest_alloc(const double compression)
+{
+  gsl_rstat_tdigest_workspace *w;
+
+  if (compression < 1.0)
+    {
+      GSL_ERROR_NULL ("compression must be at least 1", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_tdigest_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->compression = compression;
+  w->size = (size_t) ceil(compression) + 3;
+  w->bufsize = TDIGEST_BUFFER_FACTOR * w->size;
+
+  w->mean = malloc(w->size * sizeof(double));
+  w->weight = malloc(w->size * sizeof(double));
+  w->buf_mean = malloc(w->bufsize * sizeof(double));
+  w->buf_weight = malloc(w->bufsize * sizeof(double));
+  w->work_mean = malloc((w->size + w->bufsize) * sizeof(double));
+  w->work_weight = malloc((w->size + w->bufsize) * sizeof(double));
+
+  if (w->mean == 0 || w->weight == 0 || w->buf_mean == 0 ||
+      w->buf_weight == 0 || w->work_mean == 0 || w->work_weight == 0)
+    {
+      gsl_rstat_tdigest_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for centroids", GSL_ENOMEM);
+    }
+
+  gsl_rstat_tdigest_reset(w);
+
+  return w;
+} /* gsl_rstat_tdigest_alloc() */
+
+void
+gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w)
+{
+  if (w->mean)
+    free(w->mean);
+
+  if (w->weight)
+    free(w->weight);
+
+  if (w->buf_mean)
+    free(w->buf_mean);
+
+  if (w->buf_weight)
+    free(w->buf_weight);
+
+  if (w->work_mean)
+    free(w->work_mean);
+
+  if (w->work_weight)
+    free(w->work_weight);
+
+  free(w);
+} /* gsl_rstat_tdigest_free() */
+
+int
+gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w)
+{
+  w->ncentroids = 0;
+  w->nbuf = 0;
+  w->total_weight = 0.0;
+  w->min = 0.0;
+  w->max = 0.0;
+  w->n = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_reset() */
+
+size_t
+gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w)
+{
+  return w->n;
+} /* gsl_rstat_tdigest_n() */
+
+int
+gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w)
+{
+  int status;
+
+  if (gsl_isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  status = tdigest_insert(x, 1.0, w);
+  if (status)
+    return status;
+
+  ++(w->n);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_add() */
+
+/* add the data summarized by src to dest */
+int
+gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                        const gsl_rstat_tdigest_workspace *src)
+{
+  size_t i;
+
+  for (i = 0; i < src->ncentroids; ++i)
+    {
+      int status = tdigest_insert(src->mean[i], src->weight[i], dest);
+      if (status)
+        return status;
+    }
+
+  for (i = 0; i < src->nbuf; ++i)
+    {
+      int status = tdigest_insert(src->buf_mean[i], src->buf_weight[i], dest);
+      if (status)
+        return status;
+    }
+
+  /* the extremes are not necessarily centroids */
+  if (src->n > 0)
+    {
+      if (src->min < dest->min)
+        dest->min = src->min;
+      if (src->max > dest->max)
+        dest->max = src->max;
+    }
+
+  dest->n += src->n;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_merge() */
+
+/*
+gsl_rstat_tdigest_quantile()
+  Estimate the p-quantile. Each centroid is taken to represent the
+point at the center of its weight, and the quantile is found by linear
+interpolation between neighboring centroids. Below the first centroid
+and above the last one, the interpolation is to the observed minimum
+and maximum.
+*/
+
+double
+gsl_rstat_tdigest_quantile(gsl_rstat_tdigest_workspace *w, const double p)
+{
+  double t, cum, center_prev, mean_prev;
+  size_t i;
+
+  if (w->n == 0)
+    return GSL_NAN;
+
+  tdigest_flush(w);
+
+  if (p <= 0.0)
+    return w->min;
+  else if (p >= 1.0)
+    return w->max;
+
+  t = p * w->total_weight;
+
+  /* center of first centroid */
+  center_prev = 0.5 * w->weight[0];
+  mean_prev = w->mean[0];
+
+  if (t < center_prev)
+    return w->min + (mean_prev - w->min) * (t / center_prev);
+
+  cum = w->weight[0];
+
+  for (i = 1; i < w->ncentroids; ++i)
+    {
+      const double center = cum + 0.5 * w->weight[i];
+
+      if (t <= center)
+        {
+          const double frac = (t - center_prev) / (center - center_prev);
+          return mean_prev + frac * (w->mean[i] - mean_prev);
+        }
+
+      center_prev = center;
+      mean_prev = w->mean[i];
+      cum += w->weight[i];
+    }
+
+  /* t lies beyond the center of the last centroid */
+  if (w->total_weight > center_prev)
+    {
+      const double frac = (t - center_prev) / (w->total_weight - center_prev);
+      return mean_prev + frac * (w->max - mean_prev);
+    }
+  else
+    return mean_prev;
+} /* gsl_rstat_tdigest_quantile() */
+
+int
+gsl_rstat_tdigest_fwrite(FILE *stream, gsl_rstat_tdigest_workspace *w)
+{
+  double state[4];
+
+  tdigest_flush(w);
+
+  state[0] = w->compression;
+  state[1] = w->total_weight;
+  state[2] = w->min;
+  state[3] = w->max;
+
+  if (fwrite(state, sizeof(double), 4, stream) != 4 ||
+      fwrite(&(w->n), sizeof(size_t), 1, stream) != 1 ||
+      fwrite(&(w->ncentroids), sizeof(size_t), 1, stream) != 1 ||
+      fwrite(w->mean, sizeof(double), w->ncentroids, stream) != w->ncentroids ||
+      fwrite(w->weight, sizeof(double), w->ncentroids, stream) != w->ncentroids)
+    {
+      GSL_ERROR ("fwrite failed", GSL_EFAILED);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_fwrite() */
+
+int
+gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w)
+{
+  double state[4];
+  size_t n, nc;
+
+  if (fread(state, sizeof(double), 4, stream) != 4 ||
+      fread(&n, sizeof(size_t), 1, stream) != 1 ||
+      fread(&nc, sizeof(size_t), 1, stream) != 1)
+    {
+      GSL_ERROR ("fread failed", GSL_EFAILED);
+    }
+
+  if (state[0] != w->compression)
+    {
+      GSL_ERROR ("workspace compression does not match file", GSL_EBADLEN);
+    }
+  else if (nc > w->size)
+    {
+      GSL_ERROR ("number of centroids exceeds workspace size", GSL_EBADLEN);
+    }
+
+  if (fread(w->mean, sizeof(double), nc, stream) != nc ||
+      fread(w->weight, sizeof(double), nc, stream) != nc)
+    {
+      GSL_ERROR ("fread failed", GSL_EFAILED);
+    }
+
+  w->total_weight = state[1];
+  w->min = state[2];
+  w->max = state[3];
+  w->n = n;
+  w->ncentroids = nc;
+  w->nbuf = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_fread() */
+
+/* add a point with the given weight to the buffer, flushing it if full */
+static int
+tdigest_insert(const double x, const double weight,
+               gsl_rstat_tdigest_workspace *w)
+{
+  if (w->nbuf == w->bufsize)
+    {
+      int status = tdigest_flush(w);
+      if (status)
+        return status;
+    }
+
+  if (w->n == 0 && w->nbuf == 0 && w->ncentroids == 0)
+    {
+      w->min = x;
+      w->max = x;
+    }
+  else
+    {
+      if (x < w->min)
+        w->min = x;
+      if (x > w->max)
+        w->max = x;
+    }
+
+  w->buf_mean[w->nbuf] = x;
+  w->buf_weight[w->nbuf] = weight;
+  ++(w->nbuf);
+
+  w->total_weight += weight;
+
+  return GSL_SUCCESS;
+} /* tdigest_insert() */
+
+/* merge the buffered points into the centroids */
+static int
+tdigest_flush(gsl_rstat_tdigest_workspace *w)
+{
+  const double W = w->total_weight;
+  size_t i = 0, j = 0, k = 0, m;
+  double wsofar, wlimit, cur_mean, cur_weight;
+
+  if (w->nbuf == 0)
+    return GSL_SUCCESS;
+
+  gsl_sort2(w->buf_mean, 1, w->buf_weight, 1, w->nbuf);
+
+  /* merge the sorted centroids and buffer into the work arrays */
+  while (i < w->ncentroids || j < w->nbuf)
+    {
+      if (j == w->nbuf || (i < w->ncentroids && w->mean[i] <= w->buf_mean[j]))
+        {
+          w->work_mean[k] = w->mean[i];
+          w->work_weight[k++] = w->weight[i++];
+        }
+      else
+        {
+          w->work_mean[k] = w->buf_mean[j];
+          w->work_weight[k++] = w->buf_weight[j++];
+        }
+    }
+
+  m = k;
+
+  /* compress adjacent points into centroids */
+  cur_mean = w->work_mean[0];
+  cur_weight = w->work_weight[0];
+  wsofar = 0.0;
+  wlimit = W * tdigest_qlimit(0.0, w->compression);
+  k = 0;
+
+  for (i = 1; i < m; ++i)
+    {
+      const double proposed = cur_weight + w->work_weight[i];
+
+      /* the bound on the number of centroids holds in exact arithmetic;
+         the last slot absorbs the remaining points should rounding
+         ever exceed it, so that k < w->size */
+      if (wsofar + proposed <= wlimit || k == w->size - 1)
+        {
+          cur_weight = proposed;
+          cur_mean += (w->work_mean[i] - cur_mean) * (w->work_weight[i] / cur_weight);
+        }
+      else
+        {
+          w->mean[k] = cur_mean;
+          w->weight[k++] = cur_weight;
+          wsofar += cur_weight;
+          wlimit = W * tdigest_qlimit(wsofar / W, w->compression);
+
+          cur_mean = w->work_mean[i];
+          cur_weight = w->work_weight[i];
+        }
+    }
+
+  w->mean[k] = cur_mean;
+  w->weight[k++] = cur_weight;
+
+  w->ncentroids = k;
+  w->nbuf = 0;
+
+  return GSL_SUCCESS;
+} /* tdigest_flush() */
+
+/* return q' = k^{-1}(k(q) + 1), the largest quantile which a centroid
+   starting at q may reach */
+static double
+tdigest_qlimit(const double q, const double delta)
+{
+  const double z = asin(2.0 * q - 1.0) + 2.0 * M_PI / delta;
+
+  if (z >= M_PI_2)
+    return 1.0;
+  else
+    return 0.5 * (sin(z) + 1.0);
+} /* tdigest_qlimit() */
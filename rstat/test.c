@@ -28,6 +28,7 @@
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include <gsl/gsl_cdf.h>
 #include <gsl/gsl_ieee_utils.h>
 
 int
@@ -114,6 +115,61 @@ test_basic(const size_t n, const double data[], const double tol, const char * d
   gsl_rstat_free(rstat_workspace_p);
 }
 
+/* split data into two parts, accumulate them separately (one with
+   gsl_rstat_add_array) and merge */
+void
+test_merge(const size_t n, const double data[], const double tol, const char * desc)
+{
+  const size_t n1 = n / 3;
+  gsl_rstat_workspace *w1 = gsl_rstat_alloc();
+  gsl_rstat_workspace *w2 = gsl_rstat_alloc();
+  gsl_rstat_workspace *w3 = gsl_rstat_alloc();
+  double min, max;
+  FILE *f;
+  size_t i;
+
+  gsl_stats_minmax(&min, &max, data, 1, n);
+
+  gsl_rstat_add_array(data, 1, n1, w1);
+
+  for (i = n1; i < n; ++i)
+    gsl_rstat_add(data[i], w2);
+
+  gsl_rstat_merge(w1, w2);
+
+  /* round trip through a file */
+  f = tmpfile();
+  gsl_rstat_fwrite(f, w1);
+  rewind(f);
+  gsl_rstat_fread(f, w3);
+  fclose(f);
+
+  gsl_test_int(gsl_rstat_n(w3), n, "%s merge n n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_min(w3), min, tol, "%s merge min n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_max(w3), max, tol, "%s merge max n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_mean(w3), gsl_stats_mean(data, 1, n), tol, "%s merge mean n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_skew(w3), gsl_stats_skew(data, 1, n), tol, "%s merge skew n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_kurtosis(w3), gsl_stats_kurtosis(data, 1, n), tol, "%s merge kurtosis n=%zu", desc, n);
+
+  if (n > 1)
+    gsl_test_rel(gsl_rstat_variance(w3), gsl_stats_variance(data, 1, n), tol, "%s merge variance n=%zu", desc, n);
+
+  if (n <= 5)
+    {
+      /* median should be exact for n <= 5 */
+      double * data_copy = malloc(n * sizeof(double));
+
+      memcpy(data_copy, data, n * sizeof(double));
+      gsl_test_rel(gsl_rstat_median(w3), gsl_stats_median(data_copy, 1, n), tol, "%s merge median n=%zu", desc, n);
+
+      free(data_copy);
+    }
+
+  gsl_rstat_free(w1);
+  gsl_rstat_free(w2);
+  gsl_rstat_free(w3);
+}
+
 void
 test_quantile(const double p, const double data[], const size_t n,
               const double expected, const double tol, const char *desc)
@@ -135,6 +191,184 @@ test_quantile(const double p, const double data[], const size_t n,
   gsl_rstat_quantile_free(w);
 }
 
+/* as test_quantile, but add the data in chunks with
+   gsl_rstat_quantile_add_array */
+void
+test_quantile_array(const double p, const double data[], const size_t n,
+                    const double expected, const double tol, const char *desc)
+{
+  const size_t chunk = 1000;
+  gsl_rstat_quantile_workspace *w = gsl_rstat_quantile_alloc(p);
+  double result;
+  size_t i;
+
+  for (i = 0; i < n; i += chunk)
+    gsl_rstat_quantile_add_array(data + i, 1, GSL_MIN(chunk, n - i), w);
+
+  result = gsl_rstat_quantile_get(w);
+
+  gsl_test_int(w->n, n, "%s array n p=%g", desc, p);
+  gsl_test_rel(result, expected, tol, "%s array p=%g", desc, p);
+
+  gsl_rstat_quantile_free(w);
+}
+
+/* return fraction of sorted data which is <= x */
+static double
+test_rank(const double x, const double sorted_data[], const size_t n)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      size_t mid = (lo + hi) / 2;
+
+      if (sorted_data[mid] <= x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return (double) lo / (double) n;
+}
+
+/* accumulate data into nsplit t-digests, merge them and check the rank
+   error of estimated quantiles */
+void
+test_tdigest(const double compression, const size_t nsplit, const double data[],
+             const double sorted_data[], const size_t n, const char *desc)
+{
+  const double p[] = { 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999 };
+  const size_t np = sizeof(p) / sizeof(double);
+  gsl_rstat_tdigest_workspace *w = gsl_rstat_tdigest_alloc(compression);
+  gsl_rstat_tdigest_workspace *w2 = gsl_rstat_tdigest_alloc(compression);
+  FILE *f;
+  size_t i, j;
+
+  for (j = 0; j < nsplit; ++j)
+    {
+      const size_t start = j * n / nsplit;
+      const size_t end = (j + 1) * n / nsplit;
+
+      gsl_rstat_tdigest_reset(w2);
+      for (i = start; i < end; ++i)
+        gsl_rstat_tdigest_add(data[i], w2);
+
+      gsl_rstat_tdigest_merge(w, w2);
+    }
+
+  gsl_test_int(gsl_rstat_tdigest_n(w), n, "%s tdigest n", desc);
+  gsl_test(w->ncentroids > w->size, "%s tdigest ncentroids=%zu", desc, w->ncentroids);
+  gsl_test_rel(gsl_rstat_tdigest_quantile(w, 0.0), sorted_data[0], 0.0, "%s tdigest min", desc);
+  gsl_test_rel(gsl_rstat_tdigest_quantile(w, 1.0), sorted_data[n - 1], 0.0, "%s tdigest max", desc);
+
+  for (i = 0; i < np; ++i)
+    {
+      /* the rank error of the t-digest shrinks toward the tails */
+      const double tol = 2.0 * sqrt(p[i] * (1.0 - p[i])) / compression;
+      const double q = gsl_rstat_tdigest_quantile(w, p[i]);
+      const double rank = test_rank(q, sorted_data, n);
+
+      gsl_test_abs(rank, p[i], tol, "%s tdigest rank p=%g", desc, p[i]);
+    }
+
+  /* round trip through a file */
+  f = tmpfile();
+  gsl_rstat_tdigest_fwrite(f, w);
+  rewind(f);
+  gsl_rstat_tdigest_reset(w2);
+  gsl_rstat_tdigest_fread(f, w2);
+  fclose(f);
+
+  for (i = 0; i < np; ++i)
+    {
+      gsl_test_rel(gsl_rstat_tdigest_quantile(w2, p[i]),
+                   gsl_rstat_tdigest_quantile(w, p[i]), 0.0,
+                   "%s tdigest fread p=%g", desc, p[i]);
+    }
+
+  gsl_rstat_tdigest_free(w);
+  gsl_rstat_tdigest_free(w2);
+}
+
+/* compare exponentially weighted mean and variance against explicit
+   weighted sums, with time stamps t (or unit spacing if t is NULL) */
+void
+test_ewma(const double tau, const double t[], const double data[],
+          const size_t n, const double tol, const char *desc)
+{
+  gsl_rstat_ewma_workspace *w = gsl_rstat_ewma_alloc(tau);
+  double *weight = malloc(n * sizeof(double));
+  double sum = 0.0, mean = 0.0, var = 0.0;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      if (t)
+        gsl_rstat_ewma_add_t(t[i], data[i], w);
+      else
+        gsl_rstat_ewma_add(data[i], w);
+    }
+
+  /* weight of point i is exp(-(t_{n-1} - t_i)/tau), normalized to
+     unit sum */
+  for (i = 0; i < n; ++i)
+    {
+      const double dt = t ? t[n - 1] - t[i] : (double) (n - 1 - i);
+
+      weight[i] = exp(-dt / tau);
+      sum += weight[i];
+    }
+
+  for (i = 0; i < n; ++i)
+    weight[i] /= sum;
+
+  for (i = 0; i < n; ++i)
+    mean += weight[i] * data[i];
+
+  for (i = 0; i < n; ++i)
+    var += weight[i] * (data[i] - mean) * (data[i] - mean);
+
+  gsl_test_int(gsl_rstat_ewma_n(w), n, "%s ewma n", desc);
+  gsl_test_rel(gsl_rstat_ewma_mean(w), mean, tol, "%s ewma mean n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_ewma_variance(w), var, tol, "%s ewma variance n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_ewma_sd(w), sqrt(var), tol, "%s ewma sd n=%zu", desc, n);
+
+  free(weight);
+  gsl_rstat_ewma_free(w);
+}
+
+/* track a quantile of a Gaussian stream whose mean jumps from 0 to 5;
+   with dup set, points arrive in groups of 4 sharing a time stamp */
+void
+test_ewma_quantile(const double p, const double tau, const int dup, gsl_rng *r)
+{
+  const double expected = gsl_cdf_ugaussian_Pinv(p);
+  const size_t n = (size_t) (50.0 * tau);
+  gsl_rstat_ewma_quantile_workspace *w = gsl_rstat_ewma_quantile_alloc(p, tau);
+  double t = 0.0;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      if (!dup || i % 4 == 0)
+        t += gsl_ran_exponential(r, dup ? 4.0 : 1.0);
+
+      gsl_rstat_ewma_quantile_add_t(t, gsl_ran_ugaussian(r), w);
+    }
+
+  gsl_test_abs(gsl_rstat_ewma_quantile_get(w), expected, 0.15,
+               "ewma quantile p=%g tau=%g dup=%d", p, tau, dup);
+
+  for (i = 0; i < n; ++i)
+    gsl_rstat_ewma_quantile_add(5.0 + gsl_ran_ugaussian(r), w);
+
+  gsl_test_abs(gsl_rstat_ewma_quantile_get(w), 5.0 + expected, 0.15,
+               "ewma quantile shifted p=%g tau=%g dup=%d", p, tau, dup);
+
+  gsl_rstat_ewma_quantile_free(w);
+}
+
 int
 main()
 {
@@ -160,6 +394,7 @@ main()
           {
             sprintf(buf, "test1 j=%zu", j);
             test_basic(j, data2, tol1, buf);
+            test_merge(j, data2, tol1, buf);
           }
       }
 
@@ -178,6 +413,11 @@ main()
     test_basic(1500000, data, tol1, "test2");
     test_basic(2000000, data, tol1, "test2");
 
+    test_merge(10, data, tol1, "test2");
+    test_merge(1000, data, tol1, "test2");
+    test_merge(50000, data, tol1, "test2");
+    test_merge(2000000, data, tol1, "test2");
+
     /* test3: add large constant */
 
     for (i = 0; i < 5; ++i)
@@ -222,6 +462,7 @@ main()
       {
         double expected = gsl_stats_quantile_from_sorted_data(sorted_data, 1, n, p);
         test_quantile(p, data, n, expected, tol2, "gauss");
+        test_quantile_array(p, data, n, expected, tol2, "gauss");
       }
 
     /* test mean, variance */
@@ -248,11 +489,124 @@ main()
       gsl_test_abs(median, expected_median, tol2, "median");
     }
 
+    /* test t-digest */
+    test_tdigest(100.0, 1, data, sorted_data, n, "gauss");
+    test_tdigest(100.0, 7, data, sorted_data, n, "gauss");
+    test_tdigest(2.0, 3, data, sorted_data, n, "gauss small");
+
+    /* test merged median estimate */
+    {
+      const double expected_median = gsl_stats_quantile_from_sorted_data(sorted_data, 1, n, 0.5);
+      gsl_rstat_workspace *w1 = gsl_rstat_alloc();
+      gsl_rstat_workspace *w2 = gsl_rstat_alloc();
+      double median;
+
+      gsl_rstat_add_array(data, 1, n / 2, w1);
+      gsl_rstat_add_array(data + n / 2, 1, n - n / 2, w2);
+      gsl_rstat_merge(w1, w2);
+
+      median = gsl_rstat_median(w1);
+      gsl_test_abs(median, expected_median, tol2, "merged median");
+
+      gsl_rstat_free(w1);
+      gsl_rstat_free(w2);
+    }
+
+    /* t-digest on a subset */
+    memcpy(sorted_data, data, 50000 * sizeof(double));
+    gsl_sort(sorted_data, 1, 50000);
+    test_tdigest(200.0, 4, data, sorted_data, 50000, "gauss");
+
     free(data);
     free(sorted_data);
     gsl_rstat_free(rstat_workspace_p);
   }
 
+  /* exponentially weighted statistics */
+  {
+    const size_t n = 5000;
+    double *data = malloc(n * sizeof(double));
+    double *t = malloc(n * sizeof(double));
+    size_t i;
+
+    t[0] = 3.0;
+    for (i = 0; i < n; ++i)
+      {
+        data[i] = 10.0 + gsl_ran_gaussian(r, 2.0);
+        if (i > 0)
+          t[i] = t[i - 1] + gsl_ran_exponential(r, 0.5);
+      }
+
+    test_ewma(1.0, NULL, data, 1, tol1, "ewma");
+    test_ewma(20.0, NULL, data, 10, tol1, "ewma");
+    test_ewma(100.0, NULL, data, n, tol1, "ewma");
+    test_ewma(100.0, t, data, n, tol1, "ewma irregular");
+    test_ewma(0.1, t, data, 100, tol1, "ewma irregular");
+
+    /* duplicate time stamps: equal weights give the plain mean and
+       variance */
+    for (i = 0; i < n; ++i)
+      t[i] = 7.0;
+
+    test_ewma(1.0, t, data, 2, tol1, "ewma duplicate");
+    test_ewma(0.1, t, data, 100, tol1, "ewma duplicate");
+
+    {
+      gsl_rstat_ewma_workspace *w = gsl_rstat_ewma_alloc(0.1);
+      gsl_rstat_workspace *rstat_p = gsl_rstat_alloc();
+
+      for (i = 0; i < 100; ++i)
+        {
+          gsl_rstat_ewma_add_t(7.0, data[i], w);
+          gsl_rstat_add(data[i], rstat_p);
+        }
+
+      gsl_test_rel(gsl_rstat_ewma_mean(w), gsl_rstat_mean(rstat_p), tol1,
+                   "ewma duplicate mean vs rstat");
+      gsl_test_rel(gsl_rstat_ewma_variance(w),
+                   gsl_rstat_variance(rstat_p) * 99.0 / 100.0, tol1,
+                   "ewma duplicate variance vs rstat");
+
+      gsl_rstat_ewma_free(w);
+      gsl_rstat_free(rstat_p);
+    }
+
+    /* NaN is rejected and leaves the statistics unchanged */
+    {
+      gsl_rstat_ewma_workspace *w = gsl_rstat_ewma_alloc(10.0);
+      gsl_error_handler_t *old_handler = gsl_set_error_handler_off();
+      double mean;
+      int status;
+
+      gsl_rstat_ewma_add(1.0, w);
+      gsl_rstat_ewma_add(2.0, w);
+      mean = gsl_rstat_ewma_mean(w);
+
+      status = gsl_rstat_ewma_add(GSL_NAN, w);
+      gsl_test_int(status, GSL_EINVAL, "ewma NaN status");
+      gsl_test_int(gsl_rstat_ewma_n(w), 2, "ewma NaN n");
+      gsl_test_rel(gsl_rstat_ewma_mean(w), mean, 0.0, "ewma NaN mean");
+
+      gsl_set_error_handler(old_handler);
+      gsl_rstat_ewma_free(w);
+    }
+
+    /* irregular spacing with repeated time stamps */
+    t[0] = 0.0;
+    for (i = 1; i < n; ++i)
+      t[i] = t[i - 1] + ((i % 3 == 0) ? 0.0 : gsl_ran_exponential(r, 2.0));
+
+    test_ewma(5.0, t, data, n, tol1, "ewma irregular duplicate");
+
+    test_ewma_quantile(0.5, 2000.0, 0, r);
+    test_ewma_quantile(0.9, 2000.0, 0, r);
+    test_ewma_quantile(0.1, 2000.0, 0, r);
+    test_ewma_quantile(0.5, 2000.0, 1, r);
+
+    free(data);
+    free(t);
+  }
+
   gsl_rng_free(r);
 
   exit (gsl_test_summary());
@@ -40,6 +40,9 @@ void gsl_sort_float (float * data, const size_t stride, const size_t n);
 void gsl_sort2_float (float * data1, const size_t stride1, float * data2, const size_t stride2, const size_t n);
 void gsl_sort_float_index (size_t * p, const float * data, const size_t stride, const size_t n);
 
+void gsl_sort_float_merge (float * data, const size_t stride, const size_t n1, const size_t n2, float * work);
+void gsl_sort_float_index_merge (size_t * p, const float * data, const size_t stride, const size_t n1, const size_t n2, size_t * work);
+
 int gsl_sort_float_smallest (float * dest, const size_t k, const float * src, const size_t stride, const size_t n);
 int gsl_sort_float_smallest_index (size_t * p, const size_t k, const float * src, const size_t stride, const size_t n);
 
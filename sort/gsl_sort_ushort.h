@@ -40,6 +40,9 @@ void gsl_sort_ushort (unsigned short * data, const size_t stride, const size_t n
 void gsl_sort2_ushort (unsigned short * data1, const size_t stride1, unsigned short * data2, const size_t stride2, const size_t n);
 void gsl_sort_ushort_index (size_t * p, const unsigned short * data, const size_t stride, const size_t n);
 
+void gsl_sort_ushort_merge (unsigned short * data, const size_t stride, const size_t n1, const size_t n2, unsigned short * work);
+void gsl_sort_ushort_index_merge (size_t * p, const unsigned short * data, const size_t stride, const size_t n1, const size_t n2, size_t * work);
+
 int gsl_sort_ushort_smallest (unsigned short * dest, const size_t k, const unsigned short * src, const size_t stride, const size_t n);
 int gsl_sort_ushort_smallest_index (size_t * p, const size_t k, const unsigned short * src, const size_t stride, const size_t n);
 
@@ -0,0 +1,118 @@
+/* sort/merge_source.c
+ * 
+ * Copyright (C) 2026 agent
+ *
+ * This is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 3, or (at your option) any
+ * later version.
+ *
+ * This source is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * for more details.
+ */
+
+/* merge the two adjacent sorted runs data[0..n1-1] and
+   data[n1..n1+n2-1] into a single sorted run of length n1+n2.
+   The first run is copied into work, of length n1, and the output
+   is written from the front, so it can never overtake the unread
+   part of the second run. Equal elements keep their relative order. */
+
+void
+FUNCTION (gsl_sort, merge) (BASE * data, const size_t stride,
+                            const size_t n1, const size_t n2, BASE * work)
+{
+  const size_t n = n1 + n2;
+  size_t i = 0;                 /* position in work */
+  size_t j = n1;                /* position in second run */
+  size_t k = 0;                 /* output position */
+
+  if (n1 == 0 || n2 == 0)
+    {
+      return;                   /* nothing to merge */
+    }
+
+  /* runs already in order, as happens for presorted data */
+
+  if (!(data[n1 * stride] < data[(n1 - 1) * stride]))
+    {
+      return;
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      work[i] = data[i * stride];
+    }
+
+  i = 0;
+
+  while (i < n1 && j < n)
+    {
+      if (data[j * stride] < work[i])
+        {
+          data[k++ * stride] = data[j++ * stride];
+        }
+      else
+        {
+          data[k++ * stride] = work[i++];
+        }
+    }
+
+  /* the remainder of the second run is already in place */
+
+  while (i < n1)
+    {
+      data[k++ * stride] = work[i++];
+    }
+}
+
+/* merge two adjacent runs of an index, p[0..n1-1] and p[n1..n1+n2-1],
+   each sorted into ascending order of data[p[i]*stride]. Equal
+   elements are ordered by increasing index, matching gsl_sort_index,
+   so the result does not depend on how the runs were formed. */
+
+void
+FUNCTION (gsl_sort, index_merge) (size_t * p, const BASE * data,
+                                  const size_t stride, const size_t n1,
+                                  const size_t n2, size_t * work)
+{
+  const size_t n = n1 + n2;
+  size_t i = 0;
+  size_t j = n1;
+  size_t k = 0;
+
+  if (n1 == 0 || n2 == 0)
+    {
+      return;
+    }
+
+  if (!(INDEX_LESS (data, stride, p[n1], p[n1 - 1])))
+    {
+      return;
+    }
+
+  for (i = 0; i < n1; i++)
+    {
+      work[i] = p[i];
+    }
+
+  i = 0;
+
+  while (i < n1 && j < n)
+    {
+      if (INDEX_LESS (data, stride, p[j], work[i]))
+        {
+          p[k++] = p[j++];
+        }
+      else
+        {
+          p[k++] = work[i++];
+        }
+    }
+
+  while (i < n1)
+    {
+      p[k++] = work[i++];
+    }
+}
@@ -23,6 +23,11 @@
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
 
+/* order on (value, index) pairs, so that equal elements are sorted
+   by index and the resulting permutation is unique */
+#define INDEX_LESS(data,stride,a,b) ((data)[(a) * (stride)] < (data)[(b) * (stride)] \
+                                     || ((data)[(a) * (stride)] == (data)[(b) * (stride)] && (a) < (b)))
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "sortvecind_source.c"
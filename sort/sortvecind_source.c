@@ -28,12 +28,12 @@ FUNCTION (index, downheap) (size_t * p, const BASE * data, const size_t stride,
     {
       size_t j = 2 * k;
 
-      if (j < N && data[p[j] * stride] < data[p[j + 1] * stride])
+      if (j < N && INDEX_LESS (data, stride, p[j], p[j + 1]))
         {
           j++;
         }
 
-      if (!(data[pki * stride] < data[p[j] * stride])) /* avoid infinite loop if nan */
+      if (!INDEX_LESS (data, stride, pki, p[j])) /* avoid infinite loop if nan */
         {
           break;
         }
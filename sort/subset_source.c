@@ -13,6 +13,63 @@
  * for more details.
  */
 
+/* The k smallest (largest) elements are kept in a bounded binary
+   max-heap (min-heap) whose root is the current k-th element, so each
+   remaining element costs one comparison unless it enters the heap,
+   giving O(n log k) overall. The heap is sorted in place at the end. */
+
+static inline void
+FUNCTION (subset, downheap_max) (BASE * h, const size_t N, size_t i)
+{
+  BASE v = h[i];
+
+  while (2 * i + 1 < N)
+    {
+      size_t j = 2 * i + 1;
+
+      if (j + 1 < N && h[j] < h[j + 1])
+        {
+          j++;
+        }
+
+      if (!(v < h[j]))  /* also stops at a nan, which stays in place */
+        {
+          break;
+        }
+
+      h[i] = h[j];
+      i = j;
+    }
+
+  h[i] = v;
+}
+
+static inline void
+FUNCTION (subset, downheap_min) (BASE * h, const size_t N, size_t i)
+{
+  BASE v = h[i];
+
+  while (2 * i + 1 < N)
+    {
+      size_t j = 2 * i + 1;
+
+      if (j + 1 < N && h[j + 1] < h[j])
+        {
+          j++;
+        }
+
+      if (!(h[j] < v))
+        {
+          break;
+        }
+
+      h[i] = h[j];
+      i = j;
+    }
+
+  h[i] = v;
+}
+
 /* find the k-th smallest elements of the vector data, in ascending order */
 
 int
@@ -20,8 +77,7 @@ FUNCTION (gsl_sort, smallest) (BASE * dest, const size_t k,
                                const BASE * src, const size_t stride,
                                const size_t n)
 {
-  size_t i, j;
-  BASE xbound;
+  size_t i;
 
   if (k > n)
     {
@@ -33,40 +89,41 @@ FUNCTION (gsl_sort, smallest) (BASE * dest, const size_t k,
       return GSL_SUCCESS;
     }
 
-  /* take the first element */
-
-  j = 1;
-  xbound = src[0 * stride];
-  dest[0] = xbound;
+  /* build a max-heap from the first k elements */
 
-  /* examine the remaining elements */
+  for (i = 0; i < k; i++)
+    {
+      dest[i] = src[i * stride];
+    }
 
-  for (i = 1; i < n; i++)
+  for (i = k / 2; i-- > 0; )
     {
-      size_t i1;
+      FUNCTION (subset, downheap_max) (dest, k, i);
+    }
 
+  /* examine the remaining elements, replacing the largest element
+     of the heap whenever a smaller one is found */
+
+  for (i = k; i < n; i++)
+    {
       BASE xi = src[i * stride];
 
-      if (j < k)
+      if (xi < dest[0])
         {
-          j++;
-        }
-      else if (xi >= xbound)
-        {
-          continue;
+          dest[0] = xi;
+          FUNCTION (subset, downheap_max) (dest, k, 0);
         }
+    }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
-        {
-          if (xi > dest[i1 - 1])
-            break;
-
-          dest[i1] = dest[i1 - 1];
-        }
+  /* sort the heap into ascending order */
 
-      dest[i1] = xi;
+  for (i = k - 1; i > 0; i--)
+    {
+      BASE tmp = dest[0];
+      dest[0] = dest[i];
+      dest[i] = tmp;
 
-      xbound = dest[j-1];
+      FUNCTION (subset, downheap_max) (dest, i, 0);
     }
 
   return GSL_SUCCESS;
@@ -85,8 +142,7 @@ FUNCTION (gsl_sort, largest) (BASE * dest, const size_t k,
                               const BASE * src, const size_t stride,
                               const size_t n)
 {
-  size_t i, j;
-  BASE xbound;
+  size_t i;
 
   if (k > n)
     {
@@ -98,40 +154,40 @@ FUNCTION (gsl_sort, largest) (BASE * dest, const size_t k,
       return GSL_SUCCESS;
     }
 
-  /* take the first element */
+  /* build a min-heap from the first k elements */
+
+  for (i = 0; i < k; i++)
+    {
+      dest[i] = src[i * stride];
+    }
 
-  j = 1;
-  xbound = src[0 * stride];
-  dest[0] = xbound;
+  for (i = k / 2; i-- > 0; )
+    {
+      FUNCTION (subset, downheap_min) (dest, k, i);
+    }
 
   /* examine the remaining elements */
 
-  for (i = 1; i < n; i++)
+  for (i = k; i < n; i++)
     {
-      size_t i1;
-
       BASE xi = src[i * stride];
 
-      if (j < k)
+      if (xi > dest[0])
         {
-          j++;
+          dest[0] = xi;
+          FUNCTION (subset, downheap_min) (dest, k, 0);
         }
-      else if (xi <= xbound)
-        {
-          continue;
-        }
-
-      for (i1 = j - 1; i1 > 0 ; i1--)
-        {
-          if (xi < dest[i1 - 1])
-            break;
+    }
 
-          dest[i1] = dest[i1 - 1];
-        }
+  /* sort the heap into descending order */
 
-      dest[i1] = xi;
+  for (i = k - 1; i > 0; i--)
+    {
+      BASE tmp = dest[0];
+      dest[0] = dest[i];
+      dest[i] = tmp;
 
-      xbound = dest[j-1];
+      FUNCTION (subset, downheap_min) (dest, i, 0);
     }
 
   return GSL_SUCCESS;
@@ -19,6 +19,14 @@
 #include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
 
+/* order equal elements by index, as in sortvecind.c, so that the
+   selected subset and its order are unique */
+
+#define INDEX_LESS(data,stride,a,b) ((data)[(a) * (stride)] < (data)[(b) * (stride)] \
+                                     || ((data)[(a) * (stride)] == (data)[(b) * (stride)] && (a) < (b)))
+#define INDEX_GREATER(data,stride,a,b) ((data)[(a) * (stride)] > (data)[(b) * (stride)] \
+                                        || ((data)[(a) * (stride)] == (data)[(b) * (stride)] && (a) < (b)))
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "subsetind_source.c"
@@ -13,6 +13,66 @@
  * for more details.
  */
 
+/* As in subset_source.c, a bounded binary heap of indices holds the
+   current k smallest (largest) elements, for O(n log k) overall.
+   Equal elements are ordered by increasing index in both cases. */
+
+static inline void
+FUNCTION (subsetind, downheap_max) (size_t * p, const BASE * src,
+                                    const size_t stride, const size_t N,
+                                    size_t i)
+{
+  const size_t pi = p[i];
+
+  while (2 * i + 1 < N)
+    {
+      size_t j = 2 * i + 1;
+
+      if (j + 1 < N && INDEX_LESS (src, stride, p[j], p[j + 1]))
+        {
+          j++;
+        }
+
+      if (!INDEX_LESS (src, stride, pi, p[j]))  /* also stops at a nan, which stays in place */
+        {
+          break;
+        }
+
+      p[i] = p[j];
+      i = j;
+    }
+
+  p[i] = pi;
+}
+
+static inline void
+FUNCTION (subsetind, downheap_min) (size_t * p, const BASE * src,
+                                    const size_t stride, const size_t N,
+                                    size_t i)
+{
+  const size_t pi = p[i];
+
+  while (2 * i + 1 < N)
+    {
+      size_t j = 2 * i + 1;
+
+      if (j + 1 < N && INDEX_GREATER (src, stride, p[j], p[j + 1]))
+        {
+          j++;
+        }
+
+      if (!INDEX_GREATER (src, stride, pi, p[j]))
+        {
+          break;
+        }
+
+      p[i] = p[j];
+      i = j;
+    }
+
+  p[i] = pi;
+}
+
 /* find the k-th smallest elements of the vector data, in ascending order */
 
 int
@@ -20,8 +80,7 @@ FUNCTION (gsl_sort, smallest_index) (size_t * p, const size_t k,
                                      const BASE * src, const size_t stride,
                                      const size_t n)
 {
-  size_t i, j;
-  BASE xbound;
+  size_t i;
 
   if (k > n)
     {
@@ -33,40 +92,32 @@ FUNCTION (gsl_sort, smallest_index) (size_t * p, const size_t k,
       return GSL_SUCCESS;
     }
 
-  /* take the first element */
-
-  j = 1;
-  xbound = src[0 * stride];
-  p[0] = 0;
-
-  /* examine the remaining elements */
-
-  for (i = 1; i < n; i++)
+  for (i = 0; i < k; i++)
     {
-      size_t i1;
-
-      BASE xi = src[i * stride];
+      p[i] = i;
+    }
 
-      if (j < k)
-        {
-          j++;
-        }
-      else if (xi >= xbound)
-        {
-          continue;
-        }
+  for (i = k / 2; i-- > 0; )
+    {
+      FUNCTION (subsetind, downheap_max) (p, src, stride, k, i);
+    }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
+  for (i = k; i < n; i++)
+    {
+      if (INDEX_LESS (src, stride, i, p[0]))
         {
-          if (xi > src[p[i1 - 1] * stride])
-            break;
-
-          p[i1] = p[i1 - 1];
+          p[0] = i;
+          FUNCTION (subsetind, downheap_max) (p, src, stride, k, 0);
         }
+    }
 
-      p[i1] = i;
+  for (i = k - 1; i > 0; i--)
+    {
+      size_t tmp = p[0];
+      p[0] = p[i];
+      p[i] = tmp;
 
-      xbound = src[p[j-1] * stride];
+      FUNCTION (subsetind, downheap_max) (p, src, stride, i, 0);
     }
 
   return GSL_SUCCESS;
@@ -85,8 +136,7 @@ FUNCTION (gsl_sort, largest_index) (size_t * p, const size_t k,
                                     const BASE * src, const size_t stride,
                                     const size_t n)
 {
-  size_t i, j;
-  BASE xbound;
+  size_t i;
 
   if (k > n)
     {
@@ -98,40 +148,32 @@ FUNCTION (gsl_sort, largest_index) (size_t * p, const size_t k,
       return GSL_SUCCESS;
     }
 
-  /* take the first element */
-
-  j = 1;
-  xbound = src[0 * stride];
-  p[0] = 0;
-
-  /* examine the remaining elements */
-
-  for (i = 1; i < n; i++)
+  for (i = 0; i < k; i++)
     {
-      size_t i1;
-
-      BASE xi = src[i * stride];
+      p[i] = i;
+    }
 
-      if (j < k)
-        {
-          j++;
-        }
-      else if (xi <= xbound)
-        {
-          continue;
-        }
+  for (i = k / 2; i-- > 0; )
+    {
+      FUNCTION (subsetind, downheap_min) (p, src, stride, k, i);
+    }
 
-      for (i1 = j - 1; i1 > 0 ; i1--)
+  for (i = k; i < n; i++)
+    {
+      if (INDEX_GREATER (src, stride, i, p[0]))
         {
-          if (xi < src[stride * p[i1 - 1]])
-            break;
-
-          p[i1] = p[i1 - 1];
+          p[0] = i;
+          FUNCTION (subsetind, downheap_min) (p, src, stride, k, 0);
         }
+    }
 
-      p[i1] = i;
+  for (i = k - 1; i > 0; i--)
+    {
+      size_t tmp = p[0];
+      p[0] = p[i];
+      p[i] = tmp;
 
-      xbound = src[stride * p[j-1]];
+      FUNCTION (subsetind, downheap_min) (p, src, stride, i, 0);
     }
 
   return GSL_SUCCESS;
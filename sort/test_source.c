@@ -140,6 +140,41 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
   status |= FUNCTION (my, pcheck) (p, data, orig);
   gsl_test (status, "indexing " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
 
+  /* sort two blocks independently and merge them */
+  {
+    const size_t n1 = N / 3;
+    const size_t n2 = N - n1;
+    size_t * p2 = (size_t *) malloc (N * sizeof (size_t));
+    size_t * iwork = (size_t *) malloc (N * sizeof (size_t));
+    BASE * work = (BASE *) malloc (N * sizeof (BASE));
+    size_t i;
+
+    FUNCTION (gsl_sort, index) (p2, data->data, stride, n1);
+    FUNCTION (gsl_sort, index) (p2 + n1, data->data + n1 * stride, stride, n2);
+
+    for (i = n1; i < N; i++)
+      p2[i] += n1;
+
+    FUNCTION (gsl_sort, index_merge) (p2, data->data, stride, n1, n2, iwork);
+
+    status = 0;
+    for (i = 0; i < N; i++)
+      status |= (p2[i] != p->data[i]);
+    gsl_test (status, "index merge " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
+
+    FUNCTION (gsl_vector, memcpy) (data2, data);
+    TYPE (gsl_sort) (data2->data, stride, n1);
+    TYPE (gsl_sort) (data2->data + n1 * stride, stride, n2);
+    FUNCTION (gsl_sort, merge) (data2->data, stride, n1, n2, work);
+    status = FUNCTION (my, check) (data2, orig);
+    gsl_test (status, "merge " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
+    FUNCTION (gsl_vector, memcpy) (data2, data);
+
+    free (p2);
+    free (iwork);
+    free (work);
+  }
+
   TYPE (gsl_sort_vector) (data);
   status = FUNCTION (my, check) (data, orig);
   gsl_test (status, "sorting, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
@@ -162,6 +197,50 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
   status = FUNCTION (my, licheck) (index, k, p, data);
   gsl_test (status, "largest index, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
 
+  /* equal elements are ordered by increasing index */
+  {
+    size_t i;
+
+    for (i = 0; i < N; i++)
+      FUNCTION (gsl_vector, set) (data2, i, (BASE) (i % 3));
+
+    FUNCTION (gsl_sort_vector, index) (p, data2);
+
+    status = 0;
+    for (i = 0; i + 1 < N; i++)
+      {
+        const size_t i0 = gsl_permutation_get (p, i);
+        const size_t i1 = gsl_permutation_get (p, i + 1);
+
+        status |= (FUNCTION (gsl_vector, get) (data2, i0)
+                   == FUNCTION (gsl_vector, get) (data2, i1) && i0 > i1);
+      }
+    gsl_test (status, "indexing ties " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+
+    FUNCTION (gsl_sort_vector, smallest_index) (index, k, data2);
+
+    status = 0;
+    for (i = 0; i < k; i++)
+      status |= (index[i] != gsl_permutation_get (p, i));
+    gsl_test (status, "smallest index ties " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+
+    FUNCTION (gsl_sort_vector, largest_index) (index, k, data2);
+
+    /* expected: values 2, 1, 0 in turn, each by increasing index */
+    status = 0;
+    {
+      size_t m = 0;
+      int r;
+
+      for (r = 2; r >= 0; r--)
+        {
+          for (i = r; i < N && m < k; i += 3)
+            status |= (index[m++] != i);
+        }
+    }
+    gsl_test (status, "largest index ties " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+  }
+
   FUNCTION (gsl_vector, free) (orig);
   FUNCTION (gsl_vector, free) (data);
   FUNCTION (gsl_vector, free) (data2);
@@ -167,6 +167,7 @@ int gsl_spmatrix_complex_add_to_dense (gsl_matrix_complex * a, const gsl_spmatri
 /* properties */
 
 int gsl_spmatrix_complex_equal (const gsl_spmatrix_complex * a, const gsl_spmatrix_complex * b);
+int gsl_spmatrix_complex_color_columns (const gsl_spmatrix_complex * m, size_t * colors, size_t * ncolors);
 
 /* swap */
 
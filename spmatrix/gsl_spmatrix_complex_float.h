@@ -167,6 +167,7 @@ int gsl_spmatrix_complex_float_add_to_dense (gsl_matrix_complex_float * a, const
 /* properties */
 
 int gsl_spmatrix_complex_float_equal (const gsl_spmatrix_complex_float * a, const gsl_spmatrix_complex_float * b);
+int gsl_spmatrix_complex_float_color_columns (const gsl_spmatrix_complex_float * m, size_t * colors, size_t * ncolors);
 
 /* swap */
 
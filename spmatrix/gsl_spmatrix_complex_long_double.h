@@ -167,6 +167,7 @@ int gsl_spmatrix_complex_long_double_add_to_dense (gsl_matrix_complex_long_doubl
 /* properties */
 
 int gsl_spmatrix_complex_long_double_equal (const gsl_spmatrix_complex_long_double * a, const gsl_spmatrix_complex_long_double * b);
+int gsl_spmatrix_complex_long_double_color_columns (const gsl_spmatrix_complex_long_double * m, size_t * colors, size_t * ncolors);
 
 /* swap */
 
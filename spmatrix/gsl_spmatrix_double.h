@@ -172,6 +172,7 @@ int gsl_spmatrix_add_to_dense (gsl_matrix * a, const gsl_spmatrix * b);
 /* properties */
 
 int gsl_spmatrix_equal (const gsl_spmatrix * a, const gsl_spmatrix * b);
+int gsl_spmatrix_color_columns (const gsl_spmatrix * m, size_t * colors, size_t * ncolors);
 double gsl_spmatrix_norm1 (const gsl_spmatrix * a);
 
 /* swap */
@@ -172,6 +172,7 @@ int gsl_spmatrix_ulong_add_to_dense (gsl_matrix_ulong * a, const gsl_spmatrix_ul
 /* properties */
 
 int gsl_spmatrix_ulong_equal (const gsl_spmatrix_ulong * a, const gsl_spmatrix_ulong * b);
+int gsl_spmatrix_ulong_color_columns (const gsl_spmatrix_ulong * m, size_t * colors, size_t * ncolors);
 unsigned long gsl_spmatrix_ulong_norm1 (const gsl_spmatrix_ulong * a);
 
 /* swap */
@@ -189,3 +189,157 @@ FUNCTION (gsl_spmatrix, norm1) (const TYPE (gsl_spmatrix) * A)
 }
 
 #endif
+
+/*
+gsl_spmatrix_color_columns()
+  Partition the columns of a sparse matrix into structurally
+orthogonal groups, so that no two columns of the same group
+have a non-zero element in the same row. The groups are found
+by greedy coloring of the column intersection graph in the
+natural column order (Curtis, Powell and Reid).
+
+Inputs: m       - sparse matrix (only the sparsity pattern is used)
+        colors  - (output) color of each column, length size2
+        ncolors - (output) number of colors used
+
+Return: success or error
+
+Notes:
+1) A (p,q) banded matrix receives at most p + q + 1 colors
+*/
+
+int
+FUNCTION (gsl_spmatrix, color_columns) (const TYPE (gsl_spmatrix) * m, size_t * colors,
+                                        size_t * ncolors)
+{
+  const size_t M = m->size1;
+  const size_t N = m->size2;
+  const size_t nz = m->nz;
+  size_t *work, *rowptr, *colptr, *rowcols, *colrows, *Ti, *Tj, *mark;
+  size_t i, j, n, k;
+
+  if (!GSL_SPMATRIX_ISCOO(m) && !GSL_SPMATRIX_ISCSC(m) && !GSL_SPMATRIX_ISCSR(m))
+    {
+      GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
+    }
+
+  *ncolors = 0;
+
+  if (N == 0)
+    return GSL_SUCCESS;
+
+  work = malloc (((M + 1) + (N + 1) + 4 * nz + N) * sizeof (size_t));
+  if (work == NULL)
+    {
+      GSL_ERROR("failed to allocate space for coloring workspace", GSL_ENOMEM);
+    }
+
+  rowptr = work;
+  colptr = rowptr + M + 1;
+  rowcols = colptr + N + 1;
+  colrows = rowcols + nz;
+  Ti = colrows + nz;
+  Tj = Ti + nz;
+  mark = Tj + nz;
+
+  /* extract (row,column) pairs of the non-zero elements */
+  if (GSL_SPMATRIX_ISCOO(m))
+    {
+      for (n = 0; n < nz; ++n)
+        {
+          Ti[n] = (size_t) m->i[n];
+          Tj[n] = (size_t) m->p[n];
+        }
+    }
+  else if (GSL_SPMATRIX_ISCSC(m))
+    {
+      for (j = 0; j < N; ++j)
+        {
+          for (n = (size_t) m->p[j]; n < (size_t) m->p[j + 1]; ++n)
+            {
+              Ti[n] = (size_t) m->i[n];
+              Tj[n] = j;
+            }
+        }
+    }
+  else
+    {
+      for (i = 0; i < M; ++i)
+        {
+          for (n = (size_t) m->p[i]; n < (size_t) m->p[i + 1]; ++n)
+            {
+              Ti[n] = i;
+              Tj[n] = (size_t) m->i[n];
+            }
+        }
+    }
+
+  /* build row-wise and column-wise index lists */
+  for (i = 0; i <= M; ++i)
+    rowptr[i] = 0;
+
+  for (j = 0; j <= N; ++j)
+    colptr[j] = 0;
+
+  for (n = 0; n < nz; ++n)
+    {
+      ++rowptr[Ti[n] + 1];
+      ++colptr[Tj[n] + 1];
+    }
+
+  for (i = 0; i < M; ++i)
+    rowptr[i + 1] += rowptr[i];
+
+  for (j = 0; j < N; ++j)
+    colptr[j + 1] += colptr[j];
+
+  for (n = 0; n < nz; ++n)
+    {
+      rowcols[rowptr[Ti[n]]++] = Tj[n];
+      colrows[colptr[Tj[n]]++] = Ti[n];
+    }
+
+  /* shift the pointers back, rowptr[i] is now the end of row i */
+  for (i = M; i > 0; --i)
+    rowptr[i] = rowptr[i - 1];
+  rowptr[0] = 0;
+
+  for (j = N; j > 0; --j)
+    colptr[j] = colptr[j - 1];
+  colptr[0] = 0;
+
+  /* mark[c] = j if color c is used by a neighbor of column j */
+  for (k = 0; k < N; ++k)
+    mark[k] = N;
+
+  for (j = 0; j < N; ++j)
+    {
+      size_t c = 0;
+
+      for (n = colptr[j]; n < colptr[j + 1]; ++n)
+        {
+          size_t r = colrows[n];
+          size_t s;
+
+          for (s = rowptr[r]; s < rowptr[r + 1]; ++s)
+            {
+              size_t jj = rowcols[s];
+
+              if (jj < j)
+                mark[colors[jj]] = j;
+            }
+        }
+
+      while (mark[c] == j)
+        ++c;
+
+      colors[j] = c;
+
+      if (c + 1 > *ncolors)
+        *ncolors = c + 1;
+    }
+
+  free (work);
+
+  return GSL_SUCCESS;
+}
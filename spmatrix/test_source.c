@@ -408,6 +408,87 @@ FUNCTION (test, transpose) (const size_t M, const size_t N, const int sptype,
   FUNCTION (gsl_spmatrix, free) (B);
 }
 
+static void
+FUNCTION (test, color) (const size_t M, const size_t N, const int sptype,
+                        const double density, gsl_rng * r)
+{
+  TYPE (gsl_spmatrix) * A = FUNCTION (test, random) (M, N, density, 1.0, 20.0, r);
+  TYPE (gsl_spmatrix) * B = FUNCTION (gsl_spmatrix, compress) (A, sptype);
+  size_t * colors = malloc (N * sizeof (size_t));
+  size_t * seen = malloc (N * M * sizeof (size_t));
+  size_t ncolors, i, j, n;
+
+  /* seen(i,c) = 1 + column of color c found in row i */
+  for (i = 0; i < N * M; ++i)
+    seen[i] = 0;
+
+  FUNCTION (gsl_spmatrix, color_columns) (B, colors, &ncolors);
+
+  status = 0;
+  for (j = 0; j < N; ++j)
+    {
+      if (colors[j] >= ncolors)
+        status = 1;
+    }
+
+  for (n = 0; n < A->nz && status == 0; ++n)
+    {
+      size_t *s;
+
+      i = A->i[n];
+      j = A->p[n];
+      s = &seen[i * N + colors[j]];
+
+      /* two columns of the same color must not share a row */
+      if (*s != 0 && *s != j + 1)
+        status = 1;
+
+      *s = j + 1;
+    }
+
+  gsl_test(status, NAME (gsl_spmatrix) "_color_columns[%zu,%zu](%s) ncolors=%zu",
+           M, N, FUNCTION (gsl_spmatrix, type) (B), ncolors);
+
+  FUNCTION (gsl_spmatrix, free) (A);
+  FUNCTION (gsl_spmatrix, free) (B);
+
+  /* tridiagonal pattern needs exactly 3 colors */
+  if (N >= 3)
+    {
+      TYPE (gsl_spmatrix) * T = FUNCTION (gsl_spmatrix, alloc) (N, N);
+
+      for (i = 0; i < N; ++i)
+        {
+          FUNCTION (gsl_spmatrix, set) (T, i, i, (BASE) 1);
+
+          if (i > 0)
+            FUNCTION (gsl_spmatrix, set) (T, i, i - 1, (BASE) 1);
+
+          if (i < N - 1)
+            FUNCTION (gsl_spmatrix, set) (T, i, i + 1, (BASE) 1);
+        }
+
+      B = FUNCTION (gsl_spmatrix, compress) (T, sptype);
+      FUNCTION (gsl_spmatrix, color_columns) (B, colors, &ncolors);
+
+      status = (ncolors != 3);
+      for (j = 0; j < N; ++j)
+        {
+          if (colors[j] != j % 3)
+            status = 1;
+        }
+
+      gsl_test(status, NAME (gsl_spmatrix) "_color_columns[%zu,%zu](%s) tridiagonal",
+               N, N, FUNCTION (gsl_spmatrix, type) (B));
+
+      FUNCTION (gsl_spmatrix, free) (T);
+      FUNCTION (gsl_spmatrix, free) (B);
+    }
+
+  free (colors);
+  free (seen);
+}
+
 static void
 FUNCTION (test, scale) (const size_t M, const size_t N, const int sptype,
                         const double density, gsl_rng * r)
@@ -817,6 +898,10 @@ FUNCTION (test, all) (const size_t M, const size_t N, const double density, gsl_
   FUNCTION (test, transpose) (M, N, GSL_SPMATRIX_CSC, density, r);
   FUNCTION (test, transpose) (M, N, GSL_SPMATRIX_CSR, density, r);
 
+  FUNCTION (test, color) (M, N, GSL_SPMATRIX_COO, density, r);
+  FUNCTION (test, color) (M, N, GSL_SPMATRIX_CSC, density, r);
+  FUNCTION (test, color) (M, N, GSL_SPMATRIX_CSR, density, r);
+
   FUNCTION (test, scale) (M, N, GSL_SPMATRIX_COO, density, r);
   FUNCTION (test, scale) (M, N, GSL_SPMATRIX_CSC, density, r);
   FUNCTION (test, scale) (M, N, GSL_SPMATRIX_CSR, density, r);
@@ -207,10 +207,8 @@ FUNCTION(gsl_stats,Qn0_from_sorted_data) (const BASE sorted_data[],
       /* return pull(work, j - 1, knew - nl)	: */
       knew -= (nl + 1); /* -1: 0-indexing */
 
-      /* sort work array */
-      TYPE (gsl_sort) (work, 1, j);
-
-      return (work[knew]);
+      /* select element knew of work array */
+      return FUNCTION(gsl_stats,select) (work, 1, j, knew);
     }
 }
 
@@ -278,6 +276,74 @@ FUNCTION(gsl_stats,Qn_from_sorted_data) (const BASE sorted_data[],
   return Qn;
 }
 
+/*
+gsl_stats_Qn_columns()
+  Compute the Q_n statistic of each column of a matrix
+
+Inputs: data     - matrix of observations, n rows and ncols columns,
+                   stored in row-major order with row stride tda
+        tda      - row stride of data
+        n        - number of rows
+        ncols    - number of columns
+        result   - (output) Q_n statistic of each column, length ncols
+        work     - workspace of length lwork of type BASE
+        lwork    - length of work, at least 4n. The columns are copied
+                   to the workspace floor(lwork/n) - 3 at a time,
+                   reading the data in row order.
+        work_int - workspace of length 5n of type int
+
+Return: success/error
+*/
+
+int
+FUNCTION(gsl_stats,Qn_columns) (const BASE data[],
+                                const size_t tda,
+                                const size_t n,
+                                const size_t ncols,
+                                double result[],
+                                BASE work[],
+                                const size_t lwork,
+                                int work_int[])
+{
+  if (n == 0)
+    {
+      GSL_ERROR("number of rows must be positive", GSL_EBADLEN);
+    }
+  else if (lwork / n < 4)
+    {
+      GSL_ERROR("workspace must have length at least 4n", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nblock = GSL_MIN(lwork / n - 3, ncols);
+      BASE * scratch = work + nblock * n;
+      size_t c, b, i;
+
+      for (c = 0; c < ncols; c += nblock)
+        {
+          const size_t nb = GSL_MIN(nblock, ncols - c);
+
+          for (i = 0; i < n; ++i)
+            {
+              const BASE * row = data + i * tda + c;
+
+              for (b = 0; b < nb; ++b)
+                work[b * n + i] = row[b];
+            }
+
+          for (b = 0; b < nb; ++b)
+            {
+              BASE * col = work + b * n;
+
+              TYPE (gsl_sort) (col, 1, n);
+              result[c + b] = FUNCTION(gsl_stats,Qn_from_sorted_data) (col, 1, n, scratch, work_int);
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
 /*
   Algorithm to compute the weighted high median in O(n) time.
 
@@ -314,12 +380,7 @@ FUNCTION(Qn,whimed)(BASE * a, int * w, int n, BASE * a_cand, BASE * a_srt, int *
         a_srt[i] = a[i];
 
       n2 = n/2; /* =^= n/2 +1 with 0-indexing */
-#if 0
-      rPsort(a_srt, n, n2);
-#else
-      TYPE (gsl_sort) (a_srt, 1, n);
-#endif
-      trial = a_srt[n2];
+      trial = FUNCTION(gsl_stats,select) (a_srt, 1, n, n2);
 
       wleft = 0;
       wmid = 0;
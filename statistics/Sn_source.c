@@ -267,3 +267,69 @@ FUNCTION(gsl_stats,Sn_from_sorted_data) (const BASE sorted_data[],
 
   return Sn;
 }
+
+/*
+gsl_stats_Sn_columns()
+  Compute the S_n statistic of each column of a matrix
+
+Inputs: data    - matrix of observations, n rows and ncols columns,
+                  stored in row-major order with row stride tda
+        tda     - row stride of data
+        n       - number of rows
+        ncols   - number of columns
+        result  - (output) S_n statistic of each column, length ncols
+        work    - workspace of length lwork
+        lwork   - length of work, at least 2n. The columns are copied
+                  to the workspace floor(lwork/n) - 1 at a time,
+                  reading the data in row order.
+
+Return: success/error
+*/
+
+int
+FUNCTION(gsl_stats,Sn_columns) (const BASE data[],
+                                const size_t tda,
+                                const size_t n,
+                                const size_t ncols,
+                                double result[],
+                                BASE work[],
+                                const size_t lwork)
+{
+  if (n == 0)
+    {
+      GSL_ERROR("number of rows must be positive", GSL_EBADLEN);
+    }
+  else if (lwork / n < 2)
+    {
+      GSL_ERROR("workspace must have length at least 2n", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nblock = GSL_MIN(lwork / n - 1, ncols);
+      BASE * scratch = work + nblock * n;
+      size_t c, b, i;
+
+      for (c = 0; c < ncols; c += nblock)
+        {
+          const size_t nb = GSL_MIN(nblock, ncols - c);
+
+          for (i = 0; i < n; ++i)
+            {
+              const BASE * row = data + i * tda + c;
+
+              for (b = 0; b < nb; ++b)
+                work[b * n + i] = row[b];
+            }
+
+          for (b = 0; b < nb; ++b)
+            {
+              BASE * col = work + b * n;
+
+              TYPE (gsl_sort) (col, 1, n);
+              result[c + b] = FUNCTION(gsl_stats,Sn_from_sorted_data) (col, 1, n, scratch);
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
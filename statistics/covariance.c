@@ -1,9 +1,13 @@
 #include <config.h>
 #include <math.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_statistics.h>
 #include <gsl/gsl_vector.h>
+#include <gsl/gsl_sort.h>
 #include <gsl/gsl_sort_vector.h>
 
+#include "kendall.c"
+
 static int compute_rank(gsl_vector *v);
 
 #define BASE_LONG_DOUBLE
@@ -180,3 +180,39 @@ FUNCTION(gsl_stats,spearman) (const BASE data1[], const size_t stride1,
 
   return r;
 }
+
+/*
+gsl_stats_kendall()
+  Compute Kendall's tau-b rank correlation coefficient in O(n log n)
+time
+
+Inputs: data1   - data1 vector
+        stride1 - stride of data1
+        data2   - data2 vector
+        stride2 - stride of data2
+        n       - number of elements in data1 and data2
+        work    - additional workspace of size 3*n
+
+Return: Kendall tau-b rank correlation coefficient
+*/
+
+double
+FUNCTION(gsl_stats,kendall) (const BASE data1[], const size_t stride1,
+                             const BASE data2[], const size_t stride2,
+                             const size_t n, double work[])
+{
+  double *x = &work[0];
+  double *y = &work[n];
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      x[i] = data1[i * stride1];
+      y[i] = data2[i * stride2];
+    }
+
+  /* sort data1 and update data2 at same time */
+  gsl_sort2(x, 1, y, 1, n);
+
+  return kendall_sorted(n, x, y, &work[2 * n]);
+}
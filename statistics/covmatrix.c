@@ -0,0 +1,862 @@
+/* statistics/covmatrix.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module computes covariance and correlation matrices of the
+ * columns of a data matrix X, which may be supplied in blocks of rows.
+ *
+ * Each block of m rows is centered by its own column means mu_b and
+ * its cross product matrix is formed with a single dsyrk. Blocks are
+ * merged with the pairwise update of Chan, Golub and LeVeque,
+ *
+ * Q = Q_a + Q_b + (n_a n_b / n) (mu_b - mu_a) (mu_b - mu_a)^T
+ *
+ * so the data are read once and never re-centered.
+ *
+ * With pairwise-complete NaN handling, the statistic for columns i and j
+ * uses the rows in which both are present. With z = x - shift (or 0 if
+ * x is NaN) and indicator matrix M, the sums
+ *
+ * N = M^T M, Q = Z^T Z, S = Z^T M, T = (Z.Z)^T M
+ *
+ * give the counts, cross products and column sums over each pair of
+ * columns. The shift is the mean of the first block in which a column
+ * has data, to reduce cancellation in Q - S S^T / N.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_statistics_double.h>
+#include <gsl/gsl_statistics_matrix.h>
+
+#include "kendall.c"
+
+/* number of rows processed per block */
+#define COVMAT_BLOCK    256
+
+static int covmat_block (const gsl_matrix * X, gsl_stats_covmat_workspace * w);
+static int covmat_block_pairwise (const gsl_matrix * X, gsl_stats_covmat_workspace * w);
+static size_t covmat_rank (const size_t n, double * v, const size_t stride,
+                           double * tmp, size_t * rows, size_t * perm);
+
+gsl_stats_covmat_workspace *
+gsl_stats_covmat_alloc (const size_t p, const int flags)
+{
+  gsl_stats_covmat_workspace *w;
+
+  if (p == 0)
+    {
+      GSL_ERROR_NULL ("number of variables must be positive", GSL_EINVAL);
+    }
+
+  w = calloc (1, sizeof (gsl_stats_covmat_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->p = p;
+  w->nblock = COVMAT_BLOCK;
+  w->flags = flags;
+
+  w->mean = gsl_vector_alloc (p);
+  w->shift = gsl_vector_alloc (p);
+  w->Q = gsl_matrix_alloc (p, p);
+  w->work = gsl_matrix_alloc (w->nblock, p);
+
+  if (w->mean == 0 || w->shift == 0 || w->Q == 0 || w->work == 0)
+    {
+      gsl_stats_covmat_free (w);
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  if (flags & GSL_STATS_PAIRWISE)
+    {
+      w->N = gsl_matrix_alloc (p, p);
+      w->S = gsl_matrix_alloc (p, p);
+      w->T = gsl_matrix_alloc (p, p);
+      w->mask = gsl_matrix_alloc (w->nblock, p);
+      w->work2 = gsl_matrix_alloc (w->nblock, p);
+      w->shift_set = malloc (p);
+
+      if (w->N == 0 || w->S == 0 || w->T == 0 || w->mask == 0 ||
+          w->work2 == 0 || w->shift_set == 0)
+        {
+          gsl_stats_covmat_free (w);
+          GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+        }
+    }
+
+  gsl_stats_covmat_reset (w);
+
+  return w;
+}
+
+void
+gsl_stats_covmat_free (gsl_stats_covmat_workspace * w)
+{
+  RETURN_IF_NULL (w);
+
+  if (w->mean)
+    gsl_vector_free (w->mean);
+
+  if (w->shift)
+    gsl_vector_free (w->shift);
+
+  if (w->Q)
+    gsl_matrix_free (w->Q);
+
+  if (w->work)
+    gsl_matrix_free (w->work);
+
+  if (w->N)
+    gsl_matrix_free (w->N);
+
+  if (w->S)
+    gsl_matrix_free (w->S);
+
+  if (w->T)
+    gsl_matrix_free (w->T);
+
+  if (w->mask)
+    gsl_matrix_free (w->mask);
+
+  if (w->work2)
+    gsl_matrix_free (w->work2);
+
+  if (w->shift_set)
+    free (w->shift_set);
+
+  free (w);
+}
+
+int
+gsl_stats_covmat_reset (gsl_stats_covmat_workspace * w)
+{
+  w->n = 0;
+  gsl_vector_set_zero (w->mean);
+  gsl_matrix_set_zero (w->Q);
+
+  if (w->flags & GSL_STATS_PAIRWISE)
+    {
+      size_t j;
+
+      gsl_matrix_set_zero (w->N);
+      gsl_matrix_set_zero (w->S);
+      gsl_matrix_set_zero (w->T);
+
+      for (j = 0; j < w->p; ++j)
+        w->shift_set[j] = 0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/*
+gsl_stats_covmat_accumulate()
+  Add the rows of X to the accumulated statistics
+
+Inputs: X - block of observations, n-by-p; row i is observation i
+        w - workspace
+*/
+
+int
+gsl_stats_covmat_accumulate (const gsl_matrix * X, gsl_stats_covmat_workspace * w)
+{
+  if (X->size2 != w->p)
+    {
+      GSL_ERROR ("number of columns of X must match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = X->size1;
+      size_t i;
+
+      for (i = 0; i < n; i += w->nblock)
+        {
+          const size_t m = GSL_MIN (w->nblock, n - i);
+          gsl_matrix_const_view Xb = gsl_matrix_const_submatrix (X, i, 0, m, w->p);
+          int status;
+
+          if (w->flags & GSL_STATS_PAIRWISE)
+            status = covmat_block_pairwise (&Xb.matrix, w);
+          else
+            status = covmat_block (&Xb.matrix, w);
+
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_stats_covmat_mean()
+  Return the column means of the accumulated data. With pairwise-complete
+NaN handling, the mean of column j is over all rows with x_j present.
+*/
+
+int
+gsl_stats_covmat_mean (gsl_vector * mean, const gsl_stats_covmat_workspace * w)
+{
+  if (mean->size != w->p)
+    {
+      GSL_ERROR ("mean vector has wrong size", GSL_EBADLEN);
+    }
+  else if (w->flags & GSL_STATS_PAIRWISE)
+    {
+      size_t j;
+
+      for (j = 0; j < w->p; ++j)
+        {
+          const double njj = gsl_matrix_get (w->N, j, j);
+          double mj = GSL_NAN;
+
+          if (njj > 0.0)
+            mj = gsl_vector_get (w->shift, j) + gsl_matrix_get (w->S, j, j) / njj;
+
+          gsl_vector_set (mean, j, mj);
+        }
+
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      return gsl_vector_memcpy (mean, w->mean);
+    }
+}
+
+/*
+gsl_stats_covmat_covariance()
+  Compute the sample covariance matrix of the accumulated data
+
+Inputs: C - (output) covariance matrix, p-by-p
+        w - workspace
+
+Notes: with pairwise-complete NaN handling, elements for pairs of
+columns with fewer than two common rows are set to NaN
+*/
+
+int
+gsl_stats_covmat_covariance (gsl_matrix * C, const gsl_stats_covmat_workspace * w)
+{
+  const size_t p = w->p;
+
+  if (C->size1 != p || C->size2 != p)
+    {
+      GSL_ERROR ("covariance matrix must be p-by-p", GSL_EBADLEN);
+    }
+  else if (w->flags & GSL_STATS_PAIRWISE)
+    {
+      size_t i, j;
+
+      for (i = 0; i < p; ++i)
+        {
+          for (j = 0; j <= i; ++j)
+            {
+              const double nij = gsl_matrix_get (w->N, i, j);
+              double cij = GSL_NAN;
+
+              if (nij > 1.0)
+                {
+                  const double sij = gsl_matrix_get (w->S, i, j);
+                  const double sji = gsl_matrix_get (w->S, j, i);
+
+                  cij = (gsl_matrix_get (w->Q, i, j) - sij * sji / nij) / (nij - 1.0);
+                }
+
+              gsl_matrix_set (C, i, j, cij);
+              gsl_matrix_set (C, j, i, cij);
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+  else if (w->n < 2)
+    {
+      GSL_ERROR ("at least two observations are required", GSL_EDOM);
+    }
+  else
+    {
+      const double alpha = 1.0 / (w->n - 1.0);
+      size_t i, j;
+
+      for (i = 0; i < p; ++i)
+        {
+          for (j = 0; j <= i; ++j)
+            {
+              const double cij = alpha * gsl_matrix_get (w->Q, i, j);
+
+              gsl_matrix_set (C, i, j, cij);
+              gsl_matrix_set (C, j, i, cij);
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_stats_covmat_correlation()
+  Compute the Pearson correlation matrix of the accumulated data
+
+Inputs: R - (output) correlation matrix, p-by-p
+        w - workspace
+
+Notes: with pairwise-complete NaN handling, the correlation of columns
+i and j uses the means and variances over the rows where both are present
+*/
+
+int
+gsl_stats_covmat_correlation (gsl_matrix * R, const gsl_stats_covmat_workspace * w)
+{
+  const size_t p = w->p;
+
+  if (R->size1 != p || R->size2 != p)
+    {
+      GSL_ERROR ("correlation matrix must be p-by-p", GSL_EBADLEN);
+    }
+  else if (w->flags & GSL_STATS_PAIRWISE)
+    {
+      size_t i, j;
+
+      for (i = 0; i < p; ++i)
+        {
+          for (j = 0; j <= i; ++j)
+            {
+              const double nij = gsl_matrix_get (w->N, i, j);
+              double rij = GSL_NAN;
+
+              if (nij > 1.0)
+                {
+                  const double sij = gsl_matrix_get (w->S, i, j);
+                  const double sji = gsl_matrix_get (w->S, j, i);
+                  const double qij = gsl_matrix_get (w->Q, i, j) - sij * sji / nij;
+                  const double sxx = gsl_matrix_get (w->T, i, j) - sij * sij / nij;
+                  const double syy = gsl_matrix_get (w->T, j, i) - sji * sji / nij;
+
+                  rij = qij / (sqrt (sxx) * sqrt (syy));
+
+                  if (i == j && gsl_finite (rij))
+                    rij = 1.0;
+                }
+
+              gsl_matrix_set (R, i, j, rij);
+              gsl_matrix_set (R, j, i, rij);
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+  else if (w->n < 2)
+    {
+      GSL_ERROR ("at least two observations are required", GSL_EDOM);
+    }
+  else
+    {
+      size_t i, j;
+
+      for (i = 0; i < p; ++i)
+        {
+          const double di = sqrt (gsl_matrix_get (w->Q, i, i));
+
+          for (j = 0; j < i; ++j)
+            {
+              const double dj = sqrt (gsl_matrix_get (w->Q, j, j));
+              const double rij = gsl_matrix_get (w->Q, i, j) / (di * dj);
+
+              gsl_matrix_set (R, i, j, rij);
+              gsl_matrix_set (R, j, i, rij);
+            }
+
+          gsl_matrix_set (R, i, i, (di > 0.0) ? 1.0 : GSL_NAN);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_stats_covariance_matrix()
+  Compute the covariance matrix of the columns of X
+
+Inputs: X     - data matrix, n-by-p
+        flags - 0 or GSL_STATS_PAIRWISE
+        C     - (output) covariance matrix, p-by-p
+*/
+
+int
+gsl_stats_covariance_matrix (const gsl_matrix * X, const int flags, gsl_matrix * C)
+{
+  gsl_stats_covmat_workspace *w = gsl_stats_covmat_alloc (X->size2, flags);
+  int status;
+
+  if (w == 0)
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_stats_covmat_accumulate (X, w);
+  if (!status)
+    status = gsl_stats_covmat_covariance (C, w);
+
+  gsl_stats_covmat_free (w);
+
+  return status;
+}
+
+/*
+gsl_stats_correlation_matrix()
+  Compute the Pearson correlation matrix of the columns of X
+
+Inputs: X     - data matrix, n-by-p
+        flags - 0 or GSL_STATS_PAIRWISE
+        R     - (output) correlation matrix, p-by-p
+*/
+
+int
+gsl_stats_correlation_matrix (const gsl_matrix * X, const int flags, gsl_matrix * R)
+{
+  gsl_stats_covmat_workspace *w = gsl_stats_covmat_alloc (X->size2, flags);
+  int status;
+
+  if (w == 0)
+    {
+      GSL_ERROR ("failed to allocate workspace", GSL_ENOMEM);
+    }
+
+  status = gsl_stats_covmat_accumulate (X, w);
+  if (!status)
+    status = gsl_stats_covmat_correlation (R, w);
+
+  gsl_stats_covmat_free (w);
+
+  return status;
+}
+
+/*
+gsl_stats_spearman_matrix()
+  Compute the Spearman rank correlation matrix of the columns of X
+
+Inputs: X     - data matrix, n-by-p
+        flags - 0 or GSL_STATS_PAIRWISE
+        R     - (output) correlation matrix, p-by-p
+
+Notes: each column is ranked once, with ties given their average rank,
+and the Pearson correlation matrix of the ranks is computed. With
+GSL_STATS_PAIRWISE, a pair of columns of which one contains NaN
+elements is instead ranked again over the rows where both are present,
+as gsl_stats_spearman would rank them
+*/
+
+int
+gsl_stats_spearman_matrix (const gsl_matrix * X, const int flags, gsl_matrix * R)
+{
+  const size_t n = X->size1;
+  const size_t p = X->size2;
+  gsl_matrix *ranks;
+  double *tmp, *pair = NULL;
+  size_t *rows, *perm, *count;
+  size_t i, j, k;
+  int status;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("at least two observations are required", GSL_EDOM);
+    }
+
+  ranks = gsl_matrix_alloc (n, p);
+  tmp = malloc (n * sizeof (double));
+  rows = malloc (n * sizeof (size_t));
+  perm = malloc (n * sizeof (size_t));
+  count = malloc (p * sizeof (size_t));
+
+  if (flags & GSL_STATS_PAIRWISE)
+    pair = malloc (4 * n * sizeof (double));
+
+  if (ranks == 0 || tmp == 0 || rows == 0 || perm == 0 || count == 0 ||
+      ((flags & GSL_STATS_PAIRWISE) && pair == 0))
+    {
+      if (ranks)
+        gsl_matrix_free (ranks);
+
+      free (tmp);
+      free (rows);
+      free (perm);
+      free (count);
+      free (pair);
+
+      GSL_ERROR ("failed to allocate space for ranks", GSL_ENOMEM);
+    }
+
+  gsl_matrix_memcpy (ranks, X);
+
+  for (j = 0; j < p; ++j)
+    count[j] = covmat_rank (n, ranks->data + j, ranks->tda, tmp, rows, perm);
+
+  /* pairs of complete columns, and the diagonal, are correct here */
+  status = gsl_stats_correlation_matrix (ranks, flags, R);
+
+  if (status == GSL_SUCCESS && (flags & GSL_STATS_PAIRWISE))
+    {
+      double *xs = pair;
+      double *ys = pair + n;
+      double *work = pair + 2 * n;
+
+      for (i = 0; i < p; ++i)
+        {
+          for (j = 0; j < i; ++j)
+            {
+              double rij = GSL_NAN;
+              size_t m = 0;
+
+              if (count[i] == n && count[j] == n)
+                continue;
+
+              for (k = 0; k < n; ++k)
+                {
+                  const double xki = gsl_matrix_get (X, k, i);
+                  const double xkj = gsl_matrix_get (X, k, j);
+
+                  if (!gsl_isnan (xki) && !gsl_isnan (xkj))
+                    {
+                      xs[m] = xki;
+                      ys[m] = xkj;
+                      ++m;
+                    }
+                }
+
+              if (m > 1)
+                rij = gsl_stats_spearman (xs, 1, ys, 1, m, work);
+
+              gsl_matrix_set (R, i, j, rij);
+              gsl_matrix_set (R, j, i, rij);
+            }
+        }
+    }
+
+  gsl_matrix_free (ranks);
+  free (tmp);
+  free (rows);
+  free (perm);
+  free (count);
+  free (pair);
+
+  return status;
+}
+
+/*
+gsl_stats_kendall_matrix()
+  Compute the Kendall tau-b rank correlation matrix of the columns of X
+
+Inputs: X     - data matrix, n-by-p
+        flags - 0 or GSL_STATS_PAIRWISE
+        R     - (output) correlation matrix, p-by-p
+
+Notes: each column is ranked and its sort order is stored once. For a
+pair of columns (i,j), the ranks of column j are gathered in the order
+of column i, so that only the merge sort of Knight's algorithm is
+performed per pair
+*/
+
+int
+gsl_stats_kendall_matrix (const gsl_matrix * X, const int flags, gsl_matrix * R)
+{
+  const size_t n = X->size1;
+  const size_t p = X->size2;
+  gsl_matrix *ranks;
+  size_t *order, *count, *rows, *perm;
+  double *xs, *ys, *buf;
+  size_t i, j, k;
+
+  if (R->size1 != p || R->size2 != p)
+    {
+      GSL_ERROR ("correlation matrix must be p-by-p", GSL_EBADLEN);
+    }
+
+  ranks = gsl_matrix_alloc (GSL_MAX (n, 1), p);
+  order = malloc (GSL_MAX (n, 1) * p * sizeof (size_t));
+  count = malloc (p * sizeof (size_t));
+  rows = malloc (GSL_MAX (n, 1) * sizeof (size_t));
+  perm = malloc (GSL_MAX (n, 1) * sizeof (size_t));
+  xs = malloc (GSL_MAX (n, 1) * sizeof (double));
+  ys = malloc (GSL_MAX (n, 1) * sizeof (double));
+  buf = malloc (GSL_MAX (n, 1) * sizeof (double));
+
+  if (ranks == 0 || order == 0 || count == 0 || rows == 0 || perm == 0 ||
+      xs == 0 || ys == 0 || buf == 0)
+    {
+      if (ranks)
+        gsl_matrix_free (ranks);
+
+      free (order);
+      free (count);
+      free (rows);
+      free (perm);
+      free (xs);
+      free (ys);
+      free (buf);
+
+      GSL_ERROR ("failed to allocate space for ranks", GSL_ENOMEM);
+    }
+
+  /* rank each column and store its sort order */
+  for (j = 0; j < p; ++j)
+    {
+      size_t *oj = order + j * n;
+
+      for (i = 0; i < n; ++i)
+        gsl_matrix_set (ranks, i, j, gsl_matrix_get (X, i, j));
+
+      count[j] = covmat_rank (n, ranks->data + j, ranks->tda, xs, rows, perm);
+
+      for (k = 0; k < count[j]; ++k)
+        oj[k] = rows[perm[k]];
+    }
+
+  for (i = 0; i < p; ++i)
+    {
+      const size_t *oi = order + i * n;
+
+      for (j = 0; j <= i; ++j)
+        {
+          double tau = GSL_NAN;
+          size_t m = 0;
+
+          if ((flags & GSL_STATS_PAIRWISE) || (count[i] == n && count[j] == n))
+            {
+              for (k = 0; k < count[i]; ++k)
+                {
+                  const double yk = gsl_matrix_get (ranks, oi[k], j);
+
+                  if (!gsl_isnan (yk))
+                    {
+                      xs[m] = gsl_matrix_get (ranks, oi[k], i);
+                      ys[m] = yk;
+                      ++m;
+                    }
+                }
+
+              tau = kendall_sorted (m, xs, ys, buf);
+            }
+
+          gsl_matrix_set (R, i, j, tau);
+          gsl_matrix_set (R, j, i, tau);
+        }
+    }
+
+  gsl_matrix_free (ranks);
+  free (order);
+  free (count);
+  free (rows);
+  free (perm);
+  free (xs);
+  free (ys);
+  free (buf);
+
+  return GSL_SUCCESS;
+}
+
+/* accumulate a block of at most nblock rows */
+static int
+covmat_block (const gsl_matrix * X, gsl_stats_covmat_workspace * w)
+{
+  const size_t m = X->size1;
+  const size_t p = w->p;
+  gsl_matrix_view Z = gsl_matrix_submatrix (w->work, 0, 0, m, p);
+  gsl_vector_view delta = gsl_matrix_row (w->work, 0);
+  gsl_vector *mu = w->shift;
+  const double n = (double) w->n + (double) m;
+  size_t i, j;
+
+  /* center the block by its column means */
+  gsl_matrix_memcpy (&Z.matrix, X);
+
+  for (j = 0; j < p; ++j)
+    {
+      gsl_vector_view c = gsl_matrix_column (&Z.matrix, j);
+      long double sum = 0.0;
+      double mj;
+
+      for (i = 0; i < m; ++i)
+        sum += gsl_vector_get (&c.vector, i);
+
+      mj = sum / m;
+      gsl_vector_set (mu, j, mj);
+      gsl_vector_add_constant (&c.vector, -mj);
+    }
+
+  /* Q += Z^T Z */
+  gsl_blas_dsyrk (CblasLower, CblasTrans, 1.0, &Z.matrix, 1.0, w->Q);
+
+  if (w->n == 0)
+    {
+      gsl_vector_memcpy (w->mean, mu);
+    }
+  else
+    {
+      /* Q += (n_a n_b / n) delta delta^T, mean += (n_b / n) delta */
+      gsl_vector_memcpy (&delta.vector, mu);
+      gsl_vector_sub (&delta.vector, w->mean);
+      gsl_blas_dsyr (CblasLower, (double) w->n * (double) m / n, &delta.vector, w->Q);
+      gsl_blas_daxpy ((double) m / n, &delta.vector, w->mean);
+    }
+
+  w->n += m;
+
+  return GSL_SUCCESS;
+}
+
+/* accumulate a block of at most nblock rows with pairwise-complete NaN handling */
+static int
+covmat_block_pairwise (const gsl_matrix * X, gsl_stats_covmat_workspace * w)
+{
+  const size_t m = X->size1;
+  const size_t p = w->p;
+  gsl_matrix_view Z = gsl_matrix_submatrix (w->work, 0, 0, m, p);
+  gsl_matrix_view Z2 = gsl_matrix_submatrix (w->work2, 0, 0, m, p);
+  gsl_matrix_view M = gsl_matrix_submatrix (w->mask, 0, 0, m, p);
+  size_t i, j;
+
+  for (j = 0; j < p; ++j)
+    {
+      double shift;
+
+      if (!w->shift_set[j])
+        {
+          long double sum = 0.0;
+          size_t cnt = 0;
+
+          for (i = 0; i < m; ++i)
+            {
+              const double xij = gsl_matrix_get (X, i, j);
+
+              if (!gsl_isnan (xij))
+                {
+                  sum += xij;
+                  ++cnt;
+                }
+            }
+
+          if (cnt > 0)
+            {
+              gsl_vector_set (w->shift, j, sum / cnt);
+              w->shift_set[j] = 1;
+            }
+        }
+
+      shift = gsl_vector_get (w->shift, j);
+
+      for (i = 0; i < m; ++i)
+        {
+          const double xij = gsl_matrix_get (X, i, j);
+
+          if (gsl_isnan (xij))
+            {
+              gsl_matrix_set (&Z.matrix, i, j, 0.0);
+              gsl_matrix_set (&Z2.matrix, i, j, 0.0);
+              gsl_matrix_set (&M.matrix, i, j, 0.0);
+            }
+          else
+            {
+              const double zij = xij - shift;
+
+              gsl_matrix_set (&Z.matrix, i, j, zij);
+              gsl_matrix_set (&Z2.matrix, i, j, zij * zij);
+              gsl_matrix_set (&M.matrix, i, j, 1.0);
+            }
+        }
+    }
+
+  gsl_blas_dsyrk (CblasLower, CblasTrans, 1.0, &M.matrix, 1.0, w->N);
+  gsl_blas_dsyrk (CblasLower, CblasTrans, 1.0, &Z.matrix, 1.0, w->Q);
+  gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Z.matrix, &M.matrix, 1.0, w->S);
+  gsl_blas_dgemm (CblasTrans, CblasNoTrans, 1.0, &Z2.matrix, &M.matrix, 1.0, w->T);
+
+  w->n += m;
+
+  return GSL_SUCCESS;
+}
+
+/*
+covmat_rank()
+  Replace the non-NaN elements of v by their ranks, with ties given
+their average rank. NaN elements are unchanged.
+
+Inputs: n      - length of v
+        v      - data on input, ranks on output
+        stride - stride of v
+        tmp    - workspace, length n
+        rows   - workspace, length n
+        perm   - workspace, length n; on output rows[perm[k]], k < m,
+                 are the indices of the non-NaN elements of v in
+                 ascending order
+
+Return: number m of non-NaN elements
+*/
+
+static size_t
+covmat_rank (const size_t n, double * v, const size_t stride,
+             double * tmp, size_t * rows, size_t * perm)
+{
+  size_t i, k, m = 0;
+
+  for (i = 0; i < n; ++i)
+    {
+      const double vi = v[i * stride];
+
+      if (!gsl_isnan (vi))
+        {
+          tmp[m] = vi;
+          rows[m] = i;
+          ++m;
+        }
+    }
+
+  gsl_sort_index (perm, tmp, 1, m);
+
+  i = 0;
+  while (i < m)
+    {
+      const double vi = tmp[perm[i]];
+      size_t j = i + 1;
+      double rank;
+
+      while (j < m && tmp[perm[j]] == vi)
+        ++j;
+
+      /* elements i..j-1 are tied; average of ranks i+1, ..., j */
+      rank = 0.5 * (i + 1.0 + j);
+
+      for (k = i; k < j; ++k)
+        v[rows[perm[k]] * stride] = rank;
+
+      i = j;
+    }
+
+  return m;
+}
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_char_lag1_autocorrelation (const char data[], const size_t stri
 double gsl_stats_char_covariance (const char data1[], const size_t stride1,const char data2[], const size_t stride2, const size_t n);
 double gsl_stats_char_correlation (const char data1[], const size_t stride1,const char data2[], const size_t stride2, const size_t n);
 double gsl_stats_char_spearman (const char data1[], const size_t stride1, const char data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_char_kendall (const char data1[], const size_t stride1, const char data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_char_variance_m (const char data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_char_sd_m (const char data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ char gsl_stats_char_max (const char data[], const size_t stride, const size_t n)
 char gsl_stats_char_min (const char data[], const size_t stride, const size_t n);
 void gsl_stats_char_minmax (char * min, char * max, const char data[], const size_t stride, const size_t n);
 
+void gsl_stats_char_summary (double * mean, double * variance, double * skew, double * kurtosis, char * min, char * max, const char data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_char_max_index (const char data[], const size_t stride, const size_t n);
 size_t gsl_stats_char_min_index (const char data[], const size_t stride, const size_t n);
 void gsl_stats_char_minmax_index (size_t * min_index, size_t * max_index, const char data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ char gsl_stats_char_select(char data[], const size_t stride, const size_t n, con
 double gsl_stats_char_median_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_median (char sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_char_quantile_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_char_quantiles (char data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_char_trmean_from_sorted_data (const double trim, const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_gastwirth_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_char_Sn_from_sorted_data (const char sorted_data[], const size_
 char gsl_stats_char_Qn0_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
 double gsl_stats_char_Qn_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, char work[], int work_int[]) ;
 
+int gsl_stats_char_mad_columns (const char data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_char_Sn_columns (const char data[], const size_t tda, const size_t n, const size_t ncols, double result[], char work[], const size_t lwork);
+int gsl_stats_char_Qn_columns (const char data[], const size_t tda, const size_t n, const size_t ncols, double result[], char work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_CHAR_H__ */
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_lag1_autocorrelation (const double data[], const size_t stride,
 double gsl_stats_covariance (const double data1[], const size_t stride1,const double data2[], const size_t stride2, const size_t n);
 double gsl_stats_correlation (const double data1[], const size_t stride1,const double data2[], const size_t stride2, const size_t n);
 double gsl_stats_spearman (const double data1[], const size_t stride1, const double data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_kendall (const double data1[], const size_t stride1, const double data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_variance_m (const double data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_sd_m (const double data[], const size_t stride, const size_t n, const double mean);
@@ -80,6 +82,8 @@ double gsl_stats_wabsdev_m (const double w[], const size_t wstride, const double
 double gsl_stats_wskew_m_sd (const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 double gsl_stats_wkurtosis_m_sd (const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 
+void gsl_stats_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n);
+
 /* END OF FLOATING POINT TYPES */
 
 double gsl_stats_pvariance (const double data1[], const size_t stride1, const size_t n1, const double data2[], const size_t stride2, const size_t n2);
@@ -89,6 +93,8 @@ double gsl_stats_max (const double data[], const size_t stride, const size_t n);
 double gsl_stats_min (const double data[], const size_t stride, const size_t n);
 void gsl_stats_minmax (double * min, double * max, const double data[], const size_t stride, const size_t n);
 
+void gsl_stats_summary (double * mean, double * variance, double * skew, double * kurtosis, double * min, double * max, const double data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_max_index (const double data[], const size_t stride, const size_t n);
 size_t gsl_stats_min_index (const double data[], const size_t stride, const size_t n);
 void gsl_stats_minmax_index (size_t * min_index, size_t * max_index, const double data[], const size_t stride, const size_t n);
@@ -98,6 +104,8 @@ double gsl_stats_select(double data[], const size_t stride, const size_t n, cons
 double gsl_stats_median_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_median (double sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_quantile_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_quantiles (double data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
+int gsl_stats_wquantiles (double w[], const size_t wstride, double data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_trmean_from_sorted_data (const double trim, const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_gastwirth_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
@@ -111,6 +119,11 @@ double gsl_stats_Sn_from_sorted_data (const double sorted_data[], const size_t s
 double gsl_stats_Qn0_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
 double gsl_stats_Qn_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, double work[], int work_int[]) ;
 
+int gsl_stats_mad_columns (const double data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_Sn_columns (const double data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_Qn_columns (const double data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_DOUBLE_H__ */
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_float_lag1_autocorrelation (const float data[], const size_t st
 double gsl_stats_float_covariance (const float data1[], const size_t stride1,const float data2[], const size_t stride2, const size_t n);
 double gsl_stats_float_correlation (const float data1[], const size_t stride1,const float data2[], const size_t stride2, const size_t n);
 double gsl_stats_float_spearman (const float data1[], const size_t stride1, const float data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_float_kendall (const float data1[], const size_t stride1, const float data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_float_variance_m (const float data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_float_sd_m (const float data[], const size_t stride, const size_t n, const double mean);
@@ -80,6 +82,8 @@ double gsl_stats_float_wabsdev_m (const float w[], const size_t wstride, const f
 double gsl_stats_float_wskew_m_sd (const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 double gsl_stats_float_wkurtosis_m_sd (const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 
+void gsl_stats_float_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n);
+
 /* END OF FLOATING POINT TYPES */
 
 double gsl_stats_float_pvariance (const float data1[], const size_t stride1, const size_t n1, const float data2[], const size_t stride2, const size_t n2);
@@ -89,6 +93,8 @@ float gsl_stats_float_max (const float data[], const size_t stride, const size_t
 float gsl_stats_float_min (const float data[], const size_t stride, const size_t n);
 void gsl_stats_float_minmax (float * min, float * max, const float data[], const size_t stride, const size_t n);
 
+void gsl_stats_float_summary (double * mean, double * variance, double * skew, double * kurtosis, float * min, float * max, const float data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_float_max_index (const float data[], const size_t stride, const size_t n);
 size_t gsl_stats_float_min_index (const float data[], const size_t stride, const size_t n);
 void gsl_stats_float_minmax_index (size_t * min_index, size_t * max_index, const float data[], const size_t stride, const size_t n);
@@ -98,6 +104,8 @@ float gsl_stats_float_select(float data[], const size_t stride, const size_t n,
 double gsl_stats_float_median_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_median (float sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_float_quantile_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_float_quantiles (float data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
+int gsl_stats_float_wquantiles (float w[], const size_t wstride, float data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_float_trmean_from_sorted_data (const double trim, const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_gastwirth_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
@@ -111,6 +119,11 @@ double gsl_stats_float_Sn_from_sorted_data (const float sorted_data[], const siz
 float gsl_stats_float_Qn0_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
 double gsl_stats_float_Qn_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, float work[], int work_int[]) ;
 
+int gsl_stats_float_mad_columns (const float data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_float_Sn_columns (const float data[], const size_t tda, const size_t n, const size_t ncols, double result[], float work[], const size_t lwork);
+int gsl_stats_float_Qn_columns (const float data[], const size_t tda, const size_t n, const size_t ncols, double result[], float work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_FLOAT_H__ */
@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_int_lag1_autocorrelation (const int data[], const size_t stride
 double gsl_stats_int_covariance (const int data1[], const size_t stride1,const int data2[], const size_t stride2, const size_t n);
 double gsl_stats_int_correlation (const int data1[], const size_t stride1,const int data2[], const size_t stride2, const size_t n);
 double gsl_stats_int_spearman (const int data1[], const size_t stride1, const int data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_int_kendall (const int data1[], const size_t stride1, const int data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_int_variance_m (const int data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_int_sd_m (const int data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ int gsl_stats_int_max (const int data[], const size_t stride, const size_t n);
 int gsl_stats_int_min (const int data[], const size_t stride, const size_t n);
 void gsl_stats_int_minmax (int * min, int * max, const int data[], const size_t stride, const size_t n);
 
+void gsl_stats_int_summary (double * mean, double * variance, double * skew, double * kurtosis, int * min, int * max, const int data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_int_max_index (const int data[], const size_t stride, const size_t n);
 size_t gsl_stats_int_min_index (const int data[], const size_t stride, const size_t n);
 void gsl_stats_int_minmax_index (size_t * min_index, size_t * max_index, const int data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ int gsl_stats_int_select(int data[], const size_t stride, const size_t n, const
 double gsl_stats_int_median_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_int_median (int sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_int_quantile_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_int_quantiles (int data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_int_trmean_from_sorted_data (const double trim, const int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_int_gastwirth_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_int_Sn_from_sorted_data (const int sorted_data[], const size_t
 int gsl_stats_int_Qn0_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, int work[], int work_int[]) ;
 double gsl_stats_int_Qn_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, int work[], int work_int[]) ;
 
+int gsl_stats_int_mad_columns (const int data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_int_Sn_columns (const int data[], const size_t tda, const size_t n, const size_t ncols, double result[], int work[], const size_t lwork);
+int gsl_stats_int_Qn_columns (const int data[], const size_t tda, const size_t n, const size_t ncols, double result[], int work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_INT_H__ */
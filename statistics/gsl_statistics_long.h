@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_long_lag1_autocorrelation (const long data[], const size_t stri
 double gsl_stats_long_covariance (const long data1[], const size_t stride1,const long data2[], const size_t stride2, const size_t n);
 double gsl_stats_long_correlation (const long data1[], const size_t stride1,const long data2[], const size_t stride2, const size_t n);
 double gsl_stats_long_spearman (const long data1[], const size_t stride1, const long data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_long_kendall (const long data1[], const size_t stride1, const long data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_long_variance_m (const long data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_long_sd_m (const long data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ long gsl_stats_long_max (const long data[], const size_t stride, const size_t n)
 long gsl_stats_long_min (const long data[], const size_t stride, const size_t n);
 void gsl_stats_long_minmax (long * min, long * max, const long data[], const size_t stride, const size_t n);
 
+void gsl_stats_long_summary (double * mean, double * variance, double * skew, double * kurtosis, long * min, long * max, const long data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_long_max_index (const long data[], const size_t stride, const size_t n);
 size_t gsl_stats_long_min_index (const long data[], const size_t stride, const size_t n);
 void gsl_stats_long_minmax_index (size_t * min_index, size_t * max_index, const long data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ long gsl_stats_long_select(long data[], const size_t stride, const size_t n, con
 double gsl_stats_long_median_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_median (long sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_long_quantile_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_quantiles (long data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_long_trmean_from_sorted_data (const double trim, const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_gastwirth_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_long_Sn_from_sorted_data (const long sorted_data[], const size_
 long gsl_stats_long_Qn0_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
 double gsl_stats_long_Qn_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, long work[], int work_int[]) ;
 
+int gsl_stats_long_mad_columns (const long data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_long_Sn_columns (const long data[], const size_t tda, const size_t n, const size_t ncols, double result[], long work[], const size_t lwork);
+int gsl_stats_long_Qn_columns (const long data[], const size_t tda, const size_t n, const size_t ncols, double result[], long work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_LONG_H__ */
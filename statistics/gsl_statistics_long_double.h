@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_long_double_lag1_autocorrelation (const long double data[], con
 double gsl_stats_long_double_covariance (const long double data1[], const size_t stride1,const long double data2[], const size_t stride2, const size_t n);
 double gsl_stats_long_double_correlation (const long double data1[], const size_t stride1,const long double data2[], const size_t stride2, const size_t n);
 double gsl_stats_long_double_spearman (const long double data1[], const size_t stride1, const long double data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_long_double_kendall (const long double data1[], const size_t stride1, const long double data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_long_double_variance_m (const long double data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_long_double_sd_m (const long double data[], const size_t stride, const size_t n, const double mean);
@@ -80,6 +82,8 @@ double gsl_stats_long_double_wabsdev_m (const long double w[], const size_t wstr
 double gsl_stats_long_double_wskew_m_sd (const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 double gsl_stats_long_double_wkurtosis_m_sd (const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n, const double wmean, const double wsd);
 
+void gsl_stats_long_double_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n);
+
 /* END OF FLOATING POINT TYPES */
 
 double gsl_stats_long_double_pvariance (const long double data1[], const size_t stride1, const size_t n1, const long double data2[], const size_t stride2, const size_t n2);
@@ -89,6 +93,8 @@ long double gsl_stats_long_double_max (const long double data[], const size_t st
 long double gsl_stats_long_double_min (const long double data[], const size_t stride, const size_t n);
 void gsl_stats_long_double_minmax (long double * min, long double * max, const long double data[], const size_t stride, const size_t n);
 
+void gsl_stats_long_double_summary (double * mean, double * variance, double * skew, double * kurtosis, long double * min, long double * max, const long double data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_long_double_max_index (const long double data[], const size_t stride, const size_t n);
 size_t gsl_stats_long_double_min_index (const long double data[], const size_t stride, const size_t n);
 void gsl_stats_long_double_minmax_index (size_t * min_index, size_t * max_index, const long double data[], const size_t stride, const size_t n);
@@ -98,6 +104,8 @@ long double gsl_stats_long_double_select(long double data[], const size_t stride
 double gsl_stats_long_double_median_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_median (long double sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_long_double_quantile_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_double_quantiles (long double data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
+int gsl_stats_long_double_wquantiles (long double w[], const size_t wstride, long double data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_long_double_trmean_from_sorted_data (const double trim, const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_gastwirth_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
@@ -111,6 +119,11 @@ double gsl_stats_long_double_Sn_from_sorted_data (const long double sorted_data[
 long double gsl_stats_long_double_Qn0_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
 double gsl_stats_long_double_Qn_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, long double work[], int work_int[]) ;
 
+int gsl_stats_long_double_mad_columns (const long double data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_long_double_Sn_columns (const long double data[], const size_t tda, const size_t n, const size_t ncols, double result[], long double work[], const size_t lwork);
+int gsl_stats_long_double_Qn_columns (const long double data[], const size_t tda, const size_t n, const size_t ncols, double result[], long double work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_LONG_DOUBLE_H__ */
@@ -0,0 +1,77 @@
+/* statistics/gsl_statistics_matrix.h
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_STATISTICS_MATRIX_H__
+#define __GSL_STATISTICS_MATRIX_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* flags */
+#define GSL_STATS_PAIRWISE   (1 << 0) /* pairwise-complete NaN handling */
+
+typedef struct
+{
+  size_t p;         /* number of variables (columns) */
+  size_t nblock;    /* number of rows processed per block */
+  int flags;
+  size_t n;         /* number of rows accumulated */
+  gsl_vector *mean; /* column means */
+  gsl_matrix *Q;    /* centered cross products (lower triangle), p-by-p */
+  gsl_matrix *work; /* centered row block, nblock-by-p */
+
+  /* pairwise-complete accumulators, only with GSL_STATS_PAIRWISE */
+  gsl_matrix *N;    /* N_ij = number of rows with x_i and x_j present (lower) */
+  gsl_matrix *S;    /* S_ij = sum of z_i over rows with x_i and x_j present */
+  gsl_matrix *T;    /* T_ij = sum of z_i^2 over rows with x_i and x_j present */
+  gsl_matrix *mask; /* presence indicators of row block, nblock-by-p */
+  gsl_matrix *work2;/* squares of shifted row block, nblock-by-p */
+  gsl_vector *shift;/* per-column shift z = x - shift */
+  char *shift_set;  /* whether shift has been set for each column */
+} gsl_stats_covmat_workspace;
+
+gsl_stats_covmat_workspace *gsl_stats_covmat_alloc (const size_t p, const int flags);
+void gsl_stats_covmat_free (gsl_stats_covmat_workspace * w);
+int gsl_stats_covmat_reset (gsl_stats_covmat_workspace * w);
+int gsl_stats_covmat_accumulate (const gsl_matrix * X, gsl_stats_covmat_workspace * w);
+int gsl_stats_covmat_mean (gsl_vector * mean, const gsl_stats_covmat_workspace * w);
+int gsl_stats_covmat_covariance (gsl_matrix * C, const gsl_stats_covmat_workspace * w);
+int gsl_stats_covmat_correlation (gsl_matrix * R, const gsl_stats_covmat_workspace * w);
+
+int gsl_stats_covariance_matrix (const gsl_matrix * X, const int flags, gsl_matrix * C);
+int gsl_stats_correlation_matrix (const gsl_matrix * X, const int flags, gsl_matrix * R);
+int gsl_stats_spearman_matrix (const gsl_matrix * X, const int flags, gsl_matrix * R);
+int gsl_stats_kendall_matrix (const gsl_matrix * X, const int flags, gsl_matrix * R);
+
+__END_DECLS
+
+#endif /* __GSL_STATISTICS_MATRIX_H__ */
@@ -0,0 +1,33 @@
+/* statistics/gsl_statistics_quantile.h
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_STATISTICS_QUANTILE_H__
+#define __GSL_STATISTICS_QUANTILE_H__
+
+/* methods for quantiles which fall between two order statistics */
+typedef enum
+{
+  GSL_STATS_QUANTILE_LINEAR = 0,  /* linear interpolation */
+  GSL_STATS_QUANTILE_LOWER,       /* lower order statistic */
+  GSL_STATS_QUANTILE_HIGHER,      /* higher order statistic */
+  GSL_STATS_QUANTILE_NEAREST,     /* nearest order statistic */
+  GSL_STATS_QUANTILE_MIDPOINT     /* mean of the two order statistics */
+} gsl_stats_quantile_t;
+
+#endif /* __GSL_STATISTICS_QUANTILE_H__ */
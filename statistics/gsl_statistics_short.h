@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_short_lag1_autocorrelation (const short data[], const size_t st
 double gsl_stats_short_covariance (const short data1[], const size_t stride1,const short data2[], const size_t stride2, const size_t n);
 double gsl_stats_short_correlation (const short data1[], const size_t stride1,const short data2[], const size_t stride2, const size_t n);
 double gsl_stats_short_spearman (const short data1[], const size_t stride1, const short data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_short_kendall (const short data1[], const size_t stride1, const short data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_short_variance_m (const short data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_short_sd_m (const short data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ short gsl_stats_short_max (const short data[], const size_t stride, const size_t
 short gsl_stats_short_min (const short data[], const size_t stride, const size_t n);
 void gsl_stats_short_minmax (short * min, short * max, const short data[], const size_t stride, const size_t n);
 
+void gsl_stats_short_summary (double * mean, double * variance, double * skew, double * kurtosis, short * min, short * max, const short data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_short_max_index (const short data[], const size_t stride, const size_t n);
 size_t gsl_stats_short_min_index (const short data[], const size_t stride, const size_t n);
 void gsl_stats_short_minmax_index (size_t * min_index, size_t * max_index, const short data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ short gsl_stats_short_select(short data[], const size_t stride, const size_t n,
 double gsl_stats_short_median_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_median (short sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_short_quantile_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_short_quantiles (short data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_short_trmean_from_sorted_data (const double trim, const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_gastwirth_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_short_Sn_from_sorted_data (const short sorted_data[], const siz
 short gsl_stats_short_Qn0_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
 double gsl_stats_short_Qn_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, short work[], int work_int[]) ;
 
+int gsl_stats_short_mad_columns (const short data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_short_Sn_columns (const short data[], const size_t tda, const size_t n, const size_t ncols, double result[], short work[], const size_t lwork);
+int gsl_stats_short_Qn_columns (const short data[], const size_t tda, const size_t n, const size_t ncols, double result[], short work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_SHORT_H__ */
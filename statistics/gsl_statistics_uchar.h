@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_uchar_lag1_autocorrelation (const unsigned char data[], const s
 double gsl_stats_uchar_covariance (const unsigned char data1[], const size_t stride1,const unsigned char data2[], const size_t stride2, const size_t n);
 double gsl_stats_uchar_correlation (const unsigned char data1[], const size_t stride1,const unsigned char data2[], const size_t stride2, const size_t n);
 double gsl_stats_uchar_spearman (const unsigned char data1[], const size_t stride1, const unsigned char data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_uchar_kendall (const unsigned char data1[], const size_t stride1, const unsigned char data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_uchar_variance_m (const unsigned char data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_uchar_sd_m (const unsigned char data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ unsigned char gsl_stats_uchar_max (const unsigned char data[], const size_t stri
 unsigned char gsl_stats_uchar_min (const unsigned char data[], const size_t stride, const size_t n);
 void gsl_stats_uchar_minmax (unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n);
 
+void gsl_stats_uchar_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_uchar_max_index (const unsigned char data[], const size_t stride, const size_t n);
 size_t gsl_stats_uchar_min_index (const unsigned char data[], const size_t stride, const size_t n);
 void gsl_stats_uchar_minmax_index (size_t * min_index, size_t * max_index, const unsigned char data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ unsigned char gsl_stats_uchar_select(unsigned char data[], const size_t stride,
 double gsl_stats_uchar_median_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_median (unsigned char sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_uchar_quantile_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uchar_quantiles (unsigned char data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_uchar_trmean_from_sorted_data (const double trim, const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_gastwirth_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_uchar_Sn_from_sorted_data (const unsigned char sorted_data[], c
 unsigned char gsl_stats_uchar_Qn0_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
 double gsl_stats_uchar_Qn_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, unsigned char work[], int work_int[]) ;
 
+int gsl_stats_uchar_mad_columns (const unsigned char data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_uchar_Sn_columns (const unsigned char data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned char work[], const size_t lwork);
+int gsl_stats_uchar_Qn_columns (const unsigned char data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned char work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_UCHAR_H__ */
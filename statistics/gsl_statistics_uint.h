@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_uint_lag1_autocorrelation (const unsigned int data[], const siz
 double gsl_stats_uint_covariance (const unsigned int data1[], const size_t stride1,const unsigned int data2[], const size_t stride2, const size_t n);
 double gsl_stats_uint_correlation (const unsigned int data1[], const size_t stride1,const unsigned int data2[], const size_t stride2, const size_t n);
 double gsl_stats_uint_spearman (const unsigned int data1[], const size_t stride1, const unsigned int data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_uint_kendall (const unsigned int data1[], const size_t stride1, const unsigned int data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_uint_variance_m (const unsigned int data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_uint_sd_m (const unsigned int data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ unsigned int gsl_stats_uint_max (const unsigned int data[], const size_t stride,
 unsigned int gsl_stats_uint_min (const unsigned int data[], const size_t stride, const size_t n);
 void gsl_stats_uint_minmax (unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n);
 
+void gsl_stats_uint_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_uint_max_index (const unsigned int data[], const size_t stride, const size_t n);
 size_t gsl_stats_uint_min_index (const unsigned int data[], const size_t stride, const size_t n);
 void gsl_stats_uint_minmax_index (size_t * min_index, size_t * max_index, const unsigned int data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ unsigned int gsl_stats_uint_select(unsigned int data[], const size_t stride, con
 double gsl_stats_uint_median_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_median (unsigned int sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_uint_quantile_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uint_quantiles (unsigned int data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_uint_trmean_from_sorted_data (const double trim, const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_gastwirth_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_uint_Sn_from_sorted_data (const unsigned int sorted_data[], con
 unsigned int gsl_stats_uint_Qn0_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
 double gsl_stats_uint_Qn_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, unsigned int work[], int work_int[]) ;
 
+int gsl_stats_uint_mad_columns (const unsigned int data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_uint_Sn_columns (const unsigned int data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned int work[], const size_t lwork);
+int gsl_stats_uint_Qn_columns (const unsigned int data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned int work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_UINT_H__ */
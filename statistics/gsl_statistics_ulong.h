@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_ulong_lag1_autocorrelation (const unsigned long data[], const s
 double gsl_stats_ulong_covariance (const unsigned long data1[], const size_t stride1,const unsigned long data2[], const size_t stride2, const size_t n);
 double gsl_stats_ulong_correlation (const unsigned long data1[], const size_t stride1,const unsigned long data2[], const size_t stride2, const size_t n);
 double gsl_stats_ulong_spearman (const unsigned long data1[], const size_t stride1, const unsigned long data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_ulong_kendall (const unsigned long data1[], const size_t stride1, const unsigned long data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_ulong_variance_m (const unsigned long data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_ulong_sd_m (const unsigned long data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ unsigned long gsl_stats_ulong_max (const unsigned long data[], const size_t stri
 unsigned long gsl_stats_ulong_min (const unsigned long data[], const size_t stride, const size_t n);
 void gsl_stats_ulong_minmax (unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n);
 
+void gsl_stats_ulong_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_ulong_max_index (const unsigned long data[], const size_t stride, const size_t n);
 size_t gsl_stats_ulong_min_index (const unsigned long data[], const size_t stride, const size_t n);
 void gsl_stats_ulong_minmax_index (size_t * min_index, size_t * max_index, const unsigned long data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ unsigned long gsl_stats_ulong_select(unsigned long data[], const size_t stride,
 double gsl_stats_ulong_median_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_median (unsigned long sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_ulong_quantile_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ulong_quantiles (unsigned long data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_ulong_trmean_from_sorted_data (const double trim, const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_gastwirth_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_ulong_Sn_from_sorted_data (const unsigned long sorted_data[], c
 unsigned long gsl_stats_ulong_Qn0_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
 double gsl_stats_ulong_Qn_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, unsigned long work[], int work_int[]) ;
 
+int gsl_stats_ulong_mad_columns (const unsigned long data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_ulong_Sn_columns (const unsigned long data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned long work[], const size_t lwork);
+int gsl_stats_ulong_Qn_columns (const unsigned long data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned long work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_ULONG_H__ */
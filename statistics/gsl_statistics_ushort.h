@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdlib.h>
+#include <gsl/gsl_statistics_quantile.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -51,6 +52,7 @@ double gsl_stats_ushort_lag1_autocorrelation (const unsigned short data[], const
 double gsl_stats_ushort_covariance (const unsigned short data1[], const size_t stride1,const unsigned short data2[], const size_t stride2, const size_t n);
 double gsl_stats_ushort_correlation (const unsigned short data1[], const size_t stride1,const unsigned short data2[], const size_t stride2, const size_t n);
 double gsl_stats_ushort_spearman (const unsigned short data1[], const size_t stride1, const unsigned short data2[], const size_t stride2, const size_t n, double work[]);
+double gsl_stats_ushort_kendall (const unsigned short data1[], const size_t stride1, const unsigned short data2[], const size_t stride2, const size_t n, double work[]);
 
 double gsl_stats_ushort_variance_m (const unsigned short data[], const size_t stride, const size_t n, const double mean);
 double gsl_stats_ushort_sd_m (const unsigned short data[], const size_t stride, const size_t n, const double mean);
@@ -69,6 +71,8 @@ unsigned short gsl_stats_ushort_max (const unsigned short data[], const size_t s
 unsigned short gsl_stats_ushort_min (const unsigned short data[], const size_t stride, const size_t n);
 void gsl_stats_ushort_minmax (unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n);
 
+void gsl_stats_ushort_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n);
+
 size_t gsl_stats_ushort_max_index (const unsigned short data[], const size_t stride, const size_t n);
 size_t gsl_stats_ushort_min_index (const unsigned short data[], const size_t stride, const size_t n);
 void gsl_stats_ushort_minmax_index (size_t * min_index, size_t * max_index, const unsigned short data[], const size_t stride, const size_t n);
@@ -78,6 +82,7 @@ unsigned short gsl_stats_ushort_select(unsigned short data[], const size_t strid
 double gsl_stats_ushort_median_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_median (unsigned short sorted_data[], const size_t stride, const size_t n);
 double gsl_stats_ushort_quantile_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ushort_quantiles (unsigned short data[], const size_t stride, const size_t n, const double p[], const size_t np, const gsl_stats_quantile_t type, double result[]);
 
 double gsl_stats_ushort_trmean_from_sorted_data (const double trim, const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_gastwirth_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
@@ -91,6 +96,11 @@ double gsl_stats_ushort_Sn_from_sorted_data (const unsigned short sorted_data[],
 unsigned short gsl_stats_ushort_Qn0_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
 double gsl_stats_ushort_Qn_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, unsigned short work[], int work_int[]) ;
 
+int gsl_stats_ushort_mad_columns (const unsigned short data[], const size_t tda, const size_t n, const size_t ncols, double result[], double work[], const size_t lwork);
+int gsl_stats_ushort_Sn_columns (const unsigned short data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned short work[], const size_t lwork);
+int gsl_stats_ushort_Qn_columns (const unsigned short data[], const size_t tda, const size_t n, const size_t ncols, double result[], unsigned short work[], const size_t lwork, int work_int[]);
+
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_USHORT_H__ */
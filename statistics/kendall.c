@@ -0,0 +1,130 @@
+/* statistics/kendall.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* this file is included by covariance.c and covmatrix.c */
+
+/* number of pairs among the tied runs of a sorted array */
+static double
+kendall_ties (const size_t n, const double x[])
+{
+  double t = 0.0;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      size_t j = i + 1;
+
+      while (j < n && x[j] == x[i])
+        ++j;
+
+      t += 0.5 * (double) (j - i) * (double) (j - i - 1);
+      i = j;
+    }
+
+  return t;
+}
+
+/*
+kendall_sorted()
+  Compute Kendall's tau-b with the algorithm of Knight
+
+Inputs: n   - number of observations
+        x   - x values in ascending order
+        y   - y values corresponding to x; sorted on output
+        buf - workspace, length n
+
+Return: tau-b
+
+Notes: the y values of each run of tied x values are first sorted, so
+that the pairs are in lexicographic order. The number of discordant
+pairs is then the number of exchanges performed by a merge sort of y,
+which is counted in O(n log n) time.
+
+W. R. Knight, "A Computer Method for Calculating Kendall's Tau with
+Ungrouped Data", Journal of the American Statistical Association,
+Vol 61, No 314, 1966.
+*/
+
+static double
+kendall_sorted (const size_t n, const double x[], double y[], double buf[])
+{
+  const double n0 = 0.5 * (double) n * (double) (n - 1);
+  double n1 = 0.0, n2, n3 = 0.0, swaps = 0.0;
+  size_t i, width;
+
+  if (n < 2)
+    return GSL_NAN;
+
+  /* sort y within runs of tied x; count ties in x and joint ties */
+  i = 0;
+  while (i < n)
+    {
+      size_t j = i + 1;
+
+      while (j < n && x[j] == x[i])
+        ++j;
+
+      if (j - i > 1)
+        {
+          gsl_sort (y + i, 1, j - i);
+          n1 += 0.5 * (double) (j - i) * (double) (j - i - 1);
+          n3 += kendall_ties (j - i, y + i);
+        }
+
+      i = j;
+    }
+
+  /* bottom-up merge sort of y, counting exchanges */
+  for (width = 1; width < n; width *= 2)
+    {
+      for (i = 0; i < n; i += 2 * width)
+        {
+          const size_t mid = GSL_MIN (i + width, n);
+          const size_t end = GSL_MIN (i + 2 * width, n);
+          size_t l = i, r = mid, k = i;
+
+          while (l < mid && r < end)
+            {
+              if (y[l] <= y[r])
+                {
+                  buf[k++] = y[l++];
+                }
+              else
+                {
+                  /* y[r] is less than all remaining elements of the left run */
+                  swaps += (double) (mid - l);
+                  buf[k++] = y[r++];
+                }
+            }
+
+          while (l < mid)
+            buf[k++] = y[l++];
+
+          while (r < end)
+            buf[k++] = y[r++];
+        }
+
+      for (i = 0; i < n; ++i)
+        y[i] = buf[i];
+    }
+
+  n2 = kendall_ties (n, y);
+
+  return (n0 - n1 - n2 + n3 - 2.0 * swaps) / (sqrt (n0 - n1) * sqrt (n0 - n2));
+}
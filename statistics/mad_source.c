@@ -29,29 +29,21 @@ Inputs: data    - array containing the observations
 Return: MAD statistic (without scale/correction factor)
 */
 
+static double FUNCTION(mad,work)(double work[], const size_t n);
+
 double
 FUNCTION(gsl_stats,mad0) (const BASE data[],
                           const size_t stride,
                           const size_t n,
                           double work[])
 {
-  double median, mad;
   size_t i;
 
   /* copy input data to work */
   for (i = 0; i < n; ++i)
     work[i] = (double) data[i * stride];
 
-  /* compute median of input data using double version */
-  median = gsl_stats_median(work, 1, n);
-
-  /* compute absolute deviations from median */
-  for (i = 0; i < n; ++i)
-    work[i] = fabs((double) data[i * stride] - median);
-
-  mad = gsl_stats_median(work, 1, n);
-
-  return mad;
+  return FUNCTION(mad,work)(work, n);
 }
 
 double
@@ -64,3 +56,81 @@ FUNCTION(gsl_stats,mad) (const BASE data[],
   double mad = 1.482602218505602 * mad0;
   return mad;
 }
+
+/*
+gsl_stats_mad_columns()
+  Compute median absolute deviation of each column of a matrix
+
+Inputs: data    - matrix of observations, n rows and ncols columns,
+                  stored in row-major order with row stride tda
+        tda     - row stride of data
+        n       - number of rows
+        ncols   - number of columns
+        result  - (output) MAD statistic of each column, length ncols
+        work    - workspace of length lwork
+        lwork   - length of work, at least n. The columns are copied
+                  to the workspace floor(lwork/n) at a time, reading
+                  the data in row order.
+
+Return: success/error
+*/
+
+int
+FUNCTION(gsl_stats,mad_columns) (const BASE data[],
+                                 const size_t tda,
+                                 const size_t n,
+                                 const size_t ncols,
+                                 double result[],
+                                 double work[],
+                                 const size_t lwork)
+{
+  if (n == 0)
+    {
+      GSL_ERROR("number of rows must be positive", GSL_EBADLEN);
+    }
+  else if (lwork < n)
+    {
+      GSL_ERROR("workspace must have length at least n", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nblock = GSL_MIN(lwork / n, ncols);
+      size_t c, b, i;
+
+      for (c = 0; c < ncols; c += nblock)
+        {
+          const size_t nb = GSL_MIN(nblock, ncols - c);
+
+          for (i = 0; i < n; ++i)
+            {
+              const BASE * row = data + i * tda + c;
+
+              for (b = 0; b < nb; ++b)
+                work[b * n + i] = (double) row[b];
+            }
+
+          for (b = 0; b < nb; ++b)
+            result[c + b] = 1.482602218505602 * FUNCTION(mad,work)(work + b * n, n);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* compute unscaled MAD of work[0..n-1], which is overwritten */
+static double
+FUNCTION(mad,work)(double work[], const size_t n)
+{
+  double median;
+  size_t i;
+
+  /* compute median of input data using double version */
+  median = gsl_stats_median(work, 1, n);
+
+  /* compute absolute deviations from median; the order of the
+     elements of work does not matter */
+  for (i = 0; i < n; ++i)
+    work[i] = fabs(work[i] - median);
+
+  return gsl_stats_median(work, 1, n);
+}
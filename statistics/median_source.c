@@ -58,8 +58,18 @@ FUNCTION(gsl_stats,median) (BASE data[], const size_t stride, const size_t n)
     }
   else 
     {
+      /* after selecting element lhs, the array is partitioned so that
+         element rhs is the smallest of the elements above lhs */
       BASE a = FUNCTION(gsl_stats,select)(data, stride, n, lhs);
-      BASE b = FUNCTION(gsl_stats,select)(data, stride, n, rhs);
+      BASE b = data[rhs * stride];
+      size_t i;
+
+      for (i = rhs + 1; i < n; ++i)
+        {
+          if (data[i * stride] < b)
+            b = data[i * stride];
+        }
+
       median = 0.5 * (a + b);
     }
 
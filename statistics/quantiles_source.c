@@ -43,3 +43,199 @@ FUNCTION(gsl_stats,quantile_from_sorted_data) (const BASE sorted_data[],
 
   return result ;
 }
+
+/*
+FUNCTION(quantile,rank)()
+  Compute the order statistic which determines the p-quantile
+of n observations, with quantile position h = p * (n - 1)
+
+Inputs: p     - quantile in [0,1]
+        n     - number of observations
+        type  - quantile method
+        delta - (output) fractional part of h
+
+Return: rank of the order statistic (the lower of the two
+        order statistics for interpolating methods)
+*/
+
+static size_t
+FUNCTION(quantile,rank) (const double p, const size_t n,
+                         const gsl_stats_quantile_t type, double *delta)
+{
+  const double h = p * (n - 1);
+  size_t lhs = (size_t) h;
+
+  if (lhs >= n - 1)
+    {
+      *delta = 0.0;
+      return n - 1;
+    }
+
+  *delta = h - lhs;
+
+  switch (type)
+    {
+      case GSL_STATS_QUANTILE_HIGHER:
+        return (*delta > 0.0) ? lhs + 1 : lhs;
+
+      case GSL_STATS_QUANTILE_NEAREST:
+        if (*delta > 0.5 || (*delta == 0.5 && (lhs & 1)))
+          return lhs + 1;
+        else
+          return lhs;
+
+      default:
+        return lhs;
+    }
+}
+
+/* compute quantile value from order statistics a = x_(k) and b = x_(k+1) */
+static double
+FUNCTION(quantile,value) (const double a, const double b, const double delta,
+                          const gsl_stats_quantile_t type)
+{
+  if (type == GSL_STATS_QUANTILE_LINEAR)
+    return (1 - delta) * a + delta * b;
+  else if (type == GSL_STATS_QUANTILE_MIDPOINT)
+    return 0.5 * (a + b);
+  else
+    return a;
+}
+
+/*
+FUNCTION(quantile,multiselect)()
+  Partially sort data[lo..hi] so that the order statistics
+required by p[ia..ib-1] are in their sorted positions. The
+median request is placed by quickselect, which partitions the
+array, and the two halves are processed recursively, so the total
+cost is O(n log np)
+*/
+
+static void
+FUNCTION(quantile,multiselect) (BASE data[], const size_t stride,
+                                const size_t n, const size_t lo,
+                                const size_t hi, const double p[],
+                                size_t ia, size_t ib,
+                                const gsl_stats_quantile_t type)
+{
+  double delta;
+  size_t mid, k;
+
+  while (ia < ib && FUNCTION(quantile,rank) (p[ia], n, type, &delta) < lo)
+    ++ia;
+
+  while (ia < ib && FUNCTION(quantile,rank) (p[ib - 1], n, type, &delta) > hi)
+    --ib;
+
+  if (ia >= ib)
+    return;
+
+  mid = ia + (ib - ia) / 2;
+  k = FUNCTION(quantile,rank) (p[mid], n, type, &delta);
+
+  FUNCTION(gsl_stats,select) (data + lo * stride, stride, hi - lo + 1, k - lo);
+
+  if (k > lo)
+    FUNCTION(quantile,multiselect) (data, stride, n, lo, k - 1, p, ia, mid, type);
+
+  if (k < hi)
+    FUNCTION(quantile,multiselect) (data, stride, n, k + 1, hi, p, mid + 1, ib, type);
+}
+
+/*
+gsl_stats_quantiles()
+  Compute several quantiles of an unsorted array with a single
+partial sort
+
+Inputs: data   - unsorted array, length n; on output it is
+                 rearranged so that the required order statistics
+                 are in their sorted positions
+        stride - stride
+        n      - length of data
+        p      - quantiles to compute, nondecreasing in [0,1], length np
+        np     - number of quantiles
+        type   - method for quantiles between two order statistics
+        result - (output) quantiles, length np
+*/
+
+int
+FUNCTION(gsl_stats,quantiles) (BASE data[], const size_t stride,
+                               const size_t n, const double p[],
+                               const size_t np,
+                               const gsl_stats_quantile_t type,
+                               double result[])
+{
+  size_t i, j;
+  size_t kprev = n;
+  double next = 0.0;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("array size must be positive", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < np; i++)
+    {
+      if (!(p[i] >= 0.0 && p[i] <= 1.0))
+        {
+          GSL_ERROR ("quantiles must be in [0,1]", GSL_EDOM);
+        }
+
+      if (i > 0 && p[i] < p[i - 1])
+        {
+          GSL_ERROR ("quantiles must be in nondecreasing order", GSL_EINVAL);
+        }
+    }
+
+  if (type > GSL_STATS_QUANTILE_MIDPOINT)
+    {
+      GSL_ERROR ("unknown quantile method", GSL_EINVAL);
+    }
+
+  if (np == 0)
+    return GSL_SUCCESS;
+
+  FUNCTION(quantile,multiselect) (data, stride, n, 0, n - 1, p, 0, np, type);
+
+  for (i = 0, j = 0; i < np; i++)
+    {
+      double delta;
+      const size_t k = FUNCTION(quantile,rank) (p[i], n, type, &delta);
+      const double a = data[k * stride];
+
+      if (delta > 0.0 && (type == GSL_STATS_QUANTILE_LINEAR ||
+                          type == GSL_STATS_QUANTILE_MIDPOINT))
+        {
+          /* x_(k+1) is the minimum of the elements between x_(k) and
+           * the next order statistic in its sorted position */
+          if (k != kprev)
+            {
+              size_t end = n - 1, m;
+              double d;
+
+              while (j < np && FUNCTION(quantile,rank) (p[j], n, type, &d) <= k)
+                ++j;
+
+              if (j < np)
+                end = FUNCTION(quantile,rank) (p[j], n, type, &d);
+
+              next = data[(k + 1) * stride];
+              for (m = k + 2; m <= end; m++)
+                {
+                  if (data[m * stride] < next)
+                    next = data[m * stride];
+                }
+
+              kprev = k;
+            }
+
+          result[i] = FUNCTION(quantile,value) (a, next, delta, type);
+        }
+      else
+        {
+          result[i] = a;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,142 @@
+/* statistics/summary_source.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void
+FUNCTION (gsl_stats, summary) (double * mean_out, double * variance_out,
+                               double * skew_out, double * kurtosis_out,
+                               BASE * min_out, BASE * max_out,
+                               const BASE data[], const size_t stride,
+                               const size_t n)
+{
+  /* Compute the mean, variance, skewness, kurtosis, minimum and maximum
+     of a dataset in a single pass.  The data are dealt round-robin into
+     SUMMARY_LANES independent accumulators, which all hold the same
+     number of samples after each block and so share the reciprocal
+     count; the inner loop has no dependence between lanes and can be
+     vectorized.  The lanes are combined at the end with the pairwise
+     moment formulas. */
+
+  moment_accum lane[SUMMARY_LANES];
+  const size_t nblocks = n / SUMMARY_LANES;
+  BASE min, max;
+  double var, sd;
+  size_t i, l;
+#ifdef FP
+  int has_nan = 0;
+#endif
+
+  if (n == 0)
+    {
+      /* no data: the moments are undefined */
+      *mean_out = GSL_NAN;
+      *variance_out = GSL_NAN;
+      *skew_out = GSL_NAN;
+      *kurtosis_out = GSL_NAN;
+#ifdef FP
+      *min_out = GSL_NAN;
+      *max_out = GSL_NAN;
+#else
+      *min_out = 0;
+      *max_out = 0;
+#endif
+      return;
+    }
+
+  min = data[0 * stride];
+  max = data[0 * stride];
+
+  for (l = 0; l < SUMMARY_LANES; l++)
+    moments_init (&lane[l]);
+
+  for (i = 0; i < nblocks; i++)
+    {
+      const double nb = (double) i;   /* samples per lane before update */
+      const double inv = 1.0 / (nb + 1.0);
+      const double c4 = (nb + 1.0) * (nb + 1.0) - 3.0 * (nb + 1.0) + 3.0;
+
+      for (l = 0; l < SUMMARY_LANES; l++)
+        {
+          const BASE xi = data[(i * SUMMARY_LANES + l) * stride];
+          moment_accum * a = &lane[l];
+          const double delta = xi - a->mean;
+          const double delta_n = delta * inv;
+          const double delta_n2 = delta_n * delta_n;
+          const double term1 = delta * delta_n * nb;
+
+          a->M4 += term1 * delta_n2 * c4 + 6.0 * delta_n2 * a->M2 - 4.0 * delta_n * a->M3;
+          a->M3 += term1 * delta_n * (nb - 1.0) - 3.0 * delta_n * a->M2;
+          a->M2 += term1;
+          a->mean += delta_n;
+
+          if (xi < min)
+            min = xi;
+
+          if (xi > max)
+            max = xi;
+
+#ifdef FP
+          has_nan |= isnan (xi);
+#endif
+        }
+    }
+
+  for (l = 0; l < SUMMARY_LANES; l++)
+    lane[l].W = (double) nblocks;
+
+  /* remaining samples go into the first lane */
+
+  for (i = nblocks * SUMMARY_LANES; i < n; i++)
+    {
+      const BASE xi = data[i * stride];
+
+      moments_add (&lane[0], xi, 1.0);
+
+      if (xi < min)
+        min = xi;
+
+      if (xi > max)
+        max = xi;
+
+#ifdef FP
+      has_nan |= isnan (xi);
+#endif
+    }
+
+  for (l = 1; l < SUMMARY_LANES; l++)
+    moments_combine (&lane[0], &lane[l]);
+
+#ifdef FP
+  if (has_nan)
+    {
+      /* match gsl_stats_minmax, which returns nan if present */
+      min = GSL_NAN;
+      max = GSL_NAN;
+    }
+#endif
+
+  var = lane[0].M2 / (n - 1.0);
+  sd = sqrt (var);
+
+  *mean_out = lane[0].mean;
+  *variance_out = var;
+  *skew_out = (lane[0].M3 / n) / (var * sd);
+  *kurtosis_out = (lane[0].M4 / n) / (var * var) - 3.0;
+  *min_out = min;
+  *max_out = max;
+}
@@ -31,6 +31,8 @@
 
 int test_nist (void);
 int test_robust (void);
+int test_quantiles (void);
+int test_covmatrix (void);
 
 /* Test program for mean.c.  JimDavies 7.96 */
 
@@ -128,6 +130,8 @@ main (void)
 
   test_nist();
   test_robust();
+  test_quantiles();
+  test_covmatrix();
 
   exit (gsl_test_summary ());
 }
@@ -0,0 +1,395 @@
+/* statistics/test_covmatrix.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_statistics.h>
+#include <gsl/gsl_statistics_matrix.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+
+int test_covmatrix (void);
+
+/* random correlated data with column offsets */
+static void
+random_data(gsl_matrix * X, gsl_rng * r)
+{
+  size_t i, j;
+
+  for (i = 0; i < X->size1; ++i)
+    {
+      double u = 2.0 * gsl_rng_uniform(r) - 1.0;
+
+      for (j = 0; j < X->size2; ++j)
+        {
+          double xij = 100.0 * j + u * (j % 3) + (2.0 * gsl_rng_uniform(r) - 1.0);
+          gsl_matrix_set(X, i, j, xij);
+        }
+    }
+}
+
+/* compare with pairwise calls to gsl_stats_{covariance,correlation,spearman} */
+static void
+test_complete(const size_t n, const size_t p, gsl_rng * r)
+{
+  const double tol = 1.0e-10;
+  gsl_matrix *X = gsl_matrix_alloc(n, p);
+  gsl_matrix *C = gsl_matrix_alloc(p, p);
+  gsl_matrix *R = gsl_matrix_alloc(p, p);
+  gsl_matrix *RS = gsl_matrix_alloc(p, p);
+  gsl_matrix *C2 = gsl_matrix_alloc(p, p);
+  gsl_vector *mean = gsl_vector_alloc(p);
+  double *work = malloc(2 * n * sizeof(double));
+  gsl_stats_covmat_workspace *w = gsl_stats_covmat_alloc(p, 0);
+  size_t i, j;
+
+  random_data(X, r);
+
+  gsl_stats_covariance_matrix(X, 0, C);
+  gsl_stats_correlation_matrix(X, 0, R);
+  gsl_stats_spearman_matrix(X, 0, RS);
+
+  for (i = 0; i < p; ++i)
+    {
+      const double *xi = X->data + i;
+
+      for (j = 0; j < p; ++j)
+        {
+          const double *xj = X->data + j;
+          double cij = gsl_stats_covariance(xi, X->tda, xj, X->tda, n);
+          double rij = gsl_stats_correlation(xi, X->tda, xj, X->tda, n);
+          double sij = gsl_stats_spearman(xi, X->tda, xj, X->tda, n, work);
+
+          gsl_test_rel(gsl_matrix_get(C, i, j), cij, tol,
+                       "covariance_matrix n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+          gsl_test_rel(gsl_matrix_get(R, i, j), rij, tol,
+                       "correlation_matrix n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+          gsl_test_rel(gsl_matrix_get(RS, i, j), sij, tol,
+                       "spearman_matrix n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+        }
+    }
+
+  /* accumulate in uneven row blocks */
+  i = 0;
+  while (i < n)
+    {
+      size_t m = GSL_MIN(n - i, 1 + gsl_rng_uniform_int(r, 400));
+      gsl_matrix_const_view Xb = gsl_matrix_const_submatrix(X, i, 0, m, p);
+
+      gsl_stats_covmat_accumulate(&Xb.matrix, w);
+      i += m;
+    }
+
+  gsl_stats_covmat_covariance(C2, w);
+  gsl_stats_covmat_mean(mean, w);
+
+  for (j = 0; j < p; ++j)
+    {
+      double mj = gsl_stats_mean(X->data + j, X->tda, n);
+
+      gsl_test_rel(gsl_vector_get(mean, j), mj, tol,
+                   "covmat_mean n=%zu p=%zu j=%zu", n, p, j);
+
+      for (i = 0; i < p; ++i)
+        {
+          gsl_test_rel(gsl_matrix_get(C2, i, j), gsl_matrix_get(C, i, j), tol,
+                       "covmat blocked n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+        }
+    }
+
+  /* pairwise handling of data without NaNs */
+  gsl_stats_covariance_matrix(X, GSL_STATS_PAIRWISE, C2);
+
+  for (i = 0; i < p; ++i)
+    {
+      for (j = 0; j < p; ++j)
+        {
+          gsl_test_rel(gsl_matrix_get(C2, i, j), gsl_matrix_get(C, i, j), tol,
+                       "covariance_matrix pairwise no NaN n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+        }
+    }
+
+  gsl_matrix_free(X);
+  gsl_matrix_free(C);
+  gsl_matrix_free(R);
+  gsl_matrix_free(RS);
+  gsl_matrix_free(C2);
+  gsl_vector_free(mean);
+  gsl_stats_covmat_free(w);
+  free(work);
+}
+
+/* compare pairwise-complete statistics with those over common rows */
+static void
+test_pairwise(const size_t n, const size_t p, const double pnan, gsl_rng * r)
+{
+  const double tol = 1.0e-10;
+  gsl_matrix *X = gsl_matrix_alloc(n, p);
+  gsl_matrix *C = gsl_matrix_alloc(p, p);
+  gsl_matrix *R = gsl_matrix_alloc(p, p);
+  gsl_matrix *RS = gsl_matrix_alloc(p, p);
+  double *xi = malloc(n * sizeof(double));
+  double *xj = malloc(n * sizeof(double));
+  double *work = malloc(2 * n * sizeof(double));
+  size_t i, j, k;
+
+  random_data(X, r);
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < p; ++j)
+        {
+          if (gsl_rng_uniform(r) < pnan)
+            gsl_matrix_set(X, i, j, GSL_NAN);
+        }
+    }
+
+  gsl_stats_covariance_matrix(X, GSL_STATS_PAIRWISE, C);
+  gsl_stats_correlation_matrix(X, GSL_STATS_PAIRWISE, R);
+  gsl_stats_spearman_matrix(X, GSL_STATS_PAIRWISE, RS);
+
+  for (i = 0; i < p; ++i)
+    {
+      for (j = 0; j < p; ++j)
+        {
+          size_t m = 0;
+
+          for (k = 0; k < n; ++k)
+            {
+              double a = gsl_matrix_get(X, k, i);
+              double b = gsl_matrix_get(X, k, j);
+
+              if (!gsl_isnan(a) && !gsl_isnan(b))
+                {
+                  xi[m] = a;
+                  xj[m] = b;
+                  ++m;
+                }
+            }
+
+          if (m < 2)
+            {
+              gsl_test(!gsl_isnan(gsl_matrix_get(C, i, j)),
+                       "covariance_matrix pairwise n=%zu (%zu,%zu) NaN", n, i, j);
+              gsl_test(!gsl_isnan(gsl_matrix_get(RS, i, j)),
+                       "spearman_matrix pairwise n=%zu (%zu,%zu) NaN", n, i, j);
+              continue;
+            }
+
+          gsl_test_rel(gsl_matrix_get(C, i, j),
+                       gsl_stats_covariance(xi, 1, xj, 1, m), tol,
+                       "covariance_matrix pairwise n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+          gsl_test_rel(gsl_matrix_get(R, i, j),
+                       gsl_stats_correlation(xi, 1, xj, 1, m), tol,
+                       "correlation_matrix pairwise n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+
+          /* ranks over the common rows, not over each column */
+          gsl_test_rel(gsl_matrix_get(RS, i, j),
+                       gsl_stats_spearman(xi, 1, xj, 1, m, work), tol,
+                       "spearman_matrix pairwise n=%zu p=%zu (%zu,%zu)", n, p, i, j);
+        }
+    }
+
+  gsl_matrix_free(X);
+  gsl_matrix_free(C);
+  gsl_matrix_free(R);
+  gsl_matrix_free(RS);
+  free(xi);
+  free(xj);
+  free(work);
+}
+
+/* compute Kendall tau-b with the O(n^2) definition */
+static double
+slow_kendall(const size_t n, const double x[], const double y[])
+{
+  double nc = 0.0, nd = 0.0, tx = 0.0, ty = 0.0;
+  size_t i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = i + 1; j < n; ++j)
+        {
+          double s = (x[i] - x[j]) * (y[i] - y[j]);
+
+          if (x[i] == x[j] && y[i] == y[j])
+            continue;
+          else if (x[i] == x[j])
+            tx += 1.0;
+          else if (y[i] == y[j])
+            ty += 1.0;
+          else if (s > 0.0)
+            nc += 1.0;
+          else
+            nd += 1.0;
+        }
+    }
+
+  return (nc - nd) / (sqrt(nc + nd + tx) * sqrt(nc + nd + ty));
+}
+
+static void
+test_kendall(const size_t n, const double scale, gsl_rng * r)
+{
+  const double tol = 1.0e-12;
+  double *x = malloc(n * sizeof(double));
+  double *y = malloc(n * sizeof(double));
+  int *xi = malloc(n * sizeof(int));
+  int *yi = malloc(n * sizeof(int));
+  double *work = malloc(3 * n * sizeof(double));
+  double tau, expected;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      double u = gsl_rng_uniform(r);
+
+      /* scale > 0 rounds the data to produce ties */
+      x[i] = u + 0.5 * gsl_rng_uniform(r);
+      y[i] = u - 0.5 * gsl_rng_uniform(r);
+
+      if (scale > 0.0)
+        {
+          x[i] = floor(scale * x[i]);
+          y[i] = floor(scale * y[i]);
+        }
+
+      xi[i] = (int) floor(10.0 * x[i]);
+      yi[i] = (int) floor(10.0 * y[i]);
+    }
+
+  expected = slow_kendall(n, x, y);
+  tau = gsl_stats_kendall(x, 1, y, 1, n, work);
+  gsl_test_rel(tau, expected, tol, "kendall n=%zu scale=%g", n, scale);
+
+  for (i = 0; i < n; ++i)
+    {
+      x[i] = xi[i];
+      y[i] = yi[i];
+    }
+
+  expected = slow_kendall(n, x, y);
+  tau = gsl_stats_int_kendall(xi, 1, yi, 1, n, work);
+  gsl_test_rel(tau, expected, tol, "int_kendall n=%zu scale=%g", n, scale);
+
+  free(x);
+  free(y);
+  free(xi);
+  free(yi);
+  free(work);
+}
+
+/* compare gsl_stats_kendall_matrix with gsl_stats_kendall on common rows */
+static void
+test_kendall_matrix(const size_t n, const size_t p, const double pnan, gsl_rng * r)
+{
+  const double tol = 1.0e-12;
+  gsl_matrix *X = gsl_matrix_alloc(n, p);
+  gsl_matrix *R = gsl_matrix_alloc(p, p);
+  double *xi = malloc(n * sizeof(double));
+  double *xj = malloc(n * sizeof(double));
+  double *work = malloc(3 * n * sizeof(double));
+  const int flags = (pnan > 0.0) ? GSL_STATS_PAIRWISE : 0;
+  size_t i, j, k;
+
+  random_data(X, r);
+
+  for (i = 0; i < n; ++i)
+    {
+      for (j = 0; j < p; ++j)
+        {
+          /* introduce ties */
+          gsl_matrix_set(X, i, j, floor(20.0 * gsl_matrix_get(X, i, j)));
+
+          if (gsl_rng_uniform(r) < pnan)
+            gsl_matrix_set(X, i, j, GSL_NAN);
+        }
+    }
+
+  gsl_stats_kendall_matrix(X, flags, R);
+
+  for (i = 0; i < p; ++i)
+    {
+      for (j = 0; j < p; ++j)
+        {
+          size_t m = 0;
+
+          for (k = 0; k < n; ++k)
+            {
+              double a = gsl_matrix_get(X, k, i);
+              double b = gsl_matrix_get(X, k, j);
+
+              if (!gsl_isnan(a) && !gsl_isnan(b))
+                {
+                  xi[m] = a;
+                  xj[m] = b;
+                  ++m;
+                }
+            }
+
+          if (m < 2)
+            continue;
+
+          gsl_test_rel(gsl_matrix_get(R, i, j),
+                       gsl_stats_kendall(xi, 1, xj, 1, m, work), tol,
+                       "kendall_matrix n=%zu p=%zu pnan=%g (%zu,%zu)", n, p, pnan, i, j);
+        }
+    }
+
+  gsl_matrix_free(X);
+  gsl_matrix_free(R);
+  free(xi);
+  free(xj);
+  free(work);
+}
+
+int
+test_covmatrix (void)
+{
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+
+  test_complete(2, 1, r);
+  test_complete(3, 4, r);
+  test_complete(100, 7, r);
+  test_complete(1000, 13, r);
+
+  test_pairwise(5, 3, 0.3, r);
+  test_pairwise(100, 6, 0.1, r);
+  test_pairwise(1000, 9, 0.2, r);
+
+  test_kendall(2, 0.0, r);
+  test_kendall(10, 0.0, r);
+  test_kendall(10, 3.0, r);
+  test_kendall(257, 0.0, r);
+  test_kendall(500, 5.0, r);
+  test_kendall(1000, 50.0, r);
+
+  test_kendall_matrix(50, 5, 0.0, r);
+  test_kendall_matrix(300, 8, 0.0, r);
+  test_kendall_matrix(300, 8, 0.15, r);
+
+  gsl_rng_free(r);
+
+  return 0;
+}
@@ -187,6 +187,17 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (wkurt, expected, rel, NAME(gsl_stats) "_wkurtosis");
   }
 
+  {
+    double wmean, wvar, wskew, wkurt;
+
+    FUNCTION(gsl_stats,wsummary) (&wmean, &wvar, &wskew, &wkurt, w, strideb, groupa, stridea, na);
+
+    gsl_test_rel (wmean, 0.0678111523670601, rel, NAME(gsl_stats) "_wsummary wmean");
+    gsl_test_rel (wvar, FUNCTION(gsl_stats,wvariance) (w, strideb, groupa, stridea, na), rel, NAME(gsl_stats) "_wsummary wvariance");
+    gsl_test_rel (wskew, -0.373631000307076, rel, NAME(gsl_stats) "_wsummary wskew");
+    gsl_test_rel (wkurt, -1.48114233353963, rel, NAME(gsl_stats) "_wsummary wkurtosis");
+  }
+
   {
     double c = FUNCTION(gsl_stats,covariance) (groupa, stridea, groupb, strideb, nb);
     double expected = -0.000139021538461539;
@@ -249,6 +260,27 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min, expected_min);
   }
 
+  {
+    double mean, var, skew, kurt;
+    BASE min, max;
+
+    FUNCTION(gsl_stats,summary) (&mean, &var, &skew, &kurt, &min, &max, groupa, stridea, na);
+
+    gsl_test_rel (mean, FUNCTION(gsl_stats,mean) (groupa, stridea, na), rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (var, FUNCTION(gsl_stats,variance) (groupa, stridea, na), rel, NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (skew, FUNCTION(gsl_stats,skew) (groupa, stridea, na), rel, NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (kurt, FUNCTION(gsl_stats,kurtosis) (groupa, stridea, na), rel, NAME(gsl_stats) "_summary kurtosis");
+    gsl_test (max != (BASE)0.1331, NAME(gsl_stats) "_summary max (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)", max, (BASE)0.1331);
+    gsl_test (min != (BASE)0.0242, NAME(gsl_stats) "_summary min (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)", min, (BASE)0.0242);
+
+    /* no data: data[0] is not read and the results are NaN */
+    FUNCTION(gsl_stats,summary) (&mean, &var, &skew, &kurt, &min, &max, NULL, stridea, 0);
+
+    gsl_test (!gsl_isnan (mean) || !gsl_isnan (var) || !gsl_isnan (skew) || !gsl_isnan (kurt),
+              NAME(gsl_stats) "_summary n=0 moments");
+    gsl_test (!isnan (min) || !isnan (max), NAME(gsl_stats) "_summary n=0 min max");
+  }
+
   {
     int max_index = FUNCTION(gsl_stats,max_index) (groupa, stridea, na);
     int expected = 4;
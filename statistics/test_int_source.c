@@ -176,6 +176,27 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min, expected_min);
   }
 
+  {
+    double mean, var, skew, kurt;
+    BASE min, max;
+
+    FUNCTION(gsl_stats,summary) (&mean, &var, &skew, &kurt, &min, &max, igroupa, stridea, ina);
+
+    gsl_test_rel (mean, FUNCTION(gsl_stats,mean) (igroupa, stridea, ina), rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (var, FUNCTION(gsl_stats,variance) (igroupa, stridea, ina), rel, NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (skew, FUNCTION(gsl_stats,skew) (igroupa, stridea, ina), rel, NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (kurt, FUNCTION(gsl_stats,kurtosis) (igroupa, stridea, ina), rel, NAME(gsl_stats) "_summary kurtosis");
+    gsl_test (max != 22, NAME(gsl_stats) "_summary max (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)", max, (BASE) 22);
+    gsl_test (min != 8, NAME(gsl_stats) "_summary min (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)", min, (BASE) 8);
+
+    /* no data: data[0] is not read and the moments are NaN */
+    FUNCTION(gsl_stats,summary) (&mean, &var, &skew, &kurt, &min, &max, NULL, stridea, 0);
+
+    gsl_test (!gsl_isnan (mean) || !gsl_isnan (var) || !gsl_isnan (skew) || !gsl_isnan (kurt),
+              NAME(gsl_stats) "_summary n=0 moments");
+    gsl_test (min != 0 || max != 0, NAME(gsl_stats) "_summary n=0 min max");
+  }
+
   {
     int max_index = FUNCTION(gsl_stats,max_index) (igroupa, stridea, ina);
     int expected = 9 ;
@@ -0,0 +1,281 @@
+/* statistics/test_quantiles.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_statistics.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rng.h>
+
+int test_quantiles (void);
+
+/* compute p-quantile of sorted data using the definition of each method */
+static double
+slow_quantile(const gsl_stats_quantile_t type, const double p,
+              const size_t n, const double sorted[])
+{
+  const double h = p * (n - 1);
+  const size_t lhs = (size_t) h;
+  const double delta = h - lhs;
+  double a, b;
+
+  if (lhs >= n - 1)
+    return sorted[n - 1];
+
+  a = sorted[lhs];
+  b = sorted[lhs + 1];
+
+  switch (type)
+    {
+      case GSL_STATS_QUANTILE_LINEAR:
+        return (1 - delta) * a + delta * b;
+
+      case GSL_STATS_QUANTILE_LOWER:
+        return a;
+
+      case GSL_STATS_QUANTILE_HIGHER:
+        return (delta > 0.0) ? b : a;
+
+      case GSL_STATS_QUANTILE_NEAREST:
+        if (delta > 0.5 || (delta == 0.5 && (lhs & 1)))
+          return b;
+        else
+          return a;
+
+      case GSL_STATS_QUANTILE_MIDPOINT:
+        return (delta > 0.0) ? 0.5 * (a + b) : a;
+    }
+
+  return 0.0;
+}
+
+/* random nondecreasing quantiles in [0,1], including the endpoints */
+static void
+random_quantiles(const size_t np, double p[], gsl_rng * r)
+{
+  size_t i;
+
+  p[0] = 0.0;
+  p[np - 1] = 1.0;
+
+  for (i = 1; i < np - 1; ++i)
+    p[i] = gsl_rng_uniform(r);
+
+  gsl_sort(p, 1, np);
+}
+
+static void
+test_multi(const size_t n, const size_t stride, const size_t np,
+           const int ties, gsl_rng * r)
+{
+  double *x = malloc(n * stride * sizeof(double));
+  double *sorted = malloc(n * sizeof(double));
+  double *p = malloc(np * sizeof(double));
+  double *result = malloc(np * sizeof(double));
+  int *xi = malloc(n * sizeof(int));
+  int type;
+  size_t i;
+
+  random_quantiles(np, p, r);
+
+  for (type = GSL_STATS_QUANTILE_LINEAR; type <= GSL_STATS_QUANTILE_MIDPOINT; ++type)
+    {
+      for (i = 0; i < n; ++i)
+        {
+          double xv = 2.0 * gsl_rng_uniform(r) - 1.0;
+
+          if (ties)
+            xv = floor(10.0 * xv);
+
+          x[i * stride] = sorted[i] = xv;
+          xi[i] = (int) floor(100.0 * xv);
+        }
+
+      gsl_sort(sorted, 1, n);
+
+      gsl_stats_quantiles(x, stride, n, p, np, type, result);
+
+      for (i = 0; i < np; ++i)
+        {
+          double expected = slow_quantile(type, p[i], n, sorted);
+
+          gsl_test_rel(result[i], expected, GSL_DBL_EPSILON,
+                       "quantiles type=%d n=%zu stride=%zu np=%zu ties=%d p=%g",
+                       type, n, stride, np, ties, p[i]);
+
+          if (type == GSL_STATS_QUANTILE_LINEAR)
+            {
+              expected = gsl_stats_quantile_from_sorted_data(sorted, 1, n, p[i]);
+              gsl_test_rel(result[i], expected, GSL_DBL_EPSILON,
+                           "quantiles/from_sorted_data n=%zu np=%zu p=%g",
+                           n, np, p[i]);
+            }
+        }
+
+      /* integer version */
+      for (i = 0; i < n; ++i)
+        sorted[i] = xi[i];
+
+      gsl_sort(sorted, 1, n);
+
+      gsl_stats_int_quantiles(xi, 1, n, p, np, type, result);
+
+      for (i = 0; i < np; ++i)
+        {
+          double expected = slow_quantile(type, p[i], n, sorted);
+
+          gsl_test_rel(result[i], expected, GSL_DBL_EPSILON,
+                       "int_quantiles type=%d n=%zu np=%zu p=%g",
+                       type, n, np, p[i]);
+        }
+    }
+
+  free(x);
+  free(sorted);
+  free(p);
+  free(result);
+  free(xi);
+}
+
+/* compare weighted quantiles with unit weights and with zero weights
+ * against the unweighted quantiles */
+static void
+test_weighted(const size_t n, const size_t np, gsl_rng * r)
+{
+  double *x = malloc(2 * n * sizeof(double));
+  double *w = malloc(2 * n * sizeof(double));
+  double *y = malloc(n * sizeof(double));
+  double *p = malloc(np * sizeof(double));
+  double *result = malloc(np * sizeof(double));
+  double *expected = malloc(np * sizeof(double));
+  int type;
+  size_t i;
+
+  random_quantiles(np, p, r);
+
+  for (type = GSL_STATS_QUANTILE_LINEAR; type <= GSL_STATS_QUANTILE_MIDPOINT; ++type)
+    {
+      for (i = 0; i < n; ++i)
+        {
+          x[i] = y[i] = 2.0 * gsl_rng_uniform(r) - 1.0;
+          w[i] = 1.0;
+        }
+
+      gsl_stats_quantiles(y, 1, n, p, np, type, expected);
+      gsl_stats_wquantiles(w, 1, x, 1, n, p, np, type, result);
+
+      for (i = 0; i < np; ++i)
+        {
+          gsl_test_rel(result[i], expected[i], 1.0e-12,
+                       "wquantiles unit weights type=%d n=%zu p=%g",
+                       type, n, p[i]);
+        }
+
+      /* interleave points with zero weight, which must be ignored */
+      for (i = 0; i < n; ++i)
+        {
+          x[2 * i] = y[i];
+          w[2 * i] = 3.0;
+          x[2 * i + 1] = 10.0 * (2.0 * gsl_rng_uniform(r) - 1.0);
+          w[2 * i + 1] = 0.0;
+        }
+
+      gsl_stats_wquantiles(w, 1, x, 1, 2 * n, p, np, type, result);
+
+      for (i = 0; i < np; ++i)
+        {
+          gsl_test_rel(result[i], expected[i], 1.0e-12,
+                       "wquantiles zero weights type=%d n=%zu p=%g",
+                       type, n, p[i]);
+        }
+    }
+
+  free(x);
+  free(w);
+  free(y);
+  free(p);
+  free(result);
+  free(expected);
+}
+
+int
+test_quantiles (void)
+{
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+
+  test_multi(1, 1, 5, 0, r);
+  test_multi(2, 1, 5, 0, r);
+  test_multi(10, 2, 7, 0, r);
+  test_multi(101, 1, 3, 0, r);
+  test_multi(101, 3, 50, 1, r);
+  test_multi(1000, 1, 20, 0, r);
+  test_multi(1000, 1, 200, 1, r);
+  test_multi(5, 1, 100, 1, r);
+
+  test_weighted(1, 5, r);
+  test_weighted(2, 5, r);
+  test_weighted(57, 11, r);
+  test_weighted(500, 40, r);
+
+  /* weighted example: c = {0, 1/3, 1} */
+  {
+    double x[] = { 3.0, 1.0, 2.0 };
+    double w[] = { 1.0, 1.0, 2.0 };
+    double p[] = { 0.0, 1.0 / 6.0, 0.5, 1.0 };
+    double result[4];
+
+    gsl_stats_wquantiles(w, 1, x, 1, 3, p, 4, GSL_STATS_QUANTILE_LINEAR, result);
+    gsl_test_rel(result[0], 1.0, GSL_DBL_EPSILON, "wquantiles example p=0");
+    gsl_test_rel(result[1], 1.5, 1.0e-15, "wquantiles example p=1/6");
+    gsl_test_rel(result[2], 2.25, 1.0e-15, "wquantiles example p=1/2");
+    gsl_test_rel(result[3], 3.0, GSL_DBL_EPSILON, "wquantiles example p=1");
+  }
+
+  /* invalid arguments */
+  {
+    gsl_error_handler_t *old_handler = gsl_set_error_handler_off();
+    double x[] = { 3.0, 1.0, 2.0 };
+    double w[] = { 1.0, -1.0, 2.0 };
+    double p[] = { 0.5, 0.25 };
+    double result[2];
+    int status;
+
+    status = gsl_stats_quantiles(x, 1, 3, p, 2, GSL_STATS_QUANTILE_LINEAR, result);
+    gsl_test_int(status, GSL_EINVAL, "quantiles unsorted p");
+
+    p[1] = 1.5;
+    status = gsl_stats_quantiles(x, 1, 3, p, 2, GSL_STATS_QUANTILE_LINEAR, result);
+    gsl_test_int(status, GSL_EDOM, "quantiles p > 1");
+
+    p[1] = 0.75;
+    status = gsl_stats_wquantiles(w, 1, x, 1, 3, p, 2, GSL_STATS_QUANTILE_LINEAR, result);
+    gsl_test_int(status, GSL_EDOM, "wquantiles negative weight");
+
+    gsl_set_error_handler(old_handler);
+  }
+
+  gsl_rng_free(r);
+
+  return 0;
+}
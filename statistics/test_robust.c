@@ -221,6 +221,66 @@ test_Qn(const double tol, const size_t n, gsl_rng * r)
   return 0;
 }
 
+static int
+test_columns(const double tol, const size_t n, const size_t ncols, const size_t tda,
+             const size_t nblock, gsl_rng * r)
+{
+  double * A = malloc(n * tda * sizeof(double));
+  double * x = malloc(n * sizeof(double));
+  double * work = malloc((nblock + 3) * n * sizeof(double));
+  int * work_int = malloc(5 * n * sizeof(int));
+  double * result = malloc(ncols * sizeof(double));
+  size_t j;
+
+  random_array(n * tda, A, r);
+
+  gsl_stats_mad_columns(A, tda, n, ncols, result, work, nblock * n);
+  for (j = 0; j < ncols; ++j)
+    {
+      double mad = gsl_stats_mad(A + j, tda, n, x);
+      gsl_test_rel(result[j], mad, tol, "test_columns mad n=%zu ncols=%zu nblock=%zu j=%zu",
+                   n, ncols, nblock, j);
+    }
+
+  gsl_stats_Sn_columns(A, tda, n, ncols, result, work, (nblock + 1) * n);
+  for (j = 0; j < ncols; ++j)
+    {
+      double Sn;
+      size_t i;
+
+      for (i = 0; i < n; ++i)
+        x[i] = A[i * tda + j];
+
+      gsl_sort(x, 1, n);
+      Sn = gsl_stats_Sn_from_sorted_data(x, 1, n, work);
+      gsl_test_rel(result[j], Sn, tol, "test_columns Sn n=%zu ncols=%zu nblock=%zu j=%zu",
+                   n, ncols, nblock, j);
+    }
+
+  gsl_stats_Qn_columns(A, tda, n, ncols, result, work, (nblock + 3) * n, work_int);
+  for (j = 0; j < ncols; ++j)
+    {
+      double Qn;
+      size_t i;
+
+      for (i = 0; i < n; ++i)
+        x[i] = A[i * tda + j];
+
+      gsl_sort(x, 1, n);
+      Qn = gsl_stats_Qn_from_sorted_data(x, 1, n, work, work_int);
+      gsl_test_rel(result[j], Qn, tol, "test_columns Qn n=%zu ncols=%zu nblock=%zu j=%zu",
+                   n, ncols, nblock, j);
+    }
+
+  free(A);
+  free(x);
+  free(work);
+  free(work_int);
+  free(result);
+
+  return 0;
+}
+
 int
 test_robust (void)
 {
@@ -261,6 +321,11 @@ test_robust (void)
   test_Qn(tol, 500, r);
   test_Qn(tol, 501, r);
 
+  test_columns(GSL_DBL_EPSILON, 1, 3, 3, 1, r);
+  test_columns(GSL_DBL_EPSILON, 100, 13, 15, 1, r);
+  test_columns(GSL_DBL_EPSILON, 101, 13, 13, 4, r);
+  test_columns(GSL_DBL_EPSILON, 50, 7, 9, 20, r);
+
   gsl_rng_free(r);
 
   return 0;
@@ -0,0 +1,184 @@
+/* statistics/wquantiles_source.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* index of the first positive weight at or after position i */
+static size_t
+FUNCTION(wquantile,next) (const BASE w[], const size_t wstride,
+                          const size_t n, size_t i)
+{
+  while (i < n && !(w[i * wstride] > 0))
+    ++i;
+
+  return i;
+}
+
+/*
+gsl_stats_wquantiles()
+  Compute several weighted quantiles of an unsorted array
+
+The observations with positive weight, x_0 <= ... <= x_{r-1}, are
+placed at the positions
+
+  c_j = (w_0 + ... + w_{j-1}) / (w_0 + ... + w_{r-2})
+
+in [0,1], so that c_0 = 0 and c_{r-1} = 1. A quantile p with
+c_j <= p < c_{j+1} lies between x_j and x_{j+1}, with fraction
+delta = (p - c_j) / (c_{j+1} - c_j), and is computed from them
+according to the method 'type'. For equal weights this reduces to
+gsl_stats_quantiles().
+
+Inputs: w       - weights, length n; rearranged on output
+        wstride - stride of w
+        data    - unsorted array, length n; sorted on output
+        stride  - stride of data
+        n       - length of data
+        p       - quantiles to compute, nondecreasing in [0,1], length np
+        np      - number of quantiles
+        type    - method for quantiles between two observations
+        result  - (output) quantiles, length np
+*/
+
+int
+FUNCTION(gsl_stats,wquantiles) (BASE w[], const size_t wstride,
+                                BASE data[], const size_t stride,
+                                const size_t n, const double p[],
+                                const size_t np,
+                                const gsl_stats_quantile_t type,
+                                double result[])
+{
+  size_t i, cur, nxt, j = 0;
+  double S = 0.0, Wd = 0.0, wlast = 0.0;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("array size must be positive", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < np; i++)
+    {
+      if (!(p[i] >= 0.0 && p[i] <= 1.0))
+        {
+          GSL_ERROR ("quantiles must be in [0,1]", GSL_EDOM);
+        }
+
+      if (i > 0 && p[i] < p[i - 1])
+        {
+          GSL_ERROR ("quantiles must be in nondecreasing order", GSL_EINVAL);
+        }
+    }
+
+  if (type > GSL_STATS_QUANTILE_MIDPOINT)
+    {
+      GSL_ERROR ("unknown quantile method", GSL_EINVAL);
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      const BASE wi = w[i * wstride];
+
+      if (wi < 0)
+        {
+          GSL_ERROR ("weights must be non-negative", GSL_EDOM);
+        }
+      else if (wi > 0)
+        {
+          wlast = wi;
+        }
+    }
+
+  if (wlast == 0.0)
+    {
+      GSL_ERROR ("at least one weight must be positive", GSL_EDOM);
+    }
+
+  if (np == 0)
+    return GSL_SUCCESS;
+
+  TYPE(gsl_sort2) (data, stride, w, wstride, n);
+
+  /* sum all positive weights but the last, in the same order as the
+   * positions c_j are accumulated below, so that c_{r-1} = 1 exactly */
+  wlast = 0.0;
+  for (i = 0; i < n; i++)
+    {
+      const BASE wi = w[i * wstride];
+
+      if (wi > 0)
+        {
+          Wd += wlast;
+          wlast = wi;
+        }
+    }
+
+  cur = FUNCTION(wquantile,next) (w, wstride, n, 0);
+  nxt = FUNCTION(wquantile,next) (w, wstride, n, cur + 1);
+
+  for (i = 0; i < np; i++)
+    {
+      double cj, cj1, delta, b;
+
+      /* advance to the interval [c_j, c_{j+1}) containing p[i] */
+      while (nxt < n && (S + w[cur * wstride]) / Wd <= p[i])
+        {
+          S += w[cur * wstride];
+          cur = nxt;
+          nxt = FUNCTION(wquantile,next) (w, wstride, n, cur + 1);
+          ++j;
+        }
+
+      if (nxt >= n)
+        {
+          result[i] = data[cur * stride];
+          continue;
+        }
+
+      cj = S / Wd;
+      cj1 = (S + w[cur * wstride]) / Wd;
+      delta = (p[i] - cj) / (cj1 - cj);
+      b = data[nxt * stride];
+
+      switch (type)
+        {
+          case GSL_STATS_QUANTILE_LINEAR:
+            result[i] = (1 - delta) * data[cur * stride] + delta * b;
+            break;
+
+          case GSL_STATS_QUANTILE_HIGHER:
+            result[i] = (delta > 0.0) ? b : data[cur * stride];
+            break;
+
+          case GSL_STATS_QUANTILE_NEAREST:
+            if (delta > 0.5 || (delta == 0.5 && (j & 1)))
+              result[i] = b;
+            else
+              result[i] = data[cur * stride];
+            break;
+
+          case GSL_STATS_QUANTILE_MIDPOINT:
+            result[i] = (delta > 0.0) ? 0.5 * (data[cur * stride] + b) : data[cur * stride];
+            break;
+
+          default:
+            result[i] = data[cur * stride];
+            break;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,60 @@
+/* statistics/wsummary_source.c
+ * 
+ * Copyright (C) 2026 agent
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void
+FUNCTION (gsl_stats, wsummary) (double * wmean_out, double * wvariance_out,
+                                double * wskew_out, double * wkurtosis_out,
+                                const BASE w[], const size_t wstride,
+                                const BASE data[], const size_t stride,
+                                const size_t n)
+{
+  /* Compute the weighted mean, variance, skewness and kurtosis of a
+     dataset in a single pass, with the same normalizations as
+     gsl_stats_wmean, gsl_stats_wvariance, gsl_stats_wskew and
+     gsl_stats_wkurtosis.  Samples with non-positive weight are
+     ignored. */
+
+  moment_accum acc;
+  double W2 = 0.0;       /* sum of squared weights */
+  double var, sd;
+  size_t i;
+
+  moments_init (&acc);
+
+  for (i = 0; i < n; i++)
+    {
+      const BASE wi = w[i * wstride];
+
+      if (wi > 0)
+        {
+          moments_add (&acc, data[i * stride], wi);
+          W2 += (double) wi * wi;
+        }
+    }
+
+  /* the factor W^2 / (W^2 - W2) corrects the bias of the variance, see
+     gsl_stats_wvariance */
+  var = acc.M2 * acc.W / (acc.W * acc.W - W2);
+  sd = sqrt (var);
+
+  *wmean_out = acc.mean;
+  *wvariance_out = var;
+  *wskew_out = (acc.M3 / acc.W) / (var * sd);
+  *wkurtosis_out = (acc.M4 / acc.W) / (var * var) - 3.0;
+}